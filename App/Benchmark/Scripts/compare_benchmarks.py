@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Compare two Google Benchmark JSON reports of MeshBenchmarks.
+
+Usage:
+    compare_benchmarks.py baseline.json contender.json [--metric cpu_time] [--threshold 0.05]
+
+Benchmarks are matched by name. When the reports were produced with --benchmark_repetitions, the mean aggregate is
+compared. The script exits with status 1 if a benchmark of the contender is slower than the baseline by more than
+the threshold, so that it can gate a release.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_times(filepath, metric):
+    """Return {benchmark name: time in nanoseconds} for a JSON report."""
+    with open(filepath, encoding="utf-8") as file:
+        report = json.load(file)
+
+    to_nanoseconds = {"ns": 1.0, "us": 1.0e3, "ms": 1.0e6, "s": 1.0e9}
+    times = {}
+    has_aggregates = any(entry.get("run_type") == "aggregate" for entry in report["benchmarks"])
+    for entry in report["benchmarks"]:
+        if entry.get("error_occurred"):
+            continue
+        if has_aggregates:
+            if entry.get("run_type") != "aggregate" or entry.get("aggregate_name") != "mean":
+                continue
+            name = entry["run_name"]
+        else:
+            name = entry["name"]
+        times[name] = entry[metric] * to_nanoseconds[entry.get("time_unit", "ns")]
+    return times
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1.0e9), ("ms", 1.0e6), ("us", 1.0e3)):
+        if nanoseconds >= scale:
+            return f"{nanoseconds / scale:.3f} {unit}"
+    return f"{nanoseconds:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two MeshBenchmarks JSON reports.")
+    parser.add_argument("baseline", help="JSON report of the reference build")
+    parser.add_argument("contender", help="JSON report of the build to check")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time",
+                        help="time to compare (default: real_time)")
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="relative slowdown above which a benchmark is a regression (default: 0.05)")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    contender = load_times(args.contender, args.metric)
+
+    names = [name for name in baseline if name in contender]
+    if not names:
+        print("No common benchmark between the two reports.")
+        return 1
+
+    width = max(len(name) for name in names)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Contender':>12}  {'Change':>8}")
+    regressions = []
+    for name in names:
+        change = contender[name] / baseline[name] - 1.0 if baseline[name] > 0 else 0.0
+        status = ""
+        if change > args.threshold:
+            status = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            status = "  improvement"
+        print(f"{name:<{width}}  {format_time(baseline[name]):>12}  {format_time(contender[name]):>12}"
+              f"  {change:>+7.1%}{status}")
+
+    for name in sorted(set(baseline) ^ set(contender)):
+        print(f"{name}: only in {'baseline' if name in baseline else 'contender'}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed by more than {args.threshold:.0%}.")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
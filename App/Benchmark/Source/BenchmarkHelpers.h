@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/MeshExporter.h"
+#include "Application/TestHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace BenchmarkHelpers
+{
+/// @brief Kind of generated mesh a benchmark runs on.
+enum struct MeshKind : uint8_t
+{
+	/// @brief Planar grid, argument is the requested triangle count.
+	Grid = 0,
+	/// @brief Closed unit icosphere, argument is the subdivision count.
+	Icosphere,
+};
+
+/// @brief Get a generated mesh, built once per kind and argument.
+inline const Data::Surface::Mesh& GetMesh(MeshKind kind, int64_t arg)
+{
+	static std::map<std::pair<MeshKind, int64_t>, std::unique_ptr<Data::Surface::Mesh>> meshes;
+
+	std::unique_ptr<Data::Surface::Mesh>& mesh = meshes[{ kind, arg }];
+	if(mesh == nullptr)
+	{
+		if(kind == MeshKind::Grid)
+		{
+			// 2*n*n triangles for a n*n grid.
+			const auto rowCount = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(arg) / 2.)));
+			mesh = std::make_unique<Data::Surface::Mesh>(TestHelpers::CreateGridMesh(rowCount, rowCount));
+		}
+		else
+		{
+			mesh = std::make_unique<Data::Surface::Mesh>(TestHelpers::CreateIcosphereMesh(static_cast<int>(arg)));
+		}
+	}
+	return *mesh;
+}
+
+/// @brief Get the path of a temporary file for the generated mesh.
+inline std::filesystem::path GetMeshFilepath(MeshKind kind, int64_t arg, const std::string& extension)
+{
+	const std::string name = std::string(kind == MeshKind::Grid ? "grid" : "icosphere") + std::to_string(arg);
+	return std::filesystem::temp_directory_path() / ("MeshBenchmarks_" + name + extension);
+}
+
+/// @brief Get a file containing the generated mesh, exported once per kind, argument and format.
+/// @param extension Extension of the file (.off or .obj).
+inline const std::filesystem::path& GetMeshFile(MeshKind kind, int64_t arg, const std::string& extension)
+{
+	static std::map<std::filesystem::path, bool> exportedFilepaths;
+
+	const std::filesystem::path filepath = GetMeshFilepath(kind, arg, extension);
+	auto [it, isInserted] = exportedFilepaths.try_emplace(filepath, true);
+	if(isInserted)
+	{
+		const Data::Surface::Mesh& mesh = GetMesh(kind, arg);
+		if(extension == ".off")
+			Utilitary::Surface::MeshExporter::ExportOFF(mesh, filepath);
+		else
+			Utilitary::Surface::MeshExporter::ExportOBJ(mesh, filepath);
+	}
+	return it->first;
+}
+
+/// @brief Report the size of the mesh and the processed triangles per second.
+inline void SetMeshCounters(benchmark::State& state, const Data::Surface::Mesh& mesh)
+{
+	state.counters["Triangles"] = static_cast<double>(mesh.GetTriangleCount());
+	state.counters["Vertices"] = static_cast<double>(mesh.GetVertexCount());
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(mesh.GetTriangleCount()));
+}
+
+/// @brief Grids from 1K to 10M triangles.
+inline void GridSizes(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->ArgName("triangles")->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+}
+
+/// @brief Icospheres from 1.3K to 5.2M triangles.
+inline void IcosphereSizes(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->ArgName("subdivisions")->DenseRange(3, 9, 2)->Unit(benchmark::kMillisecond);
+}
+} // namespace BenchmarkHelpers
+
+/// @brief Register a benchmark taking a MeshKind on grids and icospheres of every size.
+#define MESH_BENCHMARK(func)                                                                                         \
+	BENCHMARK_CAPTURE(func, Grid, BenchmarkHelpers::MeshKind::Grid)->Apply(BenchmarkHelpers::GridSizes);             \
+	BENCHMARK_CAPTURE(func, Icosphere, BenchmarkHelpers::MeshKind::Icosphere)->Apply(BenchmarkHelpers::IcosphereSizes)
@@ -0,0 +1,93 @@
+#include "BenchmarkHelpers.h"
+
+#include "Application/ExtraDataType.h"
+#include "Application/MeshExporter.h"
+#include "Application/MeshLoader.h"
+#include "Application/PrimitiveProxy.h"
+
+#include <filesystem>
+#include <memory>
+
+using namespace BenchmarkHelpers;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Core::BaseType;
+
+namespace
+{
+void BM_LoadOFF(benchmark::State& state, MeshKind kind)
+{
+	const std::filesystem::path& filepath = GetMeshFile(kind, state.range(0), ".off");
+	for(auto _ : state)
+	{
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadOFF(filepath);
+		benchmark::DoNotOptimize(mesh.get());
+	}
+	SetMeshCounters(state, GetMesh(kind, state.range(0)));
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+}
+
+void BM_LoadOBJ(benchmark::State& state, MeshKind kind)
+{
+	const std::filesystem::path& filepath = GetMeshFile(kind, state.range(0), ".obj");
+	for(auto _ : state)
+	{
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadOBJ(filepath);
+		benchmark::DoNotOptimize(mesh.get());
+	}
+	SetMeshCounters(state, GetMesh(kind, state.range(0)));
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+}
+
+void BM_ExportOFF(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	const std::filesystem::path filepath = GetMeshFilepath(kind, state.range(0), "_export.off");
+	for(auto _ : state)
+		MeshExporter::ExportOFF(mesh, filepath);
+	SetMeshCounters(state, mesh);
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+	std::filesystem::remove(filepath);
+}
+
+void BM_ExportOBJ(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	const std::filesystem::path filepath = GetMeshFilepath(kind, state.range(0), "_export.obj");
+	for(auto _ : state)
+		MeshExporter::ExportOBJ(mesh, filepath);
+	SetMeshCounters(state, mesh);
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+	std::filesystem::remove(filepath);
+}
+
+void BM_ExportOBJWithTexCoords(benchmark::State& state, MeshKind kind)
+{
+	// Each corner has the texture coordinates of its vertex, the unique ones being written once.
+	Mesh mesh = GetMesh(kind, state.range(0));
+	mesh.AddTrianglesExtraDataContainer();
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		Data::Primitive::TriangleProxy triangle = mesh.GetTriangle(iTriangle);
+		auto& texCoords = triangle.GetOrCreateExtraData<Data::ExtraData::VerticesTexCoordsExtraData>();
+		for(VertexLocalIndex iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			const Vec3& position = mesh.GetVertexData(mesh.GetTriangleData(iTriangle).Vertices[iCorner]).Position;
+			texCoords.SetVertexTexCoords(Vec2{ position.x, position.y }, iCorner);
+		}
+	}
+
+	const std::filesystem::path filepath = GetMeshFilepath(kind, state.range(0), "_export_tex.obj");
+	for(auto _ : state)
+		MeshExporter::ExportOBJ(mesh, filepath);
+	SetMeshCounters(state, mesh);
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+	std::filesystem::remove(filepath);
+}
+} // namespace
+
+MESH_BENCHMARK(BM_LoadOFF);
+MESH_BENCHMARK(BM_LoadOBJ);
+MESH_BENCHMARK(BM_ExportOFF);
+MESH_BENCHMARK(BM_ExportOBJ);
+MESH_BENCHMARK(BM_ExportOBJWithTexCoords);
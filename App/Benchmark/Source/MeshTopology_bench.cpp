@@ -0,0 +1,505 @@
+#include "BenchmarkHelpers.h"
+
+#include "Application/CornerTable.h"
+#include "Application/MeshBoundary.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshNormals.h"
+#include "Application/MeshReordering.h"
+#include "Application/MeshVertexCache.h"
+#include "Application/OneRingAdjacency.h"
+#include "Core/FlatHashMap.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+using namespace BenchmarkHelpers;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Get the positions and triangle vertices of a generated mesh.
+std::pair<std::vector<Vec3>, std::vector<std::array<int, 3>>> GetMeshArrays(const Mesh& mesh)
+{
+	std::pair<std::vector<Vec3>, std::vector<std::array<int, 3>>> arrays;
+	arrays.first.reserve(mesh.GetVertexCount());
+	for(const Data::Primitive::Vertex& curVertex : mesh.GetVertices())
+		arrays.first.push_back(curVertex.Position);
+	arrays.second.reserve(mesh.GetTriangleCount());
+	for(const Data::Primitive::Triangle& curTriangle : mesh.GetTriangles())
+		arrays.second.push_back(curTriangle.Vertices);
+	return arrays;
+}
+
+void BM_BuildMeshByAdding(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& sourceMesh = GetMesh(kind, state.range(0));
+	const auto [positions, triangleVertices] = GetMeshArrays(sourceMesh);
+	for(auto _ : state)
+	{
+		Mesh mesh;
+		for(const Vec3& curPosition : positions)
+			mesh.AddVertex({ .Position = curPosition });
+		for(const std::array<int, 3>& curVertices : triangleVertices)
+			mesh.AddTriangle({ .Vertices = curVertices });
+		mesh.UpdateMeshConnectivity();
+		benchmark::DoNotOptimize(mesh);
+	}
+	SetMeshCounters(state, sourceMesh);
+}
+
+void BM_BuildMeshFromSpans(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& sourceMesh = GetMesh(kind, state.range(0));
+	const auto [positions, triangleVertices] = GetMeshArrays(sourceMesh);
+	for(auto _ : state)
+	{
+		Mesh mesh(positions, triangleVertices);
+		benchmark::DoNotOptimize(mesh);
+	}
+	SetMeshCounters(state, sourceMesh);
+}
+
+void BM_GarbageCollect(benchmark::State& state, MeshKind kind)
+{
+	// One vertex out of 100 and one triangle out of 10 are deleted.
+	Mesh deletedMesh = GetMesh(kind, state.range(0));
+	for(VertexIndex iVertex = 0; iVertex < deletedMesh.GetVertexCount(); iVertex += 100)
+		deletedMesh.DeleteVertex(iVertex);
+	for(TriangleIndex iTriangle = 0; iTriangle < deletedMesh.GetTriangleCount(); iTriangle += 10)
+		deletedMesh.DeleteTriangle(iTriangle);
+
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		Mesh mesh = deletedMesh;
+		state.ResumeTiming();
+		benchmark::DoNotOptimize(mesh.GarbageCollect());
+	}
+	SetMeshCounters(state, deletedMesh);
+}
+
+void BM_SnapshotAndMoveVertex(benchmark::State& state, MeshKind kind)
+{
+	// The snapshot shares the arrays, moving a vertex copies the chunk of the vertex only.
+	Mesh mesh = GetMesh(kind, state.range(0));
+	mesh.ComputeTriangleNormals(true);
+	for(auto _ : state)
+	{
+		const std::shared_ptr<const Mesh> snapshot = mesh.CreateSnapshot();
+		mesh.SetVertexPosition(0, snapshot->GetVertexData(0).Position);
+		benchmark::DoNotOptimize(snapshot.get());
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_UpdateMeshConnectivity(benchmark::State& state, MeshKind kind)
+{
+	Mesh mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		mesh.UpdateMeshConnectivity();
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_ComputeTriangleNormals(benchmark::State& state, MeshKind kind)
+{
+	Mesh mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		mesh.ComputeTriangleNormals(true);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_ComputeSmoothVertexNormals(benchmark::State& state, MeshKind kind)
+{
+	Mesh mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		mesh.ComputeSmoothVertexNormals(true);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_ComputeVertexNormals(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	std::vector<Vec3> normals(mesh.GetVertexCount());
+	for(auto _ : state)
+	{
+		MeshNormals::ComputeVertexNormals(mesh.GetVertices(), mesh.GetTriangles(), normals, NormalWeighting::Angle);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_UpdateDirtyNormals(benchmark::State& state, MeshKind kind)
+{
+	// Move 1024 vertices spread over the mesh at each step, only the normals around them are computed.
+	constexpr VertexIndex MovedVertexCount = 1024;
+	Mesh mesh = GetMesh(kind, state.range(0));
+	mesh.ComputeSmoothVertexNormals(true);
+	const VertexIndex stride = std::max<VertexIndex>(mesh.GetVertexCount() / MovedVertexCount, 1);
+	for(auto _ : state)
+	{
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); iVertex += stride)
+			mesh.MarkVertexDirty(iVertex);
+		mesh.UpdateDirtyNormals(true);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_UpdateVerticesBoundaryStatus(benchmark::State& state, MeshKind kind)
+{
+	Mesh mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		mesh.UpdateVerticesBoundaryStatus();
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_AnalyzeBoundary(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		BoundaryReport report = MeshBoundary::Analyze(mesh);
+		benchmark::DoNotOptimize(report);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_VerticesAroundVertex(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		VertexIndex indexSum = 0;
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+				indexSum += curVertexIdx;
+		}
+		benchmark::DoNotOptimize(indexSum);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+/// @brief Get a copy of a generated mesh with its vertices and triangles shuffled, as in a scan file.
+const Mesh& GetShuffledMesh(MeshKind kind, int64_t arg)
+{
+	static std::map<std::pair<MeshKind, int64_t>, std::unique_ptr<Mesh>> meshes;
+
+	std::unique_ptr<Mesh>& mesh = meshes[{ kind, arg }];
+	if(mesh == nullptr)
+	{
+		mesh = std::make_unique<Mesh>(GetMesh(kind, arg));
+		std::mt19937 generator(42);
+		std::vector<uint32_t> vertexOrder(mesh->GetVertexCount());
+		std::iota(vertexOrder.begin(), vertexOrder.end(), 0);
+		std::shuffle(vertexOrder.begin(), vertexOrder.end(), generator);
+		std::vector<uint32_t> triangleOrder(mesh->GetTriangleCount());
+		std::iota(triangleOrder.begin(), triangleOrder.end(), 0);
+		std::shuffle(triangleOrder.begin(), triangleOrder.end(), generator);
+		MeshReordering::Permute(*mesh, vertexOrder, triangleOrder);
+	}
+	return *mesh;
+}
+
+/// @brief Average the positions of the neighbors of each vertex, as a smoothing pass does.
+void SmoothPositions(const Mesh& mesh, std::vector<Vec3>& positions)
+{
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		Vec3 positionSum(0.f);
+		float neighborCount = 0.f;
+		for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+		{
+			positionSum += mesh.GetVertexData(curVertexIdx).Position;
+			neighborCount += 1.f;
+		}
+		positions[iVertex] = neighborCount > 0.f ? positionSum / neighborCount : mesh.GetVertexData(iVertex).Position;
+	}
+}
+
+void BM_SmoothShuffled(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetShuffledMesh(kind, state.range(0));
+	std::vector<Vec3> positions(mesh.GetVertexCount());
+	for(auto _ : state)
+	{
+		SmoothPositions(mesh, positions);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_ReorderMorton(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& shuffledMesh = GetShuffledMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		Mesh mesh = shuffledMesh;
+		state.ResumeTiming();
+		MeshReordering::Reorder(mesh, ReorderingMethod::Morton);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, shuffledMesh);
+}
+
+void BM_SmoothReorderedMorton(benchmark::State& state, MeshKind kind)
+{
+	Mesh mesh = GetShuffledMesh(kind, state.range(0));
+	MeshReordering::Reorder(mesh, ReorderingMethod::Morton);
+	std::vector<Vec3> positions(mesh.GetVertexCount());
+	for(auto _ : state)
+	{
+		SmoothPositions(mesh, positions);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_SmoothReorderedBreadthFirst(benchmark::State& state, MeshKind kind)
+{
+	Mesh mesh = GetShuffledMesh(kind, state.range(0));
+	MeshReordering::Reorder(mesh, ReorderingMethod::BreadthFirst);
+	std::vector<Vec3> positions(mesh.GetVertexCount());
+	for(auto _ : state)
+	{
+		SmoothPositions(mesh, positions);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_OptimizeVertexCache(benchmark::State& state, MeshKind kind)
+{
+	Mesh mesh = GetShuffledMesh(kind, state.range(0));
+	MeshReordering::Reorder(mesh, ReorderingMethod::Morton);
+	std::vector<TriangleIndex> order;
+	for(auto _ : state)
+	{
+		order = MeshVertexCache::ComputeTriangleOrder(mesh.GetTriangles());
+		benchmark::DoNotOptimize(order);
+	}
+
+	std::vector<Data::Primitive::Triangle> orderedTriangles;
+	orderedTriangles.reserve(order.size());
+	for(TriangleIndex curTriangleIdx : order)
+		orderedTriangles.push_back(mesh.GetTriangleData(curTriangleIdx));
+	state.counters["ACMRBefore"] = MeshVertexCache::Analyze(mesh.GetVertexCount(), mesh.GetTriangles()).ACMR;
+	state.counters["ACMRAfter"] = MeshVertexCache::Analyze(mesh.GetVertexCount(), orderedTriangles).ACMR;
+	SetMeshCounters(state, mesh);
+}
+
+void BM_BuildOneRingAdjacency(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		OneRingAdjacency adjacency = OneRingAdjacency::Build(mesh);
+		benchmark::DoNotOptimize(adjacency);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_VerticesAroundVertexCached(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	const OneRingAdjacency adjacency = OneRingAdjacency::Build(mesh);
+	for(auto _ : state)
+	{
+		VertexIndex indexSum = 0;
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(VertexIndex curVertexIdx : adjacency.GetVerticesAroundVertex(iVertex))
+				indexSum += curVertexIdx;
+		}
+		benchmark::DoNotOptimize(indexSum);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_BuildCornerTable(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		CornerTable table = CornerTable::FromMesh(mesh);
+		benchmark::DoNotOptimize(table);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_VerticesAroundVertexCornerTable(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	const CornerTable table = CornerTable::FromMesh(mesh);
+	for(auto _ : state)
+	{
+		VertexIndex indexSum = 0;
+		for(VertexIndex iVertex = 0; iVertex < table.GetVertexCount(); ++iVertex)
+		{
+			for(VertexIndex curVertexIdx : table.GetVerticesAroundVertex(iVertex))
+				indexSum += curVertexIdx;
+		}
+		benchmark::DoNotOptimize(indexSum);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_TrianglesAroundVertex(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		TriangleIndex indexSum = 0;
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertex(iVertex))
+				indexSum += curTriangleIdx;
+		}
+		benchmark::DoNotOptimize(indexSum);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+/// @brief Map each edge of a mesh to one of its triangles, in a hash map keyed by the packed indices of its vertices.
+template<typename MapT>
+void MapEdges(benchmark::State& state, MeshKind kind, MapT& edges)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		edges = MapT(mesh.GetTriangleCount() * 3 / 2);
+		for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		{
+			const Data::Primitive::Triangle& curTriangle = mesh.GetTriangleData(iTriangle);
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				const auto [minIndex, maxIndex] =
+					std::minmax(curTriangle.Vertices[iEdge], curTriangle.Vertices[(iEdge + 1) % 3]);
+				const uint64_t key = (static_cast<uint64_t>(minIndex) << 32) | static_cast<uint64_t>(maxIndex);
+				edges[key] = iTriangle;
+			}
+		}
+		benchmark::DoNotOptimize(edges);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_MapEdgesUnorderedMap(benchmark::State& state, MeshKind kind)
+{
+	std::unordered_map<uint64_t, uint32_t> edges;
+	MapEdges(state, kind, edges);
+}
+
+void BM_MapEdgesFlatHashMap(benchmark::State& state, MeshKind kind)
+{
+	Core::Container::FlatHashMap<uint64_t, uint32_t> edges;
+	MapEdges(state, kind, edges);
+}
+
+/// @brief Get the length of an edge given by its vertices.
+float GetEdgeLength(const Mesh& mesh, VertexIndex firstVertexIdx, VertexIndex secondVertexIdx)
+{
+	const Vec3 vector = mesh.GetVertexData(secondVertexIdx).Position - mesh.GetVertexData(firstVertexIdx).Position;
+	return std::sqrt(glm::dot(vector, vector));
+}
+
+void BM_ComputeEdgeLengthsHashMap(benchmark::State& state, MeshKind kind)
+{
+	// Each edge pass finds the edges again from the triangles.
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		Core::Container::FlatHashMap<uint64_t, float> lengths(mesh.GetTriangleCount() * 3 / 2);
+		for(const Data::Primitive::Triangle& curTriangle : mesh.GetTriangles())
+		{
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				const auto [minIndex, maxIndex] =
+					std::minmax(curTriangle.Vertices[iEdge], curTriangle.Vertices[(iEdge + 1) % 3]);
+				const uint64_t key = (static_cast<uint64_t>(minIndex) << 32) | static_cast<uint64_t>(maxIndex);
+				const auto [length, isInserted] = lengths.TryEmplace(key);
+				if(isInserted)
+					length = GetEdgeLength(mesh, minIndex, maxIndex);
+			}
+		}
+		benchmark::DoNotOptimize(lengths);
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_ComputeEdgeLengthsEdgeTable(benchmark::State& state, MeshKind kind)
+{
+	// The edge table of the connectivity makes the pass a scan of the edges.
+	Mesh mesh = GetMesh(kind, state.range(0));
+	Data::Attribute::AttributeChannel<float>& lengths = mesh.AddEdgeAttribute<float>("Length");
+	for(auto _ : state)
+	{
+		const std::vector<Data::Primitive::Edge>& edges = mesh.GetEdges();
+		for(size_t iEdge = 0; iEdge < edges.size(); ++iEdge)
+			lengths[iEdge] = GetEdgeLength(mesh, edges[iEdge].Vertices[0], edges[iEdge].Vertices[1]);
+		benchmark::ClobberMemory();
+	}
+	SetMeshCounters(state, mesh);
+}
+
+void BM_CheckIntegrity(benchmark::State& state, MeshKind kind)
+{
+	const Mesh& mesh = GetMesh(kind, state.range(0));
+	for(auto _ : state)
+	{
+		MeshIntegrity::ExitCode exitCode = MeshIntegrity::CheckIntegrity(mesh);
+		benchmark::DoNotOptimize(exitCode);
+	}
+	SetMeshCounters(state, mesh);
+}
+} // namespace
+
+MESH_BENCHMARK(BM_BuildMeshByAdding);
+MESH_BENCHMARK(BM_BuildMeshFromSpans);
+MESH_BENCHMARK(BM_GarbageCollect);
+MESH_BENCHMARK(BM_SnapshotAndMoveVertex);
+MESH_BENCHMARK(BM_UpdateMeshConnectivity);
+MESH_BENCHMARK(BM_ComputeTriangleNormals);
+MESH_BENCHMARK(BM_ComputeSmoothVertexNormals);
+MESH_BENCHMARK(BM_ComputeVertexNormals);
+MESH_BENCHMARK(BM_UpdateDirtyNormals);
+MESH_BENCHMARK(BM_UpdateVerticesBoundaryStatus);
+MESH_BENCHMARK(BM_AnalyzeBoundary);
+MESH_BENCHMARK(BM_VerticesAroundVertex);
+MESH_BENCHMARK(BM_SmoothShuffled);
+MESH_BENCHMARK(BM_ReorderMorton);
+MESH_BENCHMARK(BM_SmoothReorderedMorton);
+MESH_BENCHMARK(BM_SmoothReorderedBreadthFirst);
+MESH_BENCHMARK(BM_OptimizeVertexCache);
+MESH_BENCHMARK(BM_BuildOneRingAdjacency);
+MESH_BENCHMARK(BM_VerticesAroundVertexCached);
+MESH_BENCHMARK(BM_BuildCornerTable);
+MESH_BENCHMARK(BM_VerticesAroundVertexCornerTable);
+MESH_BENCHMARK(BM_TrianglesAroundVertex);
+MESH_BENCHMARK(BM_MapEdgesUnorderedMap);
+MESH_BENCHMARK(BM_MapEdgesFlatHashMap);
+MESH_BENCHMARK(BM_ComputeEdgeLengthsHashMap);
+MESH_BENCHMARK(BM_ComputeEdgeLengthsEdgeTable);
+MESH_BENCHMARK(BM_CheckIntegrity);
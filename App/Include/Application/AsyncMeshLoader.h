@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/MeshLoader.h"
+#include "Core/ThreadPool.h"
+
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+
+namespace Utilitary::Surface
+{
+/// @brief Handle on a mesh being loaded on a worker thread.
+/// @note Destroying the handle of a loading in flight requests its cancellation.
+class MeshLoadHandle
+{
+public:
+	/// @brief Default ctor (no loading attached).
+	MeshLoadHandle() = default;
+	/// @brief Construct a handle from the shared progress and the result of a loading.
+	MeshLoadHandle(std::shared_ptr<LoadProgress> progress, std::future<std::unique_ptr<Data::Surface::Mesh>> future);
+	~MeshLoadHandle();
+
+	/// @brief Disable copy semantics.
+	MeshLoadHandle(const MeshLoadHandle&) = delete;
+	MeshLoadHandle& operator=(const MeshLoadHandle&) = delete;
+
+	/// @brief Enable move semantics.
+	MeshLoadHandle(MeshLoadHandle&&) noexcept = default;
+	/// @brief Enable move semantics.
+	MeshLoadHandle& operator=(MeshLoadHandle&& other) noexcept;
+
+	/// @brief Check if a loading is attached and its mesh has not been retrieved yet.
+	bool IsValid() const;
+	/// @brief Check if the loading has ended (successfully or not).
+	bool IsReady() const;
+	/// @brief Wait for the end of the loading, at most for the given duration.
+	/// @return True if the loading has ended.
+	bool WaitFor(std::chrono::milliseconds duration) const;
+
+	/// @brief Get the progress of the loading.
+	const LoadProgress& GetProgress() const;
+	/// @brief Request the cancellation of the loading, the loader stops at its next check.
+	void Cancel();
+
+	/// @brief Wait for the end of the loading and take the loaded mesh.
+	/// @note Can be called only once.
+	/// @return Pointer to the loaded mesh, or nullptr if the loading failed or has been cancelled.
+	std::unique_ptr<Data::Surface::Mesh> Get();
+
+private:
+	/// @brief Progress shared with the loading task.
+	std::shared_ptr<LoadProgress> m_Progress{};
+	/// @brief Result of the loading task.
+	std::future<std::unique_ptr<Data::Surface::Mesh>> m_Future{};
+};
+
+/// @brief Struct for loading meshes from files without blocking the caller.
+struct AsyncMeshLoader
+{
+	/// @brief Load a mesh on a worker thread of the given pool.
+	/// @param filepath Path to the mesh file, its format is chosen from its extension (.off, .obj, .ply, .stl or
+	/// the native binary extension).
+	/// @param pool Pool running the loading.
+	/// @return Handle giving the progress and the loaded mesh.
+	static MeshLoadHandle LoadAsync(const std::filesystem::path& filepath, Core::Parallel::ThreadPool& pool);
+
+	/// @brief Load a mesh on a worker thread of the default pool.
+	/// @param filepath Path to the mesh file, its format is chosen from its extension.
+	/// @return Handle giving the progress and the loaded mesh.
+	static MeshLoadHandle LoadAsync(const std::filesystem::path& filepath);
+};
+} // namespace Utilitary::Surface
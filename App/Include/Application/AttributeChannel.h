@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace Data::Attribute
+{
+/// @brief Type-erased base of an attribute channel, letting the mesh keep every channel the size of its primitives.
+class BaseAttributeChannel
+{
+public:
+	virtual ~BaseAttributeChannel() = default;
+
+	/// @brief Get the number of values (one per primitive).
+	virtual size_t GetSize() const = 0;
+	/// @brief Resize the channel, new values being set to the default value.
+	virtual void Resize(size_t size) = 0;
+	/// @brief Deep copy of the channel.
+	virtual std::unique_ptr<BaseAttributeChannel> Clone() const = 0;
+	/// @brief Get the type of the values.
+	virtual std::type_index GetValueType() const = 0;
+	/// @brief Reorder the values, the new value i being the old value order[i].
+	/// @note order must be a permutation of [0, GetSize()).
+	virtual void Permute(std::span<const uint32_t> order) = 0;
+	/// @brief Move each value i to newIndices[i] and drop the values mapped to -1.
+	/// @note The new indices of the kept values must be increasing and cover [0, size).
+	virtual void Compact(std::span<const int> newIndices, size_t size) = 0;
+	/// @brief Rebuild the values, the new value i being the old value oldIndices[i] (the default value for -1).
+	/// @note An old value may be used by several new values, or by none.
+	virtual void Remap(std::span<const int> oldIndices) = 0;
+};
+
+/// @brief Contiguous array storing one value of type T per primitive (vertex, edge or triangle) of a mesh.
+template<typename T>
+class AttributeChannel final : public BaseAttributeChannel
+{
+	static_assert(!std::is_same_v<T, bool>, "std::vector<bool> is not contiguous, use uint8_t instead.");
+
+public:
+	/// @brief Construct a channel of the given size, filled with the default value.
+	explicit AttributeChannel(size_t size = 0, const T& defaultValue = T{})
+		: m_Values(size, defaultValue)
+		, m_DefaultValue(defaultValue)
+	{}
+
+	size_t GetSize() const override { return m_Values.size(); }
+	void Resize(size_t size) override { m_Values.resize(size, m_DefaultValue); }
+	std::unique_ptr<BaseAttributeChannel> Clone() const override { return std::make_unique<AttributeChannel>(*this); }
+	std::type_index GetValueType() const override { return typeid(T); }
+	void Permute(std::span<const uint32_t> order) override
+	{
+		assert(order.size() == m_Values.size() && "The order must be a permutation of the values");
+		std::vector<T> values;
+		values.reserve(m_Values.size());
+		for(uint32_t curIdx : order)
+			values.emplace_back(std::move(m_Values[curIdx]));
+		m_Values = std::move(values);
+	}
+	void Compact(std::span<const int> newIndices, size_t size) override
+	{
+		assert(newIndices.size() == m_Values.size() && "There must be a new index per value");
+		for(size_t iValue = 0; iValue < m_Values.size(); ++iValue)
+		{
+			if(newIndices[iValue] != -1 && static_cast<size_t>(newIndices[iValue]) != iValue)
+				m_Values[newIndices[iValue]] = std::move(m_Values[iValue]);
+		}
+		m_Values.resize(size, m_DefaultValue);
+	}
+	void Remap(std::span<const int> oldIndices) override
+	{
+		std::vector<T> values;
+		values.reserve(oldIndices.size());
+		for(int curIdx : oldIndices)
+		{
+			assert((curIdx == -1 || static_cast<size_t>(curIdx) < m_Values.size()) && "Index out of bound");
+			values.emplace_back(curIdx == -1 ? m_DefaultValue : m_Values[curIdx]);
+		}
+		m_Values = std::move(values);
+	}
+
+	/// @brief Get the value of the primitive at the given index.
+	T& operator[](size_t index)
+	{
+		assert(index < m_Values.size() && "Index out of bound");
+		return m_Values[index];
+	}
+
+	/// @brief Get the value of the primitive at the given index (const version).
+	const T& operator[](size_t index) const
+	{
+		assert(index < m_Values.size() && "Index out of bound");
+		return m_Values[index];
+	}
+
+	/// @brief Get all the values, indexed by primitive.
+	std::span<T> GetValues() { return m_Values; }
+	/// @brief Get all the values, indexed by primitive (const version).
+	std::span<const T> GetValues() const { return m_Values; }
+
+	/// @brief Get the value given to new primitives.
+	const T& GetDefaultValue() const { return m_DefaultValue; }
+
+	/// @brief Set the value of every primitive.
+	void Fill(const T& value) { std::fill(m_Values.begin(), m_Values.end(), value); }
+
+private:
+	/// @brief Value of each primitive.
+	std::vector<T> m_Values{};
+	/// @brief Value given to new primitives.
+	T m_DefaultValue{};
+};
+
+/// @brief Set of named attribute channels sharing the same size.
+/// @note Meshes only have a few attributes, so the channels are stored in a vector searched linearly by name. Look a
+/// channel up once and index it in loops, rather than going through its name for each primitive. Copies of the set
+/// share their channels, a channel being copied the first time it is modified (by a non-const Get or Add, Resize,
+/// Permute, Compact or Remap) while shared. A channel got through a non-const Get must not be used after the set is
+/// copied.
+class AttributeChannelSet
+{
+public:
+	/// @brief Default ctor.
+	AttributeChannelSet() = default;
+	~AttributeChannelSet() = default;
+
+	/// @brief Copy ctor, sharing the channels until they are modified.
+	AttributeChannelSet(const AttributeChannelSet& other) = default;
+	/// @brief Copy assignment, sharing the channels until they are modified.
+	AttributeChannelSet& operator=(const AttributeChannelSet& other) = default;
+
+	/// @brief Enable move semantics.
+	AttributeChannelSet(AttributeChannelSet&&) noexcept = default;
+	/// @brief Enable move semantics.
+	AttributeChannelSet& operator=(AttributeChannelSet&&) noexcept = default;
+
+	/// @brief Add a channel, or get the existing one if a channel of the same name and type exists.
+	/// @param name Name of the channel.
+	/// @param size Number of values of the channel (must be the size of the other channels).
+	/// @param defaultValue Value of the existing and new primitives.
+	/// @note A channel of the same name must not exist with another type.
+	template<typename T>
+	AttributeChannel<T>& Add(std::string_view name, size_t size, const T& defaultValue = T{})
+	{
+		if(AttributeChannel<T>* channel = Get<T>(name))
+			return *channel;
+		assert(!Has(name) && "An attribute of the same name but of another type exists");
+
+		auto channel = std::make_shared<AttributeChannel<T>>(size, defaultValue);
+		AttributeChannel<T>& channelRef = *channel;
+		m_Channels.emplace_back(std::string(name), std::move(channel));
+		return channelRef;
+	}
+
+	/// @brief Get a channel, or nullptr if there is no channel of this name and type.
+	template<typename T>
+	AttributeChannel<T>* Get(std::string_view name)
+	{
+		if(std::as_const(*this).template Get<T>(name) == nullptr)
+			return nullptr;
+		return static_cast<AttributeChannel<T>*>(FindToWrite(name));
+	}
+
+	/// @brief Get a channel, or nullptr if there is no channel of this name and type (const version).
+	template<typename T>
+	const AttributeChannel<T>* Get(std::string_view name) const
+	{
+		const BaseAttributeChannel* channel = Find(name);
+		if(channel == nullptr || channel->GetValueType() != typeid(T))
+			return nullptr;
+		return static_cast<const AttributeChannel<T>*>(channel);
+	}
+
+	/// @brief Check if a channel of this name exists.
+	bool Has(std::string_view name) const;
+
+	/// @brief Remove a channel.
+	/// @return True if the channel existed.
+	bool Remove(std::string_view name);
+
+	/// @brief Resize every channel.
+	void Resize(size_t size);
+
+	/// @brief Reorder the values of every channel, the new value i being the old value order[i].
+	void Permute(std::span<const uint32_t> order);
+
+	/// @brief Move each value i of every channel to newIndices[i] and drop the values mapped to -1.
+	void Compact(std::span<const int> newIndices, size_t size);
+
+	/// @brief Rebuild the values of every channel, the new value i being the old value oldIndices[i] (the default
+	/// value for -1).
+	void Remap(std::span<const int> oldIndices);
+
+	/// @brief Remove every channel.
+	void Clear();
+
+	/// @brief Get the number of channels.
+	size_t GetCount() const;
+
+	/// @brief Get the name of each channel, in creation order.
+	std::vector<std::string> GetNames() const;
+
+private:
+	/// @brief Get a channel by name, or nullptr if not found.
+	const BaseAttributeChannel* Find(std::string_view name) const;
+	/// @brief Get a channel by name to modify it, copying it first if it is shared, or nullptr if not found.
+	BaseAttributeChannel* FindToWrite(std::string_view name);
+
+	/// @brief Copy a channel if it is shared with another set, and get it.
+	static BaseAttributeChannel& Detach(std::shared_ptr<BaseAttributeChannel>& channel);
+
+private:
+	/// @brief Channels with their name, in creation order, shared by the copies of the set until they are modified.
+	std::vector<std::pair<std::string, std::shared_ptr<BaseAttributeChannel>>> m_Channels{};
+};
+} // namespace Data::Attribute
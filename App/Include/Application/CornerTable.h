@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Application/AttributeChannel.h"
+#include "Application/Mesh.h"
+#include "Core/BaseType.h"
+
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Data::Surface
+{
+/// @brief Corner table of a triangular mesh, answering next, previous, opposite and vertex queries in O(1).
+/// @note The corner i of triangle t has the index 3 * t + i and is at the vertex Vertices[i] of the triangle. The
+/// opposite corner of a corner is the corner of the neighbor across the edge facing it, or -1 on a boundary. Neighbors
+/// with an inconsistent orientation are not linked, their edge is seen as a boundary by the corner table.
+class CornerTable
+{
+public:
+	/// @brief Index of a corner (3 * triangle index + local index), -1 if there is no corner.
+	using CornerIndex = int;
+
+	/// @brief Value of a missing corner.
+	static constexpr CornerIndex InvalidCorner = -1;
+
+public:
+	/// @brief Build the corner table of a mesh.
+	/// @param mesh The mesh, its connectivity must be up to date.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The opposite corners come from the neighbors of the triangles and their neighbor edge slots (the shared
+	/// edges are searched if the mesh has no slots). The attribute channels share their storage with the mesh until
+	/// either side writes them (see AttributeChannelSet), the extra data are not carried over.
+	static CornerTable FromMesh(const Mesh& mesh, uint32_t threadCount = 0);
+
+	/// @brief Build the mesh of the corner table, with its neighbors, neighbor edge slots and attribute channels.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The attribute channels share their storage with the corner table until either side writes them.
+	Mesh ToMesh(uint32_t threadCount = 0) const;
+
+	/// @brief Get the number of vertices.
+	uint32_t GetVertexCount() const;
+	/// @brief Get the number of triangles.
+	uint32_t GetTriangleCount() const;
+	/// @brief Get the number of corners (3 per triangle).
+	uint32_t GetCornerCount() const;
+
+	/// @brief Get the triangle of a corner.
+	static Core::BaseType::TriangleIndex GetTriangle(CornerIndex corner)
+	{
+		return static_cast<Core::BaseType::TriangleIndex>(corner / 3);
+	}
+	/// @brief Get the next corner in its triangle (counter-clockwise).
+	static CornerIndex GetNext(CornerIndex corner) { return corner % 3 == 2 ? corner - 2 : corner + 1; }
+	/// @brief Get the previous corner in its triangle (clockwise).
+	static CornerIndex GetPrevious(CornerIndex corner) { return corner % 3 == 0 ? corner + 2 : corner - 1; }
+
+	/// @brief Get the vertex of a corner.
+	Core::BaseType::VertexIndex GetVertex(CornerIndex corner) const { return m_CornerVertices[corner]; }
+	/// @brief Get the opposite corner of a corner, or InvalidCorner if the edge facing it is a boundary.
+	CornerIndex GetOpposite(CornerIndex corner) const { return m_OppositeCorners[corner]; }
+	/// @brief Get one corner of a vertex (in its incident triangle), or InvalidCorner if the vertex is isolated.
+	CornerIndex GetVertexCorner(Core::BaseType::VertexIndex index) const { return m_VertexCorners[index]; }
+
+	/// @brief Get the corner at the same vertex in the next triangle around it, counter-clockwise.
+	/// @return The corner, or InvalidCorner if the edge crossed is a boundary.
+	CornerIndex GetSwingCCW(CornerIndex corner) const
+	{
+		const CornerIndex opposite = m_OppositeCorners[GetNext(corner)];
+		return opposite == InvalidCorner ? InvalidCorner : GetNext(opposite);
+	}
+	/// @brief Get the corner at the same vertex in the next triangle around it, clockwise.
+	/// @return The corner, or InvalidCorner if the edge crossed is a boundary.
+	CornerIndex GetSwingCW(CornerIndex corner) const
+	{
+		const CornerIndex opposite = m_OppositeCorners[GetPrevious(corner)];
+		return opposite == InvalidCorner ? InvalidCorner : GetPrevious(opposite);
+	}
+
+	/// @brief Get the position of a vertex.
+	const Core::BaseType::Vec3& GetPosition(Core::BaseType::VertexIndex index) const { return m_Positions[index]; }
+	/// @brief Get the position of each vertex.
+	std::span<Core::BaseType::Vec3> GetPositions();
+	/// @brief Get the position of each vertex.
+	std::span<const Core::BaseType::Vec3> GetPositions() const;
+	/// @brief Get the vertex of each corner.
+	std::span<const Core::BaseType::VertexIndex> GetCornerVertices() const;
+	/// @brief Get the opposite corner of each corner.
+	std::span<const CornerIndex> GetOppositeCorners() const;
+
+	/// @brief Get a vertex attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>* GetVertexAttribute(std::string_view name)
+	{
+		return m_VertexAttributes.Get<T>(name);
+	}
+	/// @brief Get a vertex attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	const Data::Attribute::AttributeChannel<T>* GetVertexAttribute(std::string_view name) const
+	{
+		return m_VertexAttributes.Get<T>(name);
+	}
+	/// @brief Get the vertex attribute channels.
+	Data::Attribute::AttributeChannelSet& GetVertexAttributes();
+	/// @brief Get the vertex attribute channels.
+	const Data::Attribute::AttributeChannelSet& GetVertexAttributes() const;
+
+	/// @brief Get a triangle attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>* GetTriangleAttribute(std::string_view name)
+	{
+		return m_TriangleAttributes.Get<T>(name);
+	}
+	/// @brief Get a triangle attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	const Data::Attribute::AttributeChannel<T>* GetTriangleAttribute(std::string_view name) const
+	{
+		return m_TriangleAttributes.Get<T>(name);
+	}
+	/// @brief Get the triangle attribute channels.
+	Data::Attribute::AttributeChannelSet& GetTriangleAttributes();
+	/// @brief Get the triangle attribute channels.
+	const Data::Attribute::AttributeChannelSet& GetTriangleAttributes() const;
+
+public:
+	/// @brief Circulator over the corners of a vertex, giving its neighbor vertices or triangles.
+	/// @note The order is the one of the mesh circulators: counter-clockwise from the corner of the vertex, then
+	/// clockwise from it if a boundary is reached.
+	template<bool IsVertexCirculator>
+	class AroundVertexCirculator
+	{
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type =
+			std::conditional_t<IsVertexCirculator, Core::BaseType::VertexIndex, Core::BaseType::TriangleIndex>;
+		using difference_type = std::ptrdiff_t;
+
+	public:
+		/// @brief Construct a circulator starting at a corner (the end circulator if the corner is InvalidCorner).
+		AroundVertexCirculator(const CornerTable& table, CornerIndex startCorner)
+			: m_Table(&table)
+			, m_StartCorner(startCorner)
+			, m_CurCorner(startCorner)
+		{}
+
+		/// @brief Equality operator.
+		bool operator==(const AroundVertexCirculator& rhs) const
+		{
+			return m_CurCorner == rhs.m_CurCorner
+				   && (m_CurCorner == InvalidCorner || m_IsInCCWOrder == rhs.m_IsInCCWOrder);
+		}
+
+		/// @brief Pre-increment operator.
+		AroundVertexCirculator& operator++()
+		{
+			if(!m_IsInCCWOrder)
+			{
+				m_CurCorner = m_Table->GetSwingCW(m_CurCorner);
+				return *this;
+			}
+
+			m_CurCorner = m_Table->GetSwingCCW(m_CurCorner);
+			if(m_CurCorner == m_StartCorner)
+			{ // The one-ring is closed.
+				m_CurCorner = InvalidCorner;
+			}
+			else if(m_CurCorner == InvalidCorner)
+			{ // We reached a boundary, the vertices continue from the start corner and the triangles after it.
+				m_IsInCCWOrder = false;
+				m_CurCorner = IsVertexCirculator ? m_StartCorner : m_Table->GetSwingCW(m_StartCorner);
+			}
+			return *this;
+		}
+
+		/// @brief Dereference operator to get the current vertex or triangle index.
+		value_type operator*() const
+		{
+			if constexpr(IsVertexCirculator)
+				return m_Table->GetVertex(m_IsInCCWOrder ? GetPrevious(m_CurCorner) : GetNext(m_CurCorner));
+			else
+				return GetTriangle(m_CurCorner);
+		}
+
+	private:
+		/// @brief Corner table containing the vertex.
+		const CornerTable* m_Table;
+		/// @brief Corner of the vertex where the circulation starts.
+		CornerIndex m_StartCorner;
+		/// @brief Current corner of the vertex.
+		CornerIndex m_CurCorner;
+		/// @brief Whether we are currently circulating in counter-clockwise direction.
+		bool m_IsInCCWOrder{ true };
+	};
+
+	/// @brief Range to iterate over the vertices or the triangles around a vertex.
+	template<bool IsVertexCirculator>
+	class AroundVertexRange
+	{
+	public:
+		/// @brief Construct a range over the corners of a vertex starting at a corner (empty if InvalidCorner).
+		AroundVertexRange(const CornerTable& table, CornerIndex startCorner)
+			: m_Table(table)
+			, m_StartCorner(startCorner)
+		{}
+
+		/// @brief Get the begin circulator.
+		AroundVertexCirculator<IsVertexCirculator> begin() const { return { m_Table, m_StartCorner }; }
+		/// @brief Get the end circulator.
+		AroundVertexCirculator<IsVertexCirculator> end() const { return { m_Table, InvalidCorner }; }
+
+	private:
+		/// @brief Corner table containing the vertex.
+		const CornerTable& m_Table;
+		/// @brief Corner of the vertex where the circulation starts.
+		CornerIndex m_StartCorner;
+	};
+
+	/// @brief Range over the vertices around a vertex.
+	using VerticesAroundVertexRange = AroundVertexRange<true>;
+	/// @brief Range over the triangles around a vertex.
+	using TrianglesAroundVertexRange = AroundVertexRange<false>;
+
+	/// @brief Get a range to iterate over the vertices around a given vertex, in the order of the mesh circulators.
+	VerticesAroundVertexRange GetVerticesAroundVertex(Core::BaseType::VertexIndex index) const;
+	/// @brief Get a range to iterate over the triangles around a given vertex, in the order of the mesh circulators.
+	TrianglesAroundVertexRange GetTrianglesAroundVertex(Core::BaseType::VertexIndex index) const;
+
+private:
+	/// @brief Position of each vertex.
+	std::vector<Core::BaseType::Vec3> m_Positions{};
+	/// @brief Corner of each vertex in its incident triangle, or InvalidCorner.
+	std::vector<CornerIndex> m_VertexCorners{};
+	/// @brief Vertex of each corner.
+	std::vector<Core::BaseType::VertexIndex> m_CornerVertices{};
+	/// @brief Opposite corner of each corner, or InvalidCorner.
+	std::vector<CornerIndex> m_OppositeCorners{};
+
+	/// @brief Attribute channels, with one value per vertex.
+	Data::Attribute::AttributeChannelSet m_VertexAttributes{};
+	/// @brief Attribute channels, with one value per triangle.
+	Data::Attribute::AttributeChannelSet m_TriangleAttributes{};
+};
+} // namespace Data::Surface
@@ -59,6 +59,22 @@ public:
 	std::string GetName() override { return "SmoothVertexNormalExtraData"; }
 };
 
+/// @brief Extra data type to store a vertex color (RGBA, each channel in [0, 1]).
+class VertexColorExtraData : public SingleDataExtraData<Core::BaseType::Vec4>
+{
+public:
+	/// @brief Returns the name of the extra data.
+	std::string GetName() override { return "VertexColorExtraData"; }
+};
+
+/// @brief Extra data type to store a vertex quality (e.g. scanner confidence).
+class VertexQualityExtraData : public SingleDataExtraData<float>
+{
+public:
+	/// @brief Returns the name of the extra data.
+	std::string GetName() override { return "VertexQualityExtraData"; }
+};
+
 /// @brief Extra data type to store vertex flat normals.
 class FlatVertexNormalsExtraData : public SingleDataExtraData<std::vector<Core::BaseType::Vec3>>
 {
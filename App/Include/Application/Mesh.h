@@ -1,18 +1,27 @@
 #pragma once
 
+#include "Application/AttributeChannel.h"
 #include "Application/ExtraDataContainer.h"
 #include "Application/Primitive.h"
 #include "Core/BaseType.h"
+#include "Core/BitArray.h"
+#include "Core/ChunkedCowVector.h"
+#include "Core/CowVector.h"
 
+#include <array>
 #include <memory>
+#include <span>
+#include <string_view>
 #include <vector>
 
 /// Forward declaration
 namespace Utilitary::Surface
 {
+class MeshConnectivity;
 class MeshExporter;
 class MeshIntegrity;
 class MeshLoader;
+class MeshReordering;
 } // namespace Utilitary::Surface
 
 namespace Data::Primitive
@@ -23,27 +32,81 @@ class VertexProxy;
 
 namespace Data::Surface
 {
+class CornerTable;
+class OneRingAdjacency;
+
+/// @brief Old to new index maps of the vertices and triangles compacted by Mesh::GarbageCollect.
+struct CompactionMaps
+{
+	/// @brief New index of each old vertex, -1 if it was removed.
+	std::vector<int> VertexMap{};
+	/// @brief New index of each old triangle, -1 if it was removed.
+	std::vector<int> TriangleMap{};
+	/// @brief New index of each old edge, -1 if it was removed (empty if the edge table is not known).
+	std::vector<int> EdgeMap{};
+};
+
 /// @brief Class representing a 3D triangular mesh.
+/// @note The copies of a mesh share its arrays (vertices, triangles, edges, extra data containers, neighbor edge slots
+/// and each attribute channel), an array being copied the first time one of the meshes modifies it. The const accessors
+/// never copy, so a copy can be read by other threads while the original is edited. References obtained through the
+/// non-const accessors (and the proxies) must not be used after the mesh is copied.
 class Mesh
 {
 public:
+	friend Utilitary::Surface::MeshConnectivity;
 	friend Utilitary::Surface::MeshExporter;
 	friend Utilitary::Surface::MeshIntegrity;
 	friend Utilitary::Surface::MeshLoader;
+	friend Utilitary::Surface::MeshReordering;
 
 	friend Data::Primitive::TriangleProxy;
 	friend Data::Primitive::VertexProxy;
 
+	friend Data::Surface::CornerTable;
+
 public:
 	/// @brief Default ctor.
 	Mesh() = default;
-	/// @brief Copy ctor.
+	/// @brief Construct a mesh from the position of each vertex and the vertex indices of each triangle.
+	/// @param positions Position of each vertex.
+	/// @param triangleVertices Vertex indices of each triangle, in counter-clockwise order.
+	/// @param buildConnectivity If true, build the neighbors, incident triangles and neighbor edge slots.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The vertices and triangles are allocated once and filled in parallel.
+	Mesh(std::span<const Core::BaseType::Vec3> positions,
+		 std::span<const std::array<int, 3>> triangleVertices,
+		 bool buildConnectivity = true,
+		 uint32_t threadCount = 0);
+	/// @brief Construct a mesh taking the ownership of its vertices and triangles, without copying them.
+	/// @param vertices Vertices of the mesh.
+	/// @param triangles Triangles of the mesh.
+	/// @param buildConnectivity If true, build the neighbors, incident triangles and neighbor edge slots. Otherwise the
+	/// given ones are kept, and the neighbor edge slots are not known.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	Mesh(std::vector<Data::Primitive::Vertex>&& vertices,
+		 std::vector<Data::Primitive::Triangle>&& triangles,
+		 bool buildConnectivity = true,
+		 uint32_t threadCount = 0);
+	/// @brief Copy ctor, sharing the arrays of the other mesh until one of them is modified.
 	Mesh(const Mesh& other);
+	/// @brief Copy assignment, sharing the arrays of the other mesh until one of them is modified.
+	Mesh& operator=(const Mesh& other);
+	/// @brief Move ctor.
+	Mesh(Mesh&& other) noexcept = default;
+	/// @brief Move assignment.
+	Mesh& operator=(Mesh&& other) noexcept = default;
 	~Mesh() = default;
 
-	/// @brief Deep clone of the mesh.
+	/// @brief Clone of the mesh, sharing its arrays until one of them is modified.
 	std::unique_ptr<Mesh> Clone() const;
 
+	/// @brief Take an immutable snapshot of the mesh, without copying its arrays.
+	/// @note The snapshot keeps the current version of the mesh: the edits made later on the mesh copy the arrays
+	/// they touch instead of modifying the snapshot, or only the chunks they touch for the vertices and triangles. It
+	/// can be read by other threads while the mesh is edited.
+	std::shared_ptr<const Mesh> CreateSnapshot() const;
+
 	/// @brief Get the number of vertices in the mesh.
 	uint32_t GetVertexCount() const;
 
@@ -56,35 +119,199 @@ public:
 	Data::Primitive::TriangleProxy GetTriangle(const Core::BaseType::TriangleIndex index);
 
 	/// @brief Get the vertex data at the given index.
+	/// @note Only the chunk of the vertex is copied if it is shared with another mesh.
 	Data::Primitive::Vertex& GetVertexData(const Core::BaseType::VertexIndex index);
 	/// @brief Get the vertex data at the given index.
 	const Data::Primitive::Vertex& GetVertexData(const Core::BaseType::VertexIndex index) const;
 	/// @brief Get the triangle data at the given index.
-	Data::Primitive::Triangle& GetTriangleData(const Core::BaseType::TriangleIndex index);
-	/// @brief Get the triangle data at the given index.
 	const Data::Primitive::Triangle& GetTriangleData(const Core::BaseType::TriangleIndex index) const;
+	/// @brief Set the triangle data at the given index.
+	/// @note The neighbor edge slots, the edge table and the one-ring adjacency are dropped. Only the chunk of the
+	/// triangle is copied if it is shared with another mesh.
+	void SetTriangleData(const Core::BaseType::TriangleIndex index, const Data::Primitive::Triangle& triangle);
+
+	/// @brief Reserve the memory of the vertices and triangles, before adding them one by one.
+	/// @note The vertices and triangles are stored in chunks, which are allocated as they are filled: only their
+	/// table is reserved.
+	/// @param vertexCount Total number of vertices expected.
+	/// @param triangleCount Total number of triangles expected.
+	void Reserve(size_t vertexCount, size_t triangleCount);
 
 	/// @brief Add a vertex to the mesh and return its index.
 	Core::BaseType::VertexIndex AddVertex(const Data::Primitive::Vertex& vertex);
 	/// @brief Add a triangle to the mesh and return its index.
+	/// @note If the edge table is known, it is updated in constant time: the edges shared with the neighbors given in
+	/// the triangle are reused, the other ones are added.
 	Core::BaseType::TriangleIndex AddTriangle(const Data::Primitive::Triangle& triangle);
 
+	/// @brief Mark a vertex as deleted, in constant time.
+	/// @note The vertex and the triangles using it are removed by the next GarbageCollect. Until then, they keep their
+	/// index and data, and are still counted and referenced by the connectivity.
+	void DeleteVertex(const Core::BaseType::VertexIndex index);
+	/// @brief Mark a triangle as deleted, in constant time.
+	/// @note The triangle is removed by the next GarbageCollect, its neighbors then having a boundary edge instead.
+	void DeleteTriangle(const Core::BaseType::TriangleIndex index);
+	/// @brief Check if a vertex is marked as deleted.
+	bool IsVertexDeleted(const Core::BaseType::VertexIndex index) const;
+	/// @brief Check if a triangle is marked as deleted.
+	bool IsTriangleDeleted(const Core::BaseType::TriangleIndex index) const;
+	/// @brief Get the number of vertices marked as deleted.
+	size_t GetDeletedVertexCount() const;
+	/// @brief Get the number of triangles marked as deleted.
+	size_t GetDeletedTriangleCount() const;
+	/// @brief Check if some vertices or triangles are marked as deleted.
+	bool HasGarbage() const;
+
+	/// @brief Remove the deleted vertices and triangles, and the triangles using a deleted vertex.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The kept elements keep their relative order. The arrays are compacted in place and in parallel, and the
+	/// vertices, neighbors, incident triangles, neighbor edge slots, edges, extra data, attributes and dirty vertices
+	/// are remapped. A vertex whose incident triangle is removed gets its first remaining triangle, or -1 if it is
+	/// left isolated. The edges left without triangle are removed, an edge whose triangle is removed gets its first
+	/// remaining triangle. The one-ring adjacency cache is dropped.
+	/// @return New index of each old vertex, triangle and edge.
+	CompactionMaps GarbageCollect(uint32_t threadCount = 0);
+
 	/// @brief Add extra data container for each vertex.
 	void AddVerticesExtraDataContainer();
 	/// @brief Add extra data container for each triangle.
 	void AddTrianglesExtraDataContainer();
 
+	/// @brief Add an attribute channel storing one value per vertex, or get the existing one of the same name.
+	/// @param name Name of the attribute.
+	/// @param defaultValue Value of the existing vertices and of the vertices added later.
+	/// @note The channel grows with AddVertex. An attribute of the same name must not exist with another type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>& AddVertexAttribute(std::string_view name, const T& defaultValue = T{})
+	{
+		return m_VertexAttributes.Add<T>(name, m_Vertices.size(), defaultValue);
+	}
+	/// @brief Get a vertex attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>* GetVertexAttribute(std::string_view name)
+	{
+		return m_VertexAttributes.Get<T>(name);
+	}
+	/// @brief Get a vertex attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	const Data::Attribute::AttributeChannel<T>* GetVertexAttribute(std::string_view name) const
+	{
+		return m_VertexAttributes.Get<T>(name);
+	}
+	/// @brief Check if the mesh has a vertex attribute of this name.
+	bool HasVertexAttribute(std::string_view name) const;
+	/// @brief Remove a vertex attribute.
+	void RemoveVertexAttribute(std::string_view name);
+	/// @brief Get the vertex attribute channels.
+	const Data::Attribute::AttributeChannelSet& GetVertexAttributes() const;
+
+	/// @brief Add an attribute channel storing one value per triangle, or get the existing one of the same name.
+	/// @param name Name of the attribute.
+	/// @param defaultValue Value of the existing triangles and of the triangles added later.
+	/// @note The channel grows with AddTriangle. An attribute of the same name must not exist with another type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>& AddTriangleAttribute(std::string_view name, const T& defaultValue = T{})
+	{
+		return m_TriangleAttributes.Add<T>(name, m_Triangles.size(), defaultValue);
+	}
+	/// @brief Get a triangle attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>* GetTriangleAttribute(std::string_view name)
+	{
+		return m_TriangleAttributes.Get<T>(name);
+	}
+	/// @brief Get a triangle attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	const Data::Attribute::AttributeChannel<T>* GetTriangleAttribute(std::string_view name) const
+	{
+		return m_TriangleAttributes.Get<T>(name);
+	}
+	/// @brief Check if the mesh has a triangle attribute of this name.
+	bool HasTriangleAttribute(std::string_view name) const;
+	/// @brief Remove a triangle attribute.
+	void RemoveTriangleAttribute(std::string_view name);
+	/// @brief Get the triangle attribute channels.
+	const Data::Attribute::AttributeChannelSet& GetTriangleAttributes() const;
+
+	/// @brief Add an attribute channel storing one value per edge, or get the existing one of the same name.
+	/// @param name Name of the attribute.
+	/// @param defaultValue Value of the existing edges and of the edges added later.
+	/// @note The channel follows the edge table (see GetEdges). An attribute of the same name must not exist with
+	/// another type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>& AddEdgeAttribute(std::string_view name, const T& defaultValue = T{})
+	{
+		return m_EdgeAttributes.Add<T>(name, m_Edges.size(), defaultValue);
+	}
+	/// @brief Get an edge attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	Data::Attribute::AttributeChannel<T>* GetEdgeAttribute(std::string_view name)
+	{
+		return m_EdgeAttributes.Get<T>(name);
+	}
+	/// @brief Get an edge attribute channel, or nullptr if there is no attribute of this name and type.
+	template<typename T>
+	const Data::Attribute::AttributeChannel<T>* GetEdgeAttribute(std::string_view name) const
+	{
+		return m_EdgeAttributes.Get<T>(name);
+	}
+	/// @brief Check if the mesh has an edge attribute of this name.
+	bool HasEdgeAttribute(std::string_view name) const;
+	/// @brief Remove an edge attribute.
+	void RemoveEdgeAttribute(std::string_view name);
+	/// @brief Get the edge attribute channels.
+	const Data::Attribute::AttributeChannelSet& GetEdgeAttributes() const;
+
 	/// @brief Update neighbor informations on each triangle and incident triangle for each vertex.
+	/// @note The neighbor edge slots and the edge table are updated too.
 	void UpdateMeshConnectivity();
 
-	/// @brief Get the vertices data.
-	std::vector<Data::Primitive::Vertex>& GetVertices();
-	/// @brief Get the vertices data.
-	const std::vector<Data::Primitive::Vertex>& GetVertices() const;
-	/// @brief Get the triangles data.
-	std::vector<Data::Primitive::Triangle>& GetTriangles();
-	/// @brief Get the triangles data.
-	const std::vector<Data::Primitive::Triangle>& GetTriangles() const;
+	/// @brief Check if the neighbor edge slots of the triangles are known.
+	/// @note They are set by UpdateMeshConnectivity and the loaders, and dropped by AddTriangle and the triangle edits
+	/// (SetTriangleData, EditTriangles and TriangleProxy::SetTriangle). The circulators use them to cross edges without
+	/// vertex comparison when they are known.
+	bool HasNeighborEdgeSlots() const;
+	/// @brief Get the neighbor edge slots of each triangle, empty if they are not known.
+	const std::vector<Data::Primitive::NeighborEdgeSlots>& GetNeighborEdgeSlots() const;
+
+	/// @brief Check if the edge table of the mesh is known.
+	/// @note It is not known until the connectivity is built (see UpdateMeshConnectivity), even for an empty mesh. It
+	/// is then kept up to date by AddTriangle, GarbageCollect and MeshReordering, and copied with the mesh. Like the
+	/// neighbor edge slots, it is dropped by the triangle edits, with the values of the edge attributes (their channels
+	/// are kept). It is not stored in the binary files: a mesh loaded by MeshLoader::LoadBinary needs
+	/// UpdateMeshConnectivity first.
+	bool HasEdges() const;
+	/// @brief Get the number of edges, 0 if the edge table is not known.
+	uint32_t GetEdgeCount() const;
+	/// @brief Get the edges of the mesh, empty if the edge table is not known.
+	/// @note Built by UpdateMeshConnectivity, they are sorted by vertex indices. An edge is shared by all the
+	/// triangles containing it, so a pass over the edges visits each of them once.
+	const std::vector<Data::Primitive::Edge>& GetEdges() const;
+	/// @brief Get the index of the edges of each triangle, empty if the edge table is not known.
+	/// @note The edge i of a triangle is opposite to Vertices[i], like Neighbors[i].
+	const std::vector<std::array<int, 3>>& GetTriangleEdges() const;
+
+	/// @brief Build the one-ring adjacency of the vertices if it is not cached, and get it.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The connectivity must be up to date. The cache is dropped by AddVertex, AddTriangle,
+	/// UpdateMeshConnectivity and the triangle edits (SetTriangleData, EditTriangles and TriangleProxy::SetTriangle),
+	/// and shared by the copies of the mesh.
+	const OneRingAdjacency& BuildOneRingAdjacency(uint32_t threadCount = 0);
+	/// @brief Get the cached one-ring adjacency of the vertices, or nullptr if it is not built.
+	const OneRingAdjacency* GetOneRingAdjacency() const;
+
+	/// @brief Get the vertices data to modify them.
+	/// @note The chunk of a vertex is copied on its first write if it is shared with another mesh, the other chunks are
+	/// left as they are.
+	Core::Container::ChunkedWriteSpan<Data::Primitive::Vertex> GetVertices();
+	/// @brief Get the vertices data, stored in chunks shared with the copies of the mesh.
+	const Core::Container::ChunkedCowVector<Data::Primitive::Vertex>& GetVertices() const;
+	/// @brief Get the triangles data, stored in chunks shared with the copies of the mesh.
+	const Core::Container::ChunkedCowVector<Data::Primitive::Triangle>& GetTriangles() const;
+	/// @brief Get the triangles data to modify them.
+	/// @note The chunk of a triangle is copied on its first write if it is shared with another mesh. The neighbor edge
+	/// slots, the edge table and the one-ring adjacency are dropped.
+	Core::Container::ChunkedWriteSpan<Data::Primitive::Triangle> EditTriangles();
 
 	/// @brief Check if the mesh has extra data containers for vertices.
 	bool HasVerticesExtraDataContainer() const;
@@ -98,10 +325,30 @@ public:
 
 	/// @brief Compute smooth normal for each vertex of the mesh.
 	/// @param normalize If true, compute normalized smooth vertex normals.
-	/// @note The computed normals are stored as extra data on each vertex.
+	/// @note The triangle normals are weighted by their angle at the vertex (see MeshNormals for other weightings).
+	/// If every triangle has a stored normal (see ComputeTriangleNormals, or the normals loaded from a file), it is
+	/// used instead of the one of the positions. The computed normals are stored as extra data on each vertex.
 	void ComputeSmoothVertexNormals(bool normalize = false);
 
+	/// @brief Set the position of a vertex and mark it as dirty.
+	void SetVertexPosition(const Core::BaseType::VertexIndex index, const Core::BaseType::Vec3& position);
+	/// @brief Mark a vertex as dirty, after modifying its position directly (e.g. through VertexProxy::GetPosition).
+	void MarkVertexDirty(const Core::BaseType::VertexIndex index);
+	/// @brief Get the vertices moved since the last normal update, in marking order.
+	const std::vector<Core::BaseType::VertexIndex>& GetDirtyVertices() const;
+	/// @brief Unmark the dirty vertices without updating the normals.
+	void ClearDirtyVertices();
+
+	/// @brief Update the normals around the dirty vertices, then unmark them.
+	/// @param normalize If true, compute normalized normals.
+	/// @note Only the triangles around the dirty vertices and the vertices of these triangles are updated, all the
+	/// fans of a non-manifold vertex included: they are found by a pass over the triangle corners (see MeshNormals),
+	/// then only their normals are computed. A triangle normal is updated if the triangle has one (see
+	/// ComputeTriangleNormals), a smooth vertex normal if the vertex has one (see ComputeSmoothVertexNormals).
+	void UpdateDirtyNormals(bool normalize = false);
+
 	/// @brief Update the boundary status stored on each vertex as an extra data (true = boundary vertex, false = interrior vertex)
+	/// @note See MeshBoundary to get the boundary as bitsets and loops without extra data.
 	void UpdateVerticesBoundaryStatus();
 
 public:
@@ -139,6 +386,10 @@ public:
 		void SetIsActive(bool value);
 
 	private:
+		/// @brief Move to the next triangle in counter-clockwise direction (-1 if there is none).
+		void MoveInCCWOrder();
+		/// @brief Move to the next triangle in clock-wise direction (-1 if there is none).
+		void MoveInCWOrder();
 		/// @brief Update the current vertex index in counter-clock-wise direction.
 		void UpdateCurVertexIndexInCCWOrder();
 		/// @brief Update the current vertex index in clock-wise direction.
@@ -150,11 +401,15 @@ public:
 
 		/// @brief Index of the central vertex around which we circulate.
 		Core::BaseType::VertexIndex m_CentralVertexIdx;
+		/// @brief Neighbor edge slots of the mesh, or nullptr if they are not known.
+		const Data::Primitive::NeighborEdgeSlots* m_NeighborEdgeSlots;
 
 		/// @brief Current triangle index in the circulation.
 		int m_CurTriangleIdx;
 		/// @brief Previous triangle index in the circulation.
 		int m_PrevTriangleIdx;
+		/// @brief Local index of the central vertex in the current triangle.
+		Core::BaseType::EdgeIndex m_CentralVertexLocalIdx;
 
 		/// @brief Current vertex local index in the current triangle.
 		Core::BaseType::EdgeIndex m_CurVertexLocalIdx;
@@ -232,17 +487,27 @@ public:
 		/// @brief Set whether the circulator is active or not.
 		void SetIsActive(bool value);
 
+	private:
+		/// @brief Move to the next triangle in counter-clockwise direction (-1 if there is none).
+		void MoveInCCWOrder();
+		/// @brief Move to the next triangle in clock-wise direction (-1 if there is none).
+		void MoveInCWOrder();
+
 	private:
 		/// @brief Reference to the mesh.
 		const Mesh& m_Mesh;
 
 		/// @brief Index of the central vertex around which we circulate.
 		Core::BaseType::VertexIndex m_CentralVertexIdx;
+		/// @brief Neighbor edge slots of the mesh, or nullptr if they are not known.
+		const Data::Primitive::NeighborEdgeSlots* m_NeighborEdgeSlots;
 
 		/// @brief Current triangle index in the circulation.
 		int m_CurTriangleIdx;
 		/// @brief Previous triangle index in the circulation.
 		int m_PrevTriangleIdx;
+		/// @brief Local index of the central vertex in the current triangle.
+		Core::BaseType::EdgeIndex m_CentralVertexLocalIdx;
 
 		/// @brief Number of jumps made in the circulation (used to detect boundaries).
 		uint8_t m_JumpCount{ 0 };
@@ -283,14 +548,59 @@ public:
 	TrianglesAroundVertexRange GetTrianglesAroundVertex(const Core::BaseType::VertexIndex index) const;
 
 private:
-	/// @brief List of vertices.
-	std::vector<Data::Primitive::Vertex> m_Vertices{};
-	/// @brief List of triangles.
-	std::vector<Data::Primitive::Triangle> m_Triangles{};
+	/// @brief Drop the data derived from the triangles, before they are edited.
+	void OnTrianglesEdited();
+	/// @brief Add the edges of a triangle about to be added to the edge table.
+	void AddTriangleEdges(const Data::Primitive::Triangle& triangle);
+	/// @brief Remove the edges of the edge table left without triangle, the triangles being compacted.
+	/// @param maps Compaction maps of the vertices and triangles, the one of the edges is filled.
+	/// @param triangleRangeCount Number of ranges of triangles processed in parallel.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	void CompactEdges(CompactionMaps& maps, uint32_t triangleRangeCount, uint32_t threadCount);
+
+private:
+	/// @brief List of vertices, copied per chunk on write.
+	Core::Container::ChunkedCowVector<Data::Primitive::Vertex> m_Vertices{};
+	/// @brief List of triangles, copied per chunk on write.
+	Core::Container::ChunkedCowVector<Data::Primitive::Triangle> m_Triangles{};
 
 	/// @brief Extra data containers for each vertex.
-	std::vector<Data::ExtraData::ExtraDataContainer> m_VerticesExtraDataContainer{};
+	Core::Container::CowVector<Data::ExtraData::ExtraDataContainer> m_VerticesExtraDataContainer{};
 	/// @brief Extra data containers for each triangle.
-	std::vector<Data::ExtraData::ExtraDataContainer> m_TrianglesExtraDataContainer{};
+	Core::Container::CowVector<Data::ExtraData::ExtraDataContainer> m_TrianglesExtraDataContainer{};
+
+	/// @brief Attribute channels, with one value per vertex.
+	Data::Attribute::AttributeChannelSet m_VertexAttributes{};
+	/// @brief Attribute channels, with one value per triangle.
+	Data::Attribute::AttributeChannelSet m_TriangleAttributes{};
+	/// @brief Attribute channels, with one value per edge.
+	Data::Attribute::AttributeChannelSet m_EdgeAttributes{};
+
+	/// @brief Index of each shared edge in the neighbors of each triangle, empty if not known.
+	Core::Container::CowVector<Data::Primitive::NeighborEdgeSlots> m_NeighborEdgeSlots{};
+
+	/// @brief Edges of the mesh, empty if not known.
+	Core::Container::CowVector<Data::Primitive::Edge> m_Edges{};
+	/// @brief Index of the edges of each triangle, empty if not known.
+	Core::Container::CowVector<std::array<int, 3>> m_TriangleEdges{};
+	/// @brief Whether the edge table was built (see MeshConnectivity::Build), and so is kept up to date.
+	bool m_HasEdges{ false };
+
+	/// @brief Cached one-ring adjacency, immutable so that copies of the mesh can share it.
+	std::shared_ptr<const OneRingAdjacency> m_OneRingAdjacency{};
+
+	/// @brief Vertices moved since the last normal update, in marking order.
+	Core::Container::CowVector<Core::BaseType::VertexIndex> m_DirtyVertices{};
+	/// @brief Whether each vertex is in m_DirtyVertices (sized on the first marking).
+	Core::Container::CowVector<bool> m_IsVertexDirty{};
+
+	/// @brief Whether each vertex is deleted (sized on the first deletion).
+	Core::Container::BitArray m_IsVertexDeleted{};
+	/// @brief Whether each triangle is deleted (sized on the first deletion).
+	Core::Container::BitArray m_IsTriangleDeleted{};
+	/// @brief Number of vertices marked as deleted.
+	size_t m_DeletedVertexCount{ 0 };
+	/// @brief Number of triangles marked as deleted.
+	size_t m_DeletedTriangleCount{ 0 };
 };
 } // namespace Data::Surface
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Application/Primitive.h"
+#include "Core/BaseType.h"
+#include "Core/MappedFile.h"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+/// @brief Layout of the native binary mesh file.
+/// @note A file is made of a FileHeader, a table of ChunkEntry, then the chunk data. Each chunk stores a raw array
+/// (little-endian) starting on a ChunkAlignment boundary, so it can be used in place once the file is mapped.
+namespace Utilitary::Surface::BinaryFormat
+{
+/// @brief Magic bytes at the beginning of the file.
+constexpr std::array<char, 8> Magic{ 'M', 'T', 'B', 'M', 'E', 'S', 'H', '\0' };
+/// @brief Extension of the native binary mesh files.
+constexpr std::string_view FileExtension{ ".mtbmesh" };
+/// @brief Current version of the format.
+constexpr uint32_t CurrentVersion = 1;
+/// @brief Alignment (in bytes) of each chunk in the file.
+constexpr uint64_t ChunkAlignment = 64;
+
+/// @brief Type of data stored in a chunk.
+enum struct ChunkType : uint32_t
+{
+	/// @brief Array of Data::Primitive::Vertex (with IncidentTriangleIdx).
+	Vertices = 1,
+	/// @brief Array of Data::Primitive::Triangle (with Neighbors).
+	Triangles,
+	/// @brief Array of Vec3, one normal per triangle.
+	TriangleNormals,
+	/// @brief Array of std::array<Vec2, 3>, texture coordinates for each vertex of a triangle.
+	TriangleTexCoords,
+	/// @brief Array of Vec3, one smooth normal per vertex.
+	SmoothVertexNormals,
+};
+
+/// @brief Header at the beginning of the file.
+struct FileHeader
+{
+	/// @brief Magic bytes.
+	std::array<char, 8> FileMagic{ Magic };
+	/// @brief Version of the format used to write the file.
+	uint32_t Version{ CurrentVersion };
+	/// @brief Size of the header (in bytes).
+	uint32_t HeaderSize{ sizeof(FileHeader) };
+	/// @brief Number of vertices of the mesh.
+	uint64_t VertexCount{ 0 };
+	/// @brief Number of triangles of the mesh.
+	uint64_t TriangleCount{ 0 };
+	/// @brief Number of entries in the chunk table.
+	uint32_t ChunkCount{ 0 };
+	/// @brief Reserved for future use.
+	uint32_t Reserved{ 0 };
+	/// @brief Offset (in bytes) of the chunk table from the beginning of the file.
+	uint64_t ChunkTableOffset{ 0 };
+};
+
+/// @brief Entry of the chunk table, describing one chunk of the file.
+struct ChunkEntry
+{
+	/// @brief Type of data stored in the chunk.
+	ChunkType Type{ ChunkType::Vertices };
+	/// @brief Size of one element (in bytes).
+	uint32_t ElementSize{ 0 };
+	/// @brief Number of elements in the chunk.
+	uint64_t ElementCount{ 0 };
+	/// @brief Offset (in bytes) of the chunk data from the beginning of the file.
+	uint64_t Offset{ 0 };
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader> && sizeof(FileHeader) == 48);
+static_assert(std::is_trivially_copyable_v<ChunkEntry> && sizeof(ChunkEntry) == 24);
+static_assert(std::is_trivially_copyable_v<Data::Primitive::Vertex> && sizeof(Data::Primitive::Vertex) == 16);
+static_assert(std::is_trivially_copyable_v<Data::Primitive::Triangle> && sizeof(Data::Primitive::Triangle) == 24);
+} // namespace Utilitary::Surface::BinaryFormat
+
+namespace Utilitary::Surface
+{
+/// @brief Read-only view on a native binary mesh file mapped in memory.
+/// @note The arrays are used in place: no parsing nor copy is done, and the connectivity stored in the file is
+/// available as is. The spans are valid as long as the view is alive.
+class BinaryMeshView
+{
+public:
+	/// @brief Map a native binary mesh file.
+	/// @param filepath Path to the file.
+	/// @return Pointer to the view, or nullptr if the file can't be opened or is not a valid binary mesh file.
+	/// @note The vertex and triangle indices of the connectivity are checked to be in range.
+	static std::unique_ptr<BinaryMeshView> Open(const std::filesystem::path& filepath);
+
+	/// @brief Get the number of vertices in the mesh.
+	uint32_t GetVertexCount() const;
+	/// @brief Get the number of triangles in the mesh.
+	uint32_t GetTriangleCount() const;
+
+	/// @brief Get the vertices data.
+	std::span<const Data::Primitive::Vertex> GetVertices() const;
+	/// @brief Get the triangles data.
+	std::span<const Data::Primitive::Triangle> GetTriangles() const;
+
+	/// @brief Get the normal of each triangle (empty if not stored in the file).
+	std::span<const Core::BaseType::Vec3> GetTriangleNormals() const;
+	/// @brief Get the texture coordinates of each triangle (empty if not stored in the file).
+	std::span<const std::array<Core::BaseType::Vec2, 3>> GetTriangleTexCoords() const;
+	/// @brief Get the smooth normal of each vertex (empty if not stored in the file).
+	std::span<const Core::BaseType::Vec3> GetSmoothVertexNormals() const;
+
+	/// @brief Get the size of the mapped file (in bytes).
+	size_t GetFileSize() const;
+
+private:
+	/// @brief Construct a view on a mapped file.
+	explicit BinaryMeshView(Core::IO::MappedFile&& file);
+
+	/// @brief Get the chunk of the given type as an array of T (empty if there is no such chunk).
+	template<typename T>
+	std::span<const T> GetChunk(BinaryFormat::ChunkType type) const;
+
+private:
+	/// @brief Mapped file.
+	Core::IO::MappedFile m_File;
+	/// @brief Header of the file.
+	const BinaryFormat::FileHeader* m_Header{ nullptr };
+	/// @brief Chunk table of the file.
+	std::span<const BinaryFormat::ChunkEntry> m_Chunks{};
+};
+} // namespace Utilitary::Surface
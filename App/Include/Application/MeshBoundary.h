@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/Primitive.h"
+#include "Core/BaseType.h"
+#include "Core/ChunkedCowVector.h"
+#include "Core/BitArray.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Boundary of a mesh: its boundary vertices and edges, and the loops they form.
+struct BoundaryReport
+{
+	/// @brief One bit per vertex, set if the vertex is on a boundary edge.
+	Core::Container::BitArray BoundaryVertices{};
+	/// @brief One bit per half-edge (3 * triangle index + edge index), set if the triangle has no neighbor across it.
+	Core::Container::BitArray BoundaryEdges{};
+	/// @brief Vertices of every loop, one loop after the other.
+	std::vector<Core::BaseType::VertexIndex> LoopVertices{};
+	/// @brief Offset of each loop in LoopVertices, followed by the size of LoopVertices.
+	std::vector<uint32_t> LoopOffsets{ 0 };
+
+	/// @brief Check if a vertex is on a boundary edge.
+	bool IsBoundaryVertex(Core::BaseType::VertexIndex vertexIdx) const;
+	/// @brief Check if the edge of a triangle (opposite to the vertex of the same local index) is a boundary edge.
+	bool IsBoundaryEdge(Core::BaseType::TriangleIndex triangleIdx, Core::BaseType::EdgeIndex edgeIdx) const;
+
+	/// @brief Get the number of boundary loops.
+	size_t GetLoopCount() const;
+	/// @brief Get the vertices of a boundary loop, in the order of the triangles orientation.
+	std::span<const Core::BaseType::VertexIndex> GetLoop(size_t loopIdx) const;
+};
+
+/// @brief Struct for finding the boundary of a mesh.
+struct MeshBoundary
+{
+	/// @brief Find the boundary edges and vertices of a mesh, and extract its boundary loops.
+	/// @param vertexCount Number of vertices of the mesh.
+	/// @param triangles Triangles of the mesh, with up to date neighbors.
+	/// @param extractLoops If false, only the boundary edges and vertices are computed.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @param neighborEdgeSlots Neighbor edge slots of the triangles used to cross the interior edges, or empty.
+	/// @note Boundary edges are found in parallel, each thread filling its own words of the edge bitset. A loop is
+	/// extracted by walking from a boundary edge to the next one around its end vertex, crossing the interior edges of
+	/// the triangle fan. A vertex shared by several fans (e.g. two holes touching at a vertex) is visited once per
+	/// loop. A walk stopped by an inconsistent connectivity gives an open chain of vertices.
+	/// @return Boundary of the mesh.
+	static BoundaryReport Analyze(size_t vertexCount,
+								  Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+								  bool extractLoops = true,
+								  uint32_t threadCount = 0,
+								  std::span<const Data::Primitive::NeighborEdgeSlots> neighborEdgeSlots = {});
+
+	/// @brief Find the boundary edges and vertices of a mesh, and extract its boundary loops.
+	/// @param mesh The mesh, with up to date connectivity.
+	/// @param extractLoops If false, only the boundary edges and vertices are computed.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @return Boundary of the mesh.
+	static BoundaryReport Analyze(const Data::Surface::Mesh& mesh, bool extractLoops = true, uint32_t threadCount = 0);
+};
+} // namespace Utilitary::Surface
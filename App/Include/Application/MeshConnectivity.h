@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/Primitive.h"
+#include "Application/VertexPair.h"
+#include "Core/ChunkedCowVector.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Summary of the edges found while building the connectivity of a mesh.
+struct ConnectivityReport
+{
+	/// @brief Number of edges shared by exactly two triangles.
+	uint64_t InteriorEdgeCount{ 0 };
+	/// @brief Number of edges used by a single triangle.
+	uint64_t BoundaryEdgeCount{ 0 };
+	/// @brief Edges shared by more than two triangles, sorted by vertex indices.
+	/// @note The triangles around these edges are left without neighbor across them.
+	std::vector<Data::Primitive::VertexPair> NonManifoldEdges;
+
+	/// @brief Check if every edge is shared by at most two triangles.
+	bool IsManifold() const;
+};
+
+/// @brief Struct for building the neighbor and incident triangle informations of a mesh.
+struct MeshConnectivity
+{
+	/// @brief Set the neighbors of each triangle and the incident triangle of each vertex.
+	/// @param vertices Vertices of the mesh, their incident triangle is set to the first triangle using them (or -1).
+	/// @param triangles Triangles of the mesh, their neighbors are rebuilt from their vertices.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @param neighborEdgeSlots If not empty, one per triangle, set to the index of each edge in the neighbor across it
+	/// (see NeighborEdgeSlots).
+	/// @param triangleEdges If not empty, one per triangle, set to the index in edges of each edge of the triangle
+	/// (edge i being opposite to vertex i).
+	/// @param edges If not null, set to the edges of the mesh, sorted by vertex indices. The triangle of an edge is the
+	/// first one containing it. A non-manifold edge is a single edge, shared by all its triangles.
+	/// @note Each undirected edge is packed into a 64-bit key (min vertex, max vertex). The keys of all the
+	/// half-edges are radix sorted in parallel, then each run of equal keys gives the triangles sharing the edge.
+	/// @return Summary of the edges of the mesh.
+	static ConnectivityReport Build(Core::Container::ChunkedSpan<Data::Primitive::Vertex> vertices,
+									Core::Container::ChunkedSpan<Data::Primitive::Triangle> triangles,
+									uint32_t threadCount = 0,
+									std::span<Data::Primitive::NeighborEdgeSlots> neighborEdgeSlots = {},
+									std::span<std::array<int, 3>> triangleEdges = {},
+									std::vector<Data::Primitive::Edge>* edges = nullptr);
+
+	/// @brief Set the neighbor edge slots of each triangle from its neighbors.
+	/// @param triangles Triangles of the mesh, with up to date neighbors.
+	/// @param neighborEdgeSlots One per triangle, set to the index of each edge in the neighbor across it.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note Used when the neighbors are known without the half-edges being matched (e.g. loaded from a file). A
+	/// neighbor not sharing the edge in the opposite direction is left with NoEdge in the slots.
+	static void BuildNeighborEdgeSlots(Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+									   std::span<Data::Primitive::NeighborEdgeSlots> neighborEdgeSlots,
+									   uint32_t threadCount = 0);
+
+	/// @brief Set the neighbors of each triangle, their neighbor edge slots, the incident triangle of each vertex and
+	/// the edge table.
+	/// @param mesh The mesh to update.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The edge attribute values follow the edges found again in the previous edge table (see Mesh::GetEdges),
+	/// the new edges get the default value.
+	/// @return Summary of the edges of the mesh.
+	static ConnectivityReport Build(Data::Surface::Mesh& mesh, uint32_t threadCount = 0);
+};
+} // namespace Utilitary::Surface
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Application/Mesh.h"
+#include "Application/PLYFormat.h"
 #include "Core/BaseType.h"
 
 #include <cstdint>
@@ -14,13 +15,42 @@ struct MeshExporter
 	/// @brief Export mesh to an OFF file.
 	/// @param mesh Mesh to export.
 	/// @param filepath Path of the file to which the mesh is exported.
-	/// @note This function assumes the mesh has a valid integrity.
-	static void ExportOFF(const Data::Surface::Mesh& mesh, const std::filesystem::path& filepath);
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note This function assumes the mesh has a valid integrity. The face indices are 0-based, as read by
+	/// MeshLoader::LoadOFF.
+	/// @note The records are formatted in parallel with the shortest floats reading back to the same values (see
+	/// Core::Format::AppendNumber), and written in order: the file does not depend on the thread count.
+	static void ExportOFF(const Data::Surface::Mesh& mesh,
+						  const std::filesystem::path& filepath,
+						  uint32_t threadCount = 0);
 
 	/// @brief Export mesh to an OBJ file.
 	/// @param mesh Mesh to export.
 	/// @param filepath Path of the file to which the mesh is exported.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
 	/// @note This function assumes the mesh has a valid integrity.
-	static void ExportOBJ(const Data::Surface::Mesh& mesh, const std::filesystem::path& filepath);
+	/// @note The texture coordinates and triangle normals are written once each, in order of first appearance. The
+	/// records are formatted in parallel like in ExportOFF.
+	static void ExportOBJ(const Data::Surface::Mesh& mesh,
+						  const std::filesystem::path& filepath,
+						  uint32_t threadCount = 0);
+
+	/// @brief Export mesh to a PLY file.
+	/// @param mesh Mesh to export.
+	/// @param filepath Path of the file to which the mesh is exported.
+	/// @param encoding Encoding of the records.
+	/// @note The smooth vertex normals, vertex colors and vertex qualities are written as vertex properties when
+	/// every vertex has them. ASCII floats are written in the shortest form reading back to the same value.
+	static void ExportPLY(
+		const Data::Surface::Mesh& mesh,
+		const std::filesystem::path& filepath,
+		PLYFormat::Encoding encoding = PLYFormat::Encoding::BinaryLittleEndian);
+
+	/// @brief Export mesh to a native binary file (see BinaryFormat).
+	/// @param mesh Mesh to export.
+	/// @param filepath Path of the file to which the mesh is exported.
+	/// @note Vertices and triangles are written with their connectivity, along with the triangle normals, triangle
+	/// texture coordinates and smooth vertex normals when every primitive has them.
+	static void ExportBinary(const Data::Surface::Mesh& mesh, const std::filesystem::path& filepath);
 };
 } // namespace Utilitary::Surface
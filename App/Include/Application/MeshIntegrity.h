@@ -22,10 +22,15 @@ struct MeshIntegrity
 		InvalidVertexIndex,
 		InvalidIncidentTriangleIndex,
 		InvalidNeighborTriangleIndex,
+		NeighborEdgeSlotMismatch,
+		EdgeTableMismatch,
 	};
 
 	/// @brief Check the integrity of the mesh.
 	/// @param mesh The mesh to check.
+	/// @note If the mesh has neighbor edge slots, they are used to find the shared edges and checked too. If the mesh
+	/// has an edge table, each edge of a triangle must have the edge of its vertices, shared with the neighbor across
+	/// it, and each edge must be in its triangle.
 	/// @return ExitCode indicating the result of the integrity check.
 	static ExitCode CheckIntegrity(const Data::Surface::Mesh& mesh);
 };
@@ -2,10 +2,80 @@
 
 #include "Application/Mesh.h"
 
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 
 namespace Utilitary::Surface
 {
+/// @brief Statistics gathered while loading a mesh.
+struct LoadStatistics
+{
+	/// @brief Number of bytes read from the file.
+	uint64_t ByteCount{ 0 };
+	/// @brief Time spent loading the mesh (in seconds).
+	double ElapsedSeconds{ 0. };
+
+	/// @brief Get the loading throughput (in bytes per second).
+	double GetThroughput() const;
+};
+
+/// @brief Phase of a mesh loading.
+enum struct LoadPhase : uint8_t
+{
+	/// @brief The loading has not started yet.
+	Pending = 0,
+	/// @brief The file is being parsed.
+	Parsing,
+	/// @brief The parsed records are being merged into the mesh.
+	Merging,
+	/// @brief The neighbors and incident triangles are being built.
+	BuildingConnectivity,
+	/// @brief The mesh has been loaded.
+	Done,
+	/// @brief The loading has been stopped after a cancellation request.
+	Cancelled,
+	/// @brief The loading ended without a mesh (e.g. invalid file).
+	Failed,
+};
+
+/// @brief Progress of a mesh loading, shared between the loading thread and its observers.
+/// @note All the functions can be called from any thread.
+class LoadProgress
+{
+public:
+	/// @brief Get the number of bytes parsed so far.
+	uint64_t GetByteCount() const;
+	/// @brief Get the size of the file being loaded (0 if not known yet).
+	uint64_t GetTotalByteCount() const;
+	/// @brief Get the parsed fraction of the file, between 0 and 1.
+	double GetRatio() const;
+	/// @brief Get the current phase.
+	LoadPhase GetPhase() const;
+
+	/// @brief Ask the loader to stop as soon as possible.
+	void RequestCancel();
+	/// @brief Check if the cancellation has been requested.
+	bool IsCancelRequested() const;
+
+	/// @brief Set the size of the file being loaded.
+	void SetTotalByteCount(uint64_t byteCount);
+	/// @brief Add to the number of bytes parsed so far.
+	void AddByteCount(uint64_t byteCount);
+	/// @brief Set the current phase.
+	void SetPhase(LoadPhase phase);
+
+private:
+	/// @brief Number of bytes parsed so far.
+	std::atomic<uint64_t> m_ByteCount{ 0 };
+	/// @brief Size of the file being loaded.
+	std::atomic<uint64_t> m_TotalByteCount{ 0 };
+	/// @brief Current phase.
+	std::atomic<LoadPhase> m_Phase{ LoadPhase::Pending };
+	/// @brief Whether the cancellation has been requested.
+	std::atomic<bool> m_IsCancelRequested{ false };
+};
+
 /// @brief Struct for loading meshes from files.
 struct MeshLoader
 {
@@ -15,10 +85,70 @@ struct MeshLoader
 	/// @return Pointer to the loaded mesh, or nullptr if loading failed.
 	static std::unique_ptr<Data::Surface::Mesh> LoadOFF(const std::filesystem::path& filepath);
 
+	/// @brief Load mesh from an OFF file mapped in memory.
+	/// @param filepath Path to the OFF file.
+	/// @param statistics If not null, filled with the number of bytes read and the loading time.
+	/// @param progress If not null, updated while loading and checked for cancellation.
+	/// @note Numbers are parsed in place with std::from_chars, and the vertex / triangle arrays are sized once from
+	/// the header counts. Only triangular faces are supported.
+	/// @return Pointer to the loaded mesh, or nullptr if loading failed or has been cancelled.
+	static std::unique_ptr<Data::Surface::Mesh> LoadOFFMapped(
+		const std::filesystem::path& filepath, LoadStatistics* statistics = nullptr, LoadProgress* progress = nullptr);
+
 	/// @brief Load mesh from an OBJ file.
 	/// @param filepath Path to the OBJ file.
 	/// @note This function assumes the file is in OBJ format.
 	/// @return Pointer to the loaded mesh, or nullptr if loading failed.
 	static std::unique_ptr<Data::Surface::Mesh> LoadOBJ(const std::filesystem::path& filepath);
+
+	/// @brief Load mesh from an OBJ file using several threads.
+	/// @param filepath Path to the OBJ file.
+	/// @param threadCount Maximal number of threads (and file chunks) to use (0 to use the default thread count). Small
+	/// files use less chunks, as each chunk covers at least 1 MiB.
+	/// @param statistics If not null, filled with the number of bytes read and the loading time.
+	/// @param progress If not null, updated while loading and checked for cancellation.
+	/// @note The file is mapped in memory and split into newline-aligned chunks. Each chunk is parsed into its own
+	/// buffers, then a prefix sum over the chunk record counts resolves the global (and relative) indices before
+	/// the buffers are merged into the mesh. Polygonal faces are triangulated as fans.
+	/// @return Pointer to the loaded mesh, or nullptr if loading failed or has been cancelled.
+	static std::unique_ptr<Data::Surface::Mesh> LoadOBJParallel(
+		const std::filesystem::path& filepath,
+		uint32_t threadCount = 0,
+		LoadStatistics* statistics = nullptr,
+		LoadProgress* progress = nullptr);
+
+	/// @brief Load mesh from a PLY file (ASCII, binary little-endian or binary big-endian).
+	/// @param filepath Path to the PLY file.
+	/// @param statistics If not null, filled with the number of bytes read and the loading time.
+	/// @param progress If not null, updated while loading and checked for cancellation.
+	/// @note Binary vertices with a fixed layout, and binary faces that are all triangles, are read in place from
+	/// the mapped file in parallel. Polygonal faces are triangulated as fans. The vertex normals (nx, ny, nz),
+	/// colors (red, green, blue, alpha) and quality are stored as vertex extra data, other properties and elements
+	/// are skipped.
+	/// @return Pointer to the loaded mesh, or nullptr if loading failed or has been cancelled.
+	static std::unique_ptr<Data::Surface::Mesh> LoadPLY(
+		const std::filesystem::path& filepath, LoadStatistics* statistics = nullptr, LoadProgress* progress = nullptr);
+
+	/// @brief Load mesh from an STL file (ASCII or binary).
+	/// @param filepath Path to the STL file.
+	/// @param statistics If not null, filled with the number of bytes read and the loading time.
+	/// @param progress If not null, updated while loading and checked for cancellation.
+	/// @note STL files are triangle soups: the corners sharing the same position are welded into a single vertex,
+	/// in parallel, before the connectivity is built. Binary facets are read in place from the mapped file. Facet
+	/// normals are ignored, and triangles made degenerated by the welding are removed.
+	/// @return Pointer to the loaded mesh, or nullptr if loading failed or has been cancelled.
+	static std::unique_ptr<Data::Surface::Mesh> LoadSTL(
+		const std::filesystem::path& filepath, LoadStatistics* statistics = nullptr, LoadProgress* progress = nullptr);
+
+	/// @brief Load mesh from a native binary file (see BinaryFormat).
+	/// @param filepath Path to the binary file.
+	/// @param statistics If not null, filled with the number of bytes read and the loading time.
+	/// @param progress If not null, updated while loading and checked for cancellation.
+	/// @note The arrays are copied in bulk from the mapped file: the connectivity is read as is, without being
+	/// rebuilt. The edge table is not stored, call Mesh::UpdateMeshConnectivity to build it. Use BinaryMeshView to
+	/// access the arrays in place without any copy.
+	/// @return Pointer to the loaded mesh, or nullptr if loading failed or has been cancelled.
+	static std::unique_ptr<Data::Surface::Mesh> LoadBinary(
+		const std::filesystem::path& filepath, LoadStatistics* statistics = nullptr, LoadProgress* progress = nullptr);
 };
 } // namespace Utilitary::Surface
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/Primitive.h"
+#include "Core/BaseType.h"
+#include "Core/ChunkedCowVector.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Weight of the normal of a triangle in the normal of each of its vertices.
+enum struct NormalWeighting : uint8_t
+{
+	/// @brief Each triangle has the same weight.
+	Uniform = 0,
+	/// @brief Triangles are weighted by their area.
+	Area,
+	/// @brief Triangles are weighted by their angle at the vertex.
+	Angle,
+};
+
+/// @brief Struct for computing the triangle and vertex normals of a mesh.
+struct MeshNormals
+{
+	/// @brief Compute the normal of each triangle.
+	/// @param vertices Vertices of the mesh.
+	/// @param triangles Triangles of the mesh.
+	/// @param normals Computed normal of each triangle, must have the size of triangles.
+	/// @param normalize If true, compute normalized normals, otherwise their length is twice the triangle area.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	static void ComputeTriangleNormals(Core::Container::ChunkedSpan<const Data::Primitive::Vertex> vertices,
+									   Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+									   std::span<Core::BaseType::Vec3> normals,
+									   bool normalize = true,
+									   uint32_t threadCount = 0);
+
+	/// @brief Compute the smooth normal of each vertex as the weighted sum of the normals of its triangles.
+	/// @param vertices Vertices of the mesh.
+	/// @param triangles Triangles of the mesh.
+	/// @param normals Computed normal of each vertex, must have the size of vertices.
+	/// @param weighting Weight of each triangle normal.
+	/// @param normalize If true, compute normalized normals.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @param triangleNormals Normal of each triangle (e.g. loaded from a file), or empty to compute them from the
+	/// positions. The given normals are normalized, the corner weights are still computed from the positions.
+	/// @note The corners of all the triangles are radix sorted by vertex, then each vertex sums the weighted normals
+	/// of its own corners. No thread writes to a vertex of another thread, and the sums do not depend on the number of
+	/// threads. Degenerate triangles do not contribute, vertices without triangle get a null normal.
+	static void ComputeVertexNormals(Core::Container::ChunkedSpan<const Data::Primitive::Vertex> vertices,
+									 Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+									 std::span<Core::BaseType::Vec3> normals,
+									 NormalWeighting weighting = NormalWeighting::Angle,
+									 bool normalize = true,
+									 uint32_t threadCount = 0,
+									 std::span<const Core::BaseType::Vec3> triangleNormals = {});
+
+	/// @brief Compute the smooth normal of each vertex of the mesh.
+	/// @param mesh The mesh.
+	/// @param weighting Weight of each triangle normal.
+	/// @param normalize If true, compute normalized normals.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @return Normal of each vertex.
+	static std::vector<Core::BaseType::Vec3> ComputeVertexNormals(const Data::Surface::Mesh& mesh,
+																  NormalWeighting weighting = NormalWeighting::Angle,
+																  bool normalize = true,
+																  uint32_t threadCount = 0);
+
+	/// @brief Get the triangles around some vertices, i.e. the triangles whose normal depends on their position.
+	/// @param mesh The mesh.
+	/// @param vertexIndices Indices of the vertices.
+	/// @note The triangles are found by one pass over the triangle corners, so a non-manifold vertex (e.g. a bowtie
+	/// vertex) gets the triangles of all its fans.
+	/// @return Indices of the triangles, sorted and without duplicates.
+	static std::vector<Core::BaseType::TriangleIndex> GetTrianglesAroundVertices(
+		const Data::Surface::Mesh& mesh, std::span<const Core::BaseType::VertexIndex> vertexIndices);
+
+	/// @brief Get the vertices of the triangles around some vertices, i.e. the vertices whose normal depends on their
+	/// position.
+	/// @param mesh The mesh.
+	/// @param vertexIndices Indices of the vertices.
+	/// @return Indices of the vertices, sorted and without duplicates.
+	static std::vector<Core::BaseType::VertexIndex> GetVerticesAroundVertices(
+		const Data::Surface::Mesh& mesh, std::span<const Core::BaseType::VertexIndex> vertexIndices);
+
+	/// @brief Compute the smooth normal of some vertices of the mesh.
+	/// @param mesh The mesh.
+	/// @param vertexIndices Indices of the vertices.
+	/// @param normals Computed normal of each vertex of vertexIndices, must have the size of vertexIndices.
+	/// @param weighting Weight of each triangle normal.
+	/// @param normalize If true, compute normalized normals.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @param triangleNormals Normal of each triangle of the mesh, or empty to compute them from the positions. The
+	/// given normals are normalized.
+	/// @note The corners of the vertices are found by one pass over the triangle corners, then summed in increasing
+	/// index order, which gives the same normals as computing the normals of the whole mesh, non-manifold vertices
+	/// included. Only the normals of the triangles around the vertices are computed.
+	static void ComputeVertexNormals(const Data::Surface::Mesh& mesh,
+									 std::span<const Core::BaseType::VertexIndex> vertexIndices,
+									 std::span<Core::BaseType::Vec3> normals,
+									 NormalWeighting weighting = NormalWeighting::Angle,
+									 bool normalize = true,
+									 uint32_t threadCount = 0,
+									 std::span<const Core::BaseType::Vec3> triangleNormals = {});
+
+	/// @brief Update the smooth vertex normals of the mesh after moving some of its vertices.
+	/// @param mesh The mesh.
+	/// @param movedVertexIndices Indices of the moved vertices.
+	/// @param normals Normal of each vertex of the mesh, only the normals depending on the moved vertices are updated.
+	/// @param weighting Weight of each triangle normal.
+	/// @param normalize If true, compute normalized normals.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	static void UpdateVertexNormals(const Data::Surface::Mesh& mesh,
+									std::span<const Core::BaseType::VertexIndex> movedVertexIndices,
+									std::span<Core::BaseType::Vec3> normals,
+									NormalWeighting weighting = NormalWeighting::Angle,
+									bool normalize = true,
+									uint32_t threadCount = 0);
+};
+} // namespace Utilitary::Surface
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/Primitive.h"
+#include "Core/BaseType.h"
+#include "Core/ChunkedCowVector.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Order given to the vertices and triangles of a mesh to improve its memory locality.
+enum struct ReorderingMethod : uint8_t
+{
+	/// @brief Vertices sorted along a Morton curve, triangles sorted by their first vertex in this order.
+	Morton = 0,
+	/// @brief Triangles sorted by a breadth-first traversal of their neighbors, vertices by their first triangle.
+	BreadthFirst,
+};
+
+/// @brief Struct for reordering the vertices and triangles of a mesh, so that close elements are close in memory.
+/// @note Orders are given as a list of old indices: the new element i is the old element order[i].
+struct MeshReordering
+{
+	/// @brief Get the order of the vertices along a Morton (Z-order) curve over their bounding box.
+	/// @param vertices Vertices of the mesh.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The positions are quantized on 21 bits per axis, then the interleaved 63-bit codes are radix sorted.
+	/// Vertices with the same code keep their relative order.
+	/// @return Old index of each new vertex.
+	static std::vector<Core::BaseType::VertexIndex> ComputeMortonVertexOrder(
+		Core::Container::ChunkedSpan<const Data::Primitive::Vertex> vertices, uint32_t threadCount = 0);
+
+	/// @brief Get the order of the triangles sorted by their smallest vertex index in a vertex order.
+	/// @param triangles Triangles of the mesh.
+	/// @param vertexOrder Old index of each new vertex.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @return Old index of each new triangle.
+	static std::vector<Core::BaseType::TriangleIndex> ComputeTriangleOrder(
+		Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+		std::span<const Core::BaseType::VertexIndex> vertexOrder,
+		uint32_t threadCount = 0);
+
+	/// @brief Get the order of the triangles visited by a breadth-first traversal of their neighbors.
+	/// @param triangles Triangles of the mesh, with up to date neighbors.
+	/// @note Each connected component is traversed from its first triangle, the components in the order of their
+	/// first triangle.
+	/// @return Old index of each new triangle.
+	static std::vector<Core::BaseType::TriangleIndex> ComputeBreadthFirstTriangleOrder(
+		Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles);
+
+	/// @brief Get the order of the vertices by their first use in a triangle order.
+	/// @param vertexCount Number of vertices of the mesh.
+	/// @param triangles Triangles of the mesh.
+	/// @param triangleOrder Old index of each new triangle.
+	/// @note Vertices without triangle are placed last, in their current order.
+	/// @return Old index of each new vertex.
+	static std::vector<Core::BaseType::VertexIndex> ComputeVertexOrder(
+		size_t vertexCount,
+		Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+		std::span<const Core::BaseType::TriangleIndex> triangleOrder);
+
+	/// @brief Reorder the vertices and triangles of a mesh.
+	/// @param mesh The mesh to reorder.
+	/// @param vertexOrder Old index of each new vertex, a permutation of the vertices.
+	/// @param triangleOrder Old index of each new triangle, a permutation of the triangles.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The vertices, neighbors and incident triangles of the triangles and vertices are remapped, and their
+	/// extra data, attribute channels, neighbor edge slots and edge indices are moved with them. The edges keep their
+	/// order, their vertices and triangle being remapped. The dirty vertices are remapped, the cached one-ring
+	/// adjacency is dropped. The mesh must not have deleted elements (see Mesh::GarbageCollect).
+	static void Permute(Data::Surface::Mesh& mesh,
+						std::span<const Core::BaseType::VertexIndex> vertexOrder,
+						std::span<const Core::BaseType::TriangleIndex> triangleOrder,
+						uint32_t threadCount = 0);
+
+	/// @brief Reorder the vertices and triangles of a mesh to improve the locality of the neighborhood queries.
+	/// @param mesh The mesh to reorder, its connectivity must be up to date for ReorderingMethod::BreadthFirst.
+	/// @param method Order of the vertices and triangles.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	static void Reorder(Data::Surface::Mesh& mesh,
+						ReorderingMethod method = ReorderingMethod::Morton,
+						uint32_t threadCount = 0);
+};
+} // namespace Utilitary::Surface
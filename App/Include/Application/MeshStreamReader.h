@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Core/BaseType.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace Utilitary::Surface
+{
+/// @brief Corner of a face record, referencing the records read before it.
+struct FaceCorner
+{
+	/// @brief 0-based index of the vertex position.
+	int PositionIdx{ -1 };
+	/// @brief 0-based index of the texture coordinates (-1 if not referenced).
+	int TexCoordIdx{ -1 };
+	/// @brief 0-based index of the normal (-1 if not referenced).
+	int NormalIdx{ -1 };
+};
+
+/// @brief Visitor called on each record of a mesh file read by MeshStreamReader.
+/// @note Records are given in file order. Override only the callbacks of interest, the others do nothing.
+class MeshRecordVisitor
+{
+public:
+	virtual ~MeshRecordVisitor() = default;
+
+	/// @brief Called once before any record if the file declares its counts (OFF header).
+	virtual void OnHeader(uint64_t /*vertexCount*/, uint64_t /*faceCount*/) {}
+	/// @brief Called on each vertex position.
+	virtual void OnVertex(const Core::BaseType::Vec3& /*position*/) {}
+	/// @brief Called on each texture coordinates record.
+	virtual void OnTexCoord(const Core::BaseType::Vec2& /*texCoords*/) {}
+	/// @brief Called on each normal record.
+	virtual void OnNormal(const Core::BaseType::Vec3& /*normal*/) {}
+	/// @brief Called on each face, with at least three corners. Faces are not triangulated.
+	/// @note The corners span is only valid during the call.
+	virtual void OnFace(std::span<const FaceCorner> /*corners*/) {}
+};
+
+/// @brief Struct for reading mesh files record by record, without building a mesh.
+/// @note The file is read through a fixed size buffer, so memory usage does not depend on the file size. A line
+/// longer than the buffer is reported as an error.
+struct MeshStreamReader
+{
+	/// @brief Default size of the read buffer (in bytes).
+	static constexpr size_t DefaultBufferSize = size_t(1) << 16;
+
+	/// @brief Read the records of an OFF file.
+	/// @param filepath Path to the OFF file.
+	/// @param visitor Visitor called on each record.
+	/// @param bufferSize Size of the read buffer (in bytes).
+	/// @return True if the whole file has been read, false if it can't be opened or is invalid.
+	static bool ReadOFF(
+		const std::filesystem::path& filepath, MeshRecordVisitor& visitor, size_t bufferSize = DefaultBufferSize);
+
+	/// @brief Read the records of an OBJ file.
+	/// @param filepath Path to the OBJ file.
+	/// @param visitor Visitor called on each record.
+	/// @param bufferSize Size of the read buffer (in bytes).
+	/// @note Negative (relative) indices are resolved, and each index is checked against the records read so far.
+	/// @return True if the whole file has been read, false if it can't be opened or is invalid.
+	static bool ReadOBJ(
+		const std::filesystem::path& filepath, MeshRecordVisitor& visitor, size_t bufferSize = DefaultBufferSize);
+};
+} // namespace Utilitary::Surface
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/Primitive.h"
+#include "Core/BaseType.h"
+#include "Core/ChunkedCowVector.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Efficiency of a triangle order for a post-transform vertex cache.
+struct VertexCacheReport
+{
+	/// @brief Number of vertices transformed, i.e. of vertex references missing the cache.
+	uint64_t CacheMissCount{ 0 };
+	/// @brief Average cache miss ratio: transformed vertices per triangle (0.5 at best on large meshes, 3 at worst).
+	float ACMR{ 0.f };
+	/// @brief Average transform to vertex ratio: transformed vertices per used vertex (1 at best).
+	float ATVR{ 0.f };
+};
+
+/// @brief Struct for ordering the triangles of a mesh to reuse the vertices transformed by a GPU.
+struct MeshVertexCache
+{
+	/// @brief Size of the vertex cache assumed by default, in vertices.
+	static constexpr uint32_t DefaultCacheSize = 32;
+	/// @brief Number of triangles of the clusters ordered independently by default.
+	static constexpr uint32_t DefaultClusterSize = 1 << 16;
+
+	/// @brief Simulate a FIFO vertex cache on a triangle order.
+	/// @param vertexCount Number of vertices of the mesh.
+	/// @param triangles Triangles of the mesh, in drawing order.
+	/// @param cacheSize Number of vertices of the cache.
+	/// @return Cache misses of the triangle order.
+	static VertexCacheReport Analyze(size_t vertexCount,
+									 Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+									 uint32_t cacheSize = 16);
+
+	/// @brief Get a triangle order with a low cache miss ratio, using the algorithm of Tom Forsyth.
+	/// @param triangles Triangles of the mesh.
+	/// @param cacheSize Number of vertices of the LRU cache used to score the vertices.
+	/// @param clusterSize Number of consecutive triangles ordered independently of the others.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The triangles are greedily emitted by the score of their vertices, which favors the vertices recently
+	/// used and the ones with few remaining triangles. Clusters of clusterSize consecutive triangles are ordered in
+	/// parallel and keep their relative order, so spatially ordered triangles (see MeshReordering) give better
+	/// clusters. The order does not depend on the number of threads.
+	/// @return Old index of each new triangle.
+	static std::vector<Core::BaseType::TriangleIndex> ComputeTriangleOrder(
+		Core::Container::ChunkedSpan<const Data::Primitive::Triangle> triangles,
+		uint32_t cacheSize = DefaultCacheSize,
+		uint32_t clusterSize = DefaultClusterSize,
+		uint32_t threadCount = 0);
+
+	/// @brief Reorder the triangles of a mesh for the vertex cache.
+	/// @param mesh The mesh to reorder.
+	/// @param cacheSize Number of vertices of the LRU cache used to score the vertices.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note The vertices keep their order. See MeshReordering::Permute for the data moved with the triangles.
+	static void Optimize(Data::Surface::Mesh& mesh, uint32_t cacheSize = DefaultCacheSize, uint32_t threadCount = 0);
+};
+} // namespace Utilitary::Surface
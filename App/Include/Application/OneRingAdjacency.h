@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Core/BaseType.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Data::Surface
+{
+/// @brief Vertices and triangles around each vertex of a mesh, stored in compressed sparse row form.
+/// @note The neighbors of vertex i are Vertices[VertexOffsets[i], VertexOffsets[i + 1]), in the order of the
+/// circulators of the mesh (counter-clockwise first, then clockwise from the incident triangle if the one-ring is
+/// opened). Same for the triangles with TriangleOffsets and Triangles.
+class OneRingAdjacency
+{
+public:
+	/// @brief Build the one-ring adjacency of a mesh.
+	/// @param mesh The mesh, its connectivity must be up to date.
+	/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+	/// @note Each vertex circulates around its one-ring once to count its neighbors and once to store them, the
+	/// vertices being split between threads. Vertices without incident triangle have an empty one-ring.
+	static OneRingAdjacency Build(const Mesh& mesh, uint32_t threadCount = 0);
+
+	/// @brief Get the number of vertices.
+	size_t GetVertexCount() const;
+
+	/// @brief Get the vertices around a vertex.
+	std::span<const Core::BaseType::VertexIndex> GetVerticesAroundVertex(Core::BaseType::VertexIndex index) const;
+	/// @brief Get the triangles around a vertex.
+	std::span<const Core::BaseType::TriangleIndex> GetTrianglesAroundVertex(Core::BaseType::VertexIndex index) const;
+
+	/// @brief Get the offset of the neighbors of each vertex in GetVertices, followed by the total number of neighbors.
+	std::span<const uint32_t> GetVertexOffsets() const;
+	/// @brief Get the vertices around every vertex, one one-ring after the other.
+	std::span<const Core::BaseType::VertexIndex> GetVertices() const;
+	/// @brief Get the offset of the triangles of each vertex in GetTriangles, followed by their total number.
+	std::span<const uint32_t> GetTriangleOffsets() const;
+	/// @brief Get the triangles around every vertex, one one-ring after the other.
+	std::span<const Core::BaseType::TriangleIndex> GetTriangles() const;
+
+private:
+	/// @brief Offset of the neighbors of each vertex, followed by the total number of neighbors.
+	std::vector<uint32_t> m_VertexOffsets{ 0 };
+	/// @brief Vertices around every vertex.
+	std::vector<Core::BaseType::VertexIndex> m_Vertices{};
+	/// @brief Offset of the triangles of each vertex, followed by the total number of triangles.
+	std::vector<uint32_t> m_TriangleOffsets{ 0 };
+	/// @brief Triangles around every vertex.
+	std::vector<Core::BaseType::TriangleIndex> m_Triangles{};
+};
+} // namespace Data::Surface
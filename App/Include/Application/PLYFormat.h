@@ -0,0 +1,158 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/// @brief Description of a PLY file, as declared by its header.
+/// @note A PLY file is a header listing elements (e.g. vertex, face) and their properties, followed by the records
+/// of each element in declaration order, encoded in ASCII or binary.
+namespace Utilitary::Surface::PLYFormat
+{
+/// @brief Encoding of the records.
+enum struct Encoding : uint8_t
+{
+	Ascii = 0,
+	BinaryLittleEndian,
+	BinaryBigEndian,
+};
+
+/// @brief Type of a property value (or of the count / items of a list property).
+enum struct ScalarType : uint8_t
+{
+	Int8 = 0,
+	UInt8,
+	Int16,
+	UInt16,
+	Int32,
+	UInt32,
+	Float32,
+	Float64,
+};
+
+/// @brief Property of an element.
+struct Property
+{
+	/// @brief Name of the property.
+	std::string Name{};
+	/// @brief Type of the value, or of the items for a list property.
+	ScalarType Type{ ScalarType::Float32 };
+	/// @brief Whether the property is a list of values.
+	bool IsList{ false };
+	/// @brief Type of the item count of a list property.
+	ScalarType CountType{ ScalarType::UInt8 };
+};
+
+/// @brief Element declared in the header, with its properties.
+struct Element
+{
+	/// @brief Name of the element.
+	std::string Name{};
+	/// @brief Number of records of the element.
+	uint64_t Count{ 0 };
+	/// @brief Properties of each record, in file order.
+	std::vector<Property> Properties{};
+
+	/// @brief Get the index of a property, or -1 if the element has no such property.
+	int FindProperty(std::string_view name) const;
+	/// @brief Get the size of a binary record (in bytes), or 0 if the element has a list property.
+	uint32_t GetFixedStride() const;
+	/// @brief Get the minimal size of a record (in bytes) with the given encoding, its lists being empty.
+	/// @note An ASCII value takes at least one character followed by a separator.
+	uint32_t GetMinRecordSize(Encoding format) const;
+	/// @brief Get the offset of a property in a binary record (in bytes).
+	/// @note Only valid for elements without list property.
+	uint32_t GetPropertyOffset(int propertyIdx) const;
+};
+
+/// @brief Header of a PLY file.
+struct Header
+{
+	/// @brief Encoding of the records.
+	Encoding Format{ Encoding::Ascii };
+	/// @brief Elements, in file order.
+	std::vector<Element> Elements{};
+	/// @brief Offset of the first record from the beginning of the file (in bytes).
+	size_t DataOffset{ 0 };
+
+	/// @brief Get the index of an element, or -1 if the header has no such element.
+	int FindElement(std::string_view name) const;
+};
+
+/// @brief Get the size of a scalar type (in bytes).
+uint32_t GetScalarSize(ScalarType type);
+
+/// @brief Get the name of a scalar type as written in a header.
+std::string_view GetScalarName(ScalarType type);
+
+/// @brief Parse the header at the beginning of a PLY file.
+/// @param data Content of the file.
+/// @param header Parsed header.
+/// @return True if the header is valid, false otherwise.
+bool ParseHeader(std::string_view data, Header& header);
+
+/// @brief Read a binary scalar and convert it to T.
+/// @param ptr Pointer to the first byte of the scalar.
+/// @param type Type of the scalar in the file.
+/// @param isBigEndian Whether the scalar is stored in big-endian.
+template<typename T>
+T ReadBinaryScalar(const char* ptr, ScalarType type, bool isBigEndian)
+{
+	auto Read = [ptr, isBigEndian]<typename U>(U value)
+	{
+		std::memcpy(&value, ptr, sizeof(U));
+		if constexpr(sizeof(U) > 1)
+		{
+			if(isBigEndian != (std::endian::native == std::endian::big))
+				value = std::byteswap(value);
+		}
+		return value;
+	};
+
+	switch(type)
+	{
+		case ScalarType::Int8:
+			return static_cast<T>(Read(int8_t{}));
+		case ScalarType::UInt8:
+			return static_cast<T>(Read(uint8_t{}));
+		case ScalarType::Int16:
+			return static_cast<T>(Read(int16_t{}));
+		case ScalarType::UInt16:
+			return static_cast<T>(Read(uint16_t{}));
+		case ScalarType::Int32:
+			return static_cast<T>(Read(int32_t{}));
+		case ScalarType::UInt32:
+			return static_cast<T>(Read(uint32_t{}));
+		case ScalarType::Float32:
+			return static_cast<T>(std::bit_cast<float>(Read(uint32_t{})));
+		case ScalarType::Float64:
+			return static_cast<T>(std::bit_cast<double>(Read(uint64_t{})));
+	}
+	return T{};
+}
+
+/// @brief Write a binary scalar with the given endianness.
+/// @param ptr Pointer to the first byte to write.
+/// @param value Value to write, its type is the type of the scalar in the file.
+/// @param isBigEndian Whether the scalar is stored in big-endian.
+template<typename T>
+void WriteBinaryScalar(char* ptr, T value, bool isBigEndian)
+{
+	if constexpr(sizeof(T) > 1)
+	{
+		if(isBigEndian != (std::endian::native == std::endian::big))
+		{
+			using UIntT =
+				std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+			const UIntT swapped = std::byteswap(std::bit_cast<UIntT>(value));
+			std::memcpy(ptr, &swapped, sizeof(T));
+			return;
+		}
+	}
+	std::memcpy(ptr, &value, sizeof(T));
+}
+} // namespace Utilitary::Surface::PLYFormat
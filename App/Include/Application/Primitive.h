@@ -3,6 +3,7 @@
 #include "Core/BaseType.h"
 
 #include <array>
+#include <cstdint>
 
 /// @brief Helper namespace for index manipulations in triangles.
 namespace IndexHelpers
@@ -43,6 +44,43 @@ struct Triangle
 	/// @note If the triangle has no neighbor on the edge, the index is set to -1.
 	std::array<int, 3> Neighbors{ -1, -1, -1 };
 };
+
+/// @brief Structure holding the informations relative to an edge of the mesh (see Mesh::GetEdges).
+struct Edge
+{
+	/// @brief Edge vertex indices, the smaller one first.
+	std::array<int, 2> Vertices{ -1, -1 };
+
+	/// @brief Index of one of the triangles containing the edge.
+	int TriangleIdx{ -1 };
+	/// @brief Index of the edge in this triangle (i.e. the index of the opposite vertex).
+	Core::BaseType::EdgeIndex EdgeIdx{ 0 };
+};
+
+/// @brief Local index, in each neighbor of a triangle, of the edge shared with the triangle.
+/// @note The edge index in Neighbors[i] is packed on the bits [2i, 2i + 1]. NoEdge is stored if there is no neighbor,
+/// or if the neighbor is not oriented like the triangle (its shared edge must then be searched).
+/// Crossing an edge with it does not need any vertex comparison.
+struct NeighborEdgeSlots
+{
+	/// @brief Value of a slot without neighbor.
+	static constexpr Core::BaseType::EdgeIndex NoEdge = 3;
+
+	/// @brief Packed edge indices.
+	uint8_t Packed{ 0xFF };
+
+	/// @brief Get the index, in the neighbor across an edge, of this edge.
+	Core::BaseType::EdgeIndex Get(const Core::BaseType::EdgeIndex edgeIdx) const
+	{
+		return static_cast<Core::BaseType::EdgeIndex>((Packed >> (2 * edgeIdx)) & 0b11);
+	}
+
+	/// @brief Set the index, in the neighbor across an edge, of this edge.
+	void Set(const Core::BaseType::EdgeIndex edgeIdx, const Core::BaseType::EdgeIndex neighborEdgeIdx)
+	{
+		Packed = static_cast<uint8_t>((Packed & ~(0b11 << (2 * edgeIdx))) | (neighborEdgeIdx << (2 * edgeIdx)));
+	}
+};
 } // namespace Data::Primitive
 
 namespace Utilitary::Primitive
@@ -62,4 +100,14 @@ int GetEdgeIndex(
 /// @param index The vertex to found in the triangle.
 /// @return The local index of the vertex (0, 1, or 2), or -1 if it is not found.
 int GetVertexLocalIndex(const Data::Primitive::Triangle& triangle, const Core::BaseType::VertexIndex index);
+
+/// @brief Get the local index of a vertex in the neighbor of a triangle, without vertex comparison.
+/// @param edgeIdx The edge of the triangle shared with the neighbor.
+/// @param neighborEdgeIdx The index of this edge in the neighbor (see NeighborEdgeSlots).
+/// @param vertexLocalIdx The local index in the triangle of one of the two vertices of the edge.
+/// @return The local index of the vertex in the neighbor.
+Core::BaseType::EdgeIndex GetVertexLocalIndexInNeighbor(
+	const Core::BaseType::EdgeIndex edgeIdx,
+	const Core::BaseType::EdgeIndex neighborEdgeIdx,
+	const Core::BaseType::EdgeIndex vertexLocalIdx);
 } // namespace Utilitary::Primitive
@@ -3,6 +3,9 @@
 #include "Application/Mesh.h"
 #include "Core/BaseType.h"
 
+#include <cassert>
+#include <string_view>
+
 namespace Data::Primitive
 {
 /// @brief Proxy class for a triangle in a mesh, providing safe access and extra data storage.
@@ -17,7 +20,7 @@ public:
 	T* GetExtraData()
 	{
 		assert(m_Mesh->HasTrianglesExtraDataContainer());
-		return m_Mesh->m_TrianglesExtraDataContainer[m_Index].Get<T>();
+		return m_Mesh->m_TrianglesExtraDataContainer.Write()[m_Index].Get<T>();
 	}
 
 	/// @brief Get extra data of type T associated with the triangle, or nullptr if not found.
@@ -34,7 +37,7 @@ public:
 	T& GetOrCreateExtraData() const
 	{
 		assert(m_Mesh->HasTrianglesExtraDataContainer());
-		return m_Mesh->m_TrianglesExtraDataContainer[m_Index].GetOrCreate<T>();
+		return m_Mesh->m_TrianglesExtraDataContainer.Write()[m_Index].GetOrCreate<T>();
 	}
 
 	/// @brief Set extra data of type T associated with the triangle.
@@ -42,7 +45,7 @@ public:
 	void SetExtraData(T&& data)
 	{
 		assert(m_Mesh->HasTrianglesExtraDataContainer());
-		return m_Mesh->m_TrianglesExtraDataContainer[m_Index].Set<T>(data);
+		return m_Mesh->m_TrianglesExtraDataContainer.Write()[m_Index].Set<T>(data);
 	}
 
 	/// @brief Erase extra data of type T associated with the triangle.
@@ -50,7 +53,7 @@ public:
 	void EraseExtraData()
 	{
 		assert(m_Mesh->HasTrianglesExtraDataContainer() && HasExtraData<T>());
-		return m_Mesh->m_TrianglesExtraDataContainer[m_Index].Erase<T>();
+		return m_Mesh->m_TrianglesExtraDataContainer.Write()[m_Index].Erase<T>();
 	}
 
 	/// @brief Check if extra data of type T is associated with the triangle.
@@ -60,14 +63,32 @@ public:
 		return m_Mesh->HasTrianglesExtraDataContainer() && m_Mesh->m_TrianglesExtraDataContainer[m_Index].Has<T>();
 	}
 
+	/// @brief Get the value of the triangle in an attribute channel of the mesh.
+	/// @note The channel is looked up by name: index the channel directly when iterating over many triangles.
+	template<typename T>
+	T& GetAttribute(std::string_view name) const
+	{
+		Data::Attribute::AttributeChannel<T>* channel = m_Mesh->GetTriangleAttribute<T>(name);
+		assert(channel != nullptr && "Missing triangle attribute");
+		return (*channel)[m_Index];
+	}
+
+	/// @brief Set the value of the triangle in an attribute channel of the mesh.
+	template<typename T>
+	void SetAttribute(std::string_view name, const T& value) const
+	{
+		GetAttribute<T>(name) = value;
+	}
+
 	/// @brief Get the index of the triangle in the mesh.
 	Core::BaseType::TriangleIndex GetIndex() const;
 
 	/// @brief Get the triangle being proxied.
-	Triangle& GetTriangle();
-	/// @brief Get the triangle being proxied (const version).
 	const Triangle& GetTriangle() const;
 
+	/// @brief Set the triangle being proxied (see Mesh::SetTriangleData).
+	void SetTriangle(const Triangle& triangle) const;
+
 	/// @brief Get the vertex at the given index of the triangle.
 	Core::BaseType::VertexIndex GetVertex(const Core::BaseType::EdgeIndex index) const;
 
@@ -100,7 +121,7 @@ public:
 	{
 		if(!m_Mesh->HasVerticesExtraDataContainer())
 			return nullptr;
-		return m_Mesh->m_VerticesExtraDataContainer[m_Index].Get<T>();
+		return m_Mesh->m_VerticesExtraDataContainer.Write()[m_Index].Get<T>();
 	}
 
 	/// @brief Get extra data of type T associated with the vertex, or nullptr if not found.
@@ -116,7 +137,7 @@ public:
 	T& GetOrCreateExtraData() const
 	{
 		assert(m_Mesh->HasVerticesExtraDataContainer());
-		return m_Mesh->m_VerticesExtraDataContainer[m_Index].GetOrCreate<T>();
+		return m_Mesh->m_VerticesExtraDataContainer.Write()[m_Index].GetOrCreate<T>();
 	}
 
 	/// @brief Set extra data of type T associated with the vertex.
@@ -124,7 +145,7 @@ public:
 	void SetExtraData(T&& data)
 	{
 		assert(m_Mesh->HasVerticesExtraDataContainer());
-		return m_Mesh->m_VerticesExtraDataContainer[m_Index].Set<T>(data);
+		return m_Mesh->m_VerticesExtraDataContainer.Write()[m_Index].Set<T>(data);
 	}
 
 	/// @brief Check if extra data of type T is associated with the vertex.
@@ -139,7 +160,24 @@ public:
 	void EraseExtraData() const
 	{
 		assert(m_Mesh->HasVerticesExtraDataContainer() && HasExtraData<T>());
-		return m_Mesh->m_VerticesExtraDataContainer[m_Index].Erase<T>();
+		return m_Mesh->m_VerticesExtraDataContainer.Write()[m_Index].Erase<T>();
+	}
+
+	/// @brief Get the value of the vertex in an attribute channel of the mesh.
+	/// @note The channel is looked up by name: index the channel directly when iterating over many vertices.
+	template<typename T>
+	T& GetAttribute(std::string_view name) const
+	{
+		Data::Attribute::AttributeChannel<T>* channel = m_Mesh->GetVertexAttribute<T>(name);
+		assert(channel != nullptr && "Missing vertex attribute");
+		return (*channel)[m_Index];
+	}
+
+	/// @brief Set the value of the vertex in an attribute channel of the mesh.
+	template<typename T>
+	void SetAttribute(std::string_view name, const T& value) const
+	{
+		GetAttribute<T>(name) = value;
 	}
 
 	/// @brief Get the index of the vertex in the mesh.
@@ -156,6 +194,9 @@ public:
 	/// @brief Get the position of the vertex (const version).
 	const Core::BaseType::Vec3& GetPosition() const;
 
+	/// @brief Set the position of the vertex and mark it as dirty (see Mesh::UpdateDirtyNormals).
+	void SetPosition(const Core::BaseType::Vec3& position) const;
+
 	/// @brief Get the incident triangle of the vertex.
 	int GetIncidentTriangle() const;
 
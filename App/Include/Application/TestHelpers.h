@@ -3,6 +3,12 @@
 #include "Application/ExtraDataType.h"
 #include "Application/Mesh.h"
 #include "Application/PrimitiveProxy.h"
+#include "Core/FlatHashMap.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 
 namespace TestHelpers
 {
@@ -102,4 +108,56 @@ inline Data::Surface::Mesh CreateGridMesh(int nRow = 1, int nCol = 1)
 
 	return mesh;
 }
+
+/// @brief Create a unit icosphere by subdividing an icosahedron.
+/// @param subdivisionCount Number of subdivisions, each one splitting every triangle into 4.
+/// @note The mesh is closed, with 20*4^subdivisionCount faces and 10*4^subdivisionCount+2 vertices.
+inline Data::Surface::Mesh CreateIcosphereMesh(int subdivisionCount = 0)
+{
+	using Core::BaseType::Vec3;
+
+	const float t = (1.f + std::sqrt(5.f)) / 2.f;
+	std::vector<Vec3> positions{ { -1, t, 0 }, { 1, t, 0 },	  { -1, -t, 0 }, { 1, -t, 0 },
+								 { 0, -1, t }, { 0, 1, t },	  { 0, -1, -t }, { 0, 1, -t },
+								 { t, 0, -1 }, { t, 0, 1 },	  { -t, 0, -1 }, { -t, 0, 1 } };
+	std::vector<std::array<int, 3>> faces{ { 0, 11, 5 }, { 0, 5, 1 },	{ 0, 1, 7 },   { 0, 7, 10 }, { 0, 10, 11 },
+										   { 1, 5, 9 },	 { 5, 11, 4 },	{ 11, 10, 2 }, { 10, 7, 6 }, { 7, 1, 8 },
+										   { 3, 9, 4 },	 { 3, 4, 2 },	{ 3, 2, 6 },   { 3, 6, 8 },	 { 3, 8, 9 },
+										   { 4, 9, 5 },	 { 2, 4, 11 },	{ 6, 2, 10 },  { 8, 6, 7 },	 { 9, 8, 1 } };
+
+	for(int iSubdivision = 0; iSubdivision < subdivisionCount; ++iSubdivision)
+	{
+		// Midpoint of each edge, shared by its two faces.
+		Core::Container::FlatHashMap<uint64_t, int> midpoints(faces.size() * 3 / 2);
+		auto GetMidpoint = [&positions, &midpoints](int v0, int v1)
+		{
+			const uint64_t key =
+				(static_cast<uint64_t>(std::min(v0, v1)) << 32) | static_cast<uint64_t>(std::max(v0, v1));
+			auto [midpointIdx, isInserted] = midpoints.TryEmplace(key, static_cast<int>(positions.size()));
+			if(isInserted)
+				positions.push_back((positions[v0] + positions[v1]) * 0.5f);
+			return midpointIdx;
+		};
+
+		std::vector<std::array<int, 3>> subdividedFaces;
+		subdividedFaces.reserve(faces.size() * 4);
+		for(auto&& [v0, v1, v2] : faces)
+		{
+			const int m01 = GetMidpoint(v0, v1);
+			const int m12 = GetMidpoint(v1, v2);
+			const int m20 = GetMidpoint(v2, v0);
+			subdividedFaces.push_back({ v0, m01, m20 });
+			subdividedFaces.push_back({ v1, m12, m01 });
+			subdividedFaces.push_back({ v2, m20, m12 });
+			subdividedFaces.push_back({ m01, m12, m20 });
+		}
+		faces = std::move(subdividedFaces);
+	}
+
+	for(auto&& curPosition : positions)
+		curPosition = glm::normalize(curPosition);
+
+	// Build the mesh with its connectivity (neighbors and incident faces)
+	return Data::Surface::Mesh(positions, faces);
+}
 } // namespace TestHelpers
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Application/Primitive.h"
+#include "Core/Hash.h"
 
 #include <bitset>
 #include <stdexcept>
@@ -43,9 +44,7 @@ struct hash<Data::Primitive::VertexPair>
 {
 	size_t operator()(const Data::Primitive::VertexPair& vertexPair) const
 	{
-		auto h1 = std::hash<Core::BaseType::VertexIndex>{}(vertexPair.GetMinVertexIdx());
-		auto h2 = std::hash<Core::BaseType::VertexIndex>{}(vertexPair.GetMaxVertexIdx());
-		return h1 ^ h2;
+		return Core::Hash::HashEdge(vertexPair.GetMinVertexIdx(), vertexPair.GetMaxVertexIdx());
 	}
 };
 } // namespace std
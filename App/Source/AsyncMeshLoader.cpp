@@ -0,0 +1,131 @@
+#include "Application/AsyncMeshLoader.h"
+
+#include "Application/MeshBinaryFormat.h"
+#include "Core/PrintHelpers.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <string>
+
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Load a mesh with the loader matching the file extension.
+std::unique_ptr<Mesh> LoadMesh(const std::filesystem::path& filepath, Utilitary::Surface::LoadProgress& progress)
+{
+	using Utilitary::Surface::MeshLoader;
+
+	std::string extension = filepath.extension().string();
+	std::ranges::transform(
+		extension,
+		extension.begin(),
+		[](unsigned char c)
+		{
+			return static_cast<char>(std::tolower(c));
+		});
+
+	if(extension == ".off")
+		return MeshLoader::LoadOFFMapped(filepath, nullptr, &progress);
+	if(extension == ".obj")
+		return MeshLoader::LoadOBJParallel(filepath, 0, nullptr, &progress);
+	if(extension == ".ply")
+		return MeshLoader::LoadPLY(filepath, nullptr, &progress);
+	if(extension == ".stl")
+		return MeshLoader::LoadSTL(filepath, nullptr, &progress);
+	if(extension == Utilitary::Surface::BinaryFormat::FileExtension)
+		return MeshLoader::LoadBinary(filepath, nullptr, &progress);
+
+	Error("Unsupported file extension: {}", filepath.string());
+	return nullptr;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+MeshLoadHandle::MeshLoadHandle(std::shared_ptr<LoadProgress> progress, std::future<std::unique_ptr<Mesh>> future)
+	: m_Progress(std::move(progress))
+	, m_Future(std::move(future))
+{}
+
+MeshLoadHandle::~MeshLoadHandle()
+{
+	if(m_Future.valid())
+		m_Progress->RequestCancel();
+}
+
+MeshLoadHandle& MeshLoadHandle::operator=(MeshLoadHandle&& other) noexcept
+{
+	if(this != &other)
+	{
+		if(m_Future.valid())
+			m_Progress->RequestCancel();
+
+		m_Progress = std::move(other.m_Progress);
+		m_Future = std::move(other.m_Future);
+	}
+	return *this;
+}
+
+bool MeshLoadHandle::IsValid() const
+{
+	return m_Future.valid();
+}
+
+bool MeshLoadHandle::IsReady() const
+{
+	return WaitFor(std::chrono::milliseconds(0));
+}
+
+bool MeshLoadHandle::WaitFor(std::chrono::milliseconds duration) const
+{
+	assert(IsValid());
+	return m_Future.wait_for(duration) == std::future_status::ready;
+}
+
+const LoadProgress& MeshLoadHandle::GetProgress() const
+{
+	assert(m_Progress != nullptr);
+	return *m_Progress;
+}
+
+void MeshLoadHandle::Cancel()
+{
+	assert(m_Progress != nullptr);
+	m_Progress->RequestCancel();
+}
+
+std::unique_ptr<Mesh> MeshLoadHandle::Get()
+{
+	assert(IsValid());
+	return m_Future.get();
+}
+
+MeshLoadHandle AsyncMeshLoader::LoadAsync(const std::filesystem::path& filepath, Core::Parallel::ThreadPool& pool)
+{
+	auto progress = std::make_shared<LoadProgress>();
+	std::future<std::unique_ptr<Mesh>> future = pool.Submit(
+		[filepath, progress]()
+		{
+			// The loading may have been cancelled while waiting in the queue.
+			if(progress->IsCancelRequested())
+			{
+				progress->SetPhase(LoadPhase::Cancelled);
+				return std::unique_ptr<Mesh>();
+			}
+
+			std::unique_ptr<Mesh> mesh = LoadMesh(filepath, *progress);
+			if(mesh == nullptr && progress->GetPhase() != LoadPhase::Cancelled)
+				progress->SetPhase(LoadPhase::Failed);
+			return mesh;
+		});
+
+	return MeshLoadHandle(std::move(progress), std::move(future));
+}
+
+MeshLoadHandle AsyncMeshLoader::LoadAsync(const std::filesystem::path& filepath)
+{
+	return LoadAsync(filepath, Core::Parallel::ThreadPool::GetDefault());
+}
+} // namespace Utilitary::Surface
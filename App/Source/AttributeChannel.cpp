@@ -0,0 +1,93 @@
+#include "Application/AttributeChannel.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Data::Attribute
+{
+bool AttributeChannelSet::Has(std::string_view name) const
+{
+	return Find(name) != nullptr;
+}
+
+bool AttributeChannelSet::Remove(std::string_view name)
+{
+	return std::erase_if(
+			   m_Channels,
+			   [name](const auto& channel)
+			   {
+				   return channel.first == name;
+			   })
+		!= 0;
+}
+
+void AttributeChannelSet::Resize(size_t size)
+{
+	for(auto&& [curName, curChannel] : m_Channels)
+	{
+		if(curChannel->GetSize() != size)
+			Detach(curChannel).Resize(size);
+	}
+}
+
+void AttributeChannelSet::Permute(std::span<const uint32_t> order)
+{
+	for(auto&& [curName, curChannel] : m_Channels)
+		Detach(curChannel).Permute(order);
+}
+
+void AttributeChannelSet::Compact(std::span<const int> newIndices, size_t size)
+{
+	for(auto&& [curName, curChannel] : m_Channels)
+		Detach(curChannel).Compact(newIndices, size);
+}
+
+void AttributeChannelSet::Remap(std::span<const int> oldIndices)
+{
+	for(auto&& [curName, curChannel] : m_Channels)
+		Detach(curChannel).Remap(oldIndices);
+}
+
+void AttributeChannelSet::Clear()
+{
+	m_Channels.clear();
+}
+
+size_t AttributeChannelSet::GetCount() const
+{
+	return m_Channels.size();
+}
+
+std::vector<std::string> AttributeChannelSet::GetNames() const
+{
+	std::vector<std::string> names;
+	names.reserve(m_Channels.size());
+	for(auto&& [curName, curChannel] : m_Channels)
+		names.emplace_back(curName);
+	return names;
+}
+
+const BaseAttributeChannel* AttributeChannelSet::Find(std::string_view name) const
+{
+	auto it = std::ranges::find(m_Channels, name, &decltype(m_Channels)::value_type::first);
+	return it != m_Channels.end() ? it->second.get() : nullptr;
+}
+
+BaseAttributeChannel* AttributeChannelSet::FindToWrite(std::string_view name)
+{
+	auto it = std::ranges::find(m_Channels, name, &decltype(m_Channels)::value_type::first);
+	return it != m_Channels.end() ? &Detach(it->second) : nullptr;
+}
+
+BaseAttributeChannel& AttributeChannelSet::Detach(std::shared_ptr<BaseAttributeChannel>& channel)
+{
+	if(channel.use_count() != 1)
+		channel = channel->Clone();
+	else
+	{
+		// The last reads of the copies released on other threads happen before the writes.
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+	return *channel;
+}
+} // namespace Data::Attribute
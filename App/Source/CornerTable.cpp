@@ -0,0 +1,207 @@
+#include "Application/CornerTable.h"
+
+#include "Core/ParallelHelpers.h"
+
+#include <cassert>
+
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Minimal number of triangles or vertices processed by a thread.
+constexpr size_t CornerTableGrainSize = 4096;
+} // namespace
+
+namespace Data::Surface
+{
+CornerTable CornerTable::FromMesh(const Mesh& mesh, uint32_t threadCount)
+{
+	const Core::Container::ChunkedSpan<const Vertex> vertices = mesh.GetVertices();
+	const Core::Container::ChunkedSpan<const Triangle> triangles = mesh.GetTriangles();
+	const NeighborEdgeSlots* neighborEdgeSlots =
+		mesh.HasNeighborEdgeSlots() ? mesh.GetNeighborEdgeSlots().data() : nullptr;
+
+	CornerTable table;
+	table.m_Positions.resize(vertices.size());
+	table.m_VertexCorners.resize(vertices.size());
+	table.m_CornerVertices.resize(3 * triangles.size());
+	table.m_OppositeCorners.resize(3 * triangles.size());
+
+	Core::Parallel::For(
+		vertices.size(),
+		[&](size_t iVertex)
+		{
+			const Vertex& curVertex = vertices[iVertex];
+			table.m_Positions[iVertex] = curVertex.Position;
+			table.m_VertexCorners[iVertex] = InvalidCorner;
+			if(curVertex.IncidentTriangleIdx == -1)
+				return;
+
+			const int localIdx = Utilitary::Primitive::GetVertexLocalIndex(
+				triangles[curVertex.IncidentTriangleIdx], static_cast<VertexIndex>(iVertex));
+			assert(localIdx != -1); // The incident triangle must contain the vertex.
+			table.m_VertexCorners[iVertex] = 3 * curVertex.IncidentTriangleIdx + localIdx;
+		},
+		CornerTableGrainSize,
+		threadCount);
+
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& curTriangle = triangles[iTriangle];
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				const size_t curCorner = 3 * iTriangle + iEdge;
+				table.m_CornerVertices[curCorner] = static_cast<VertexIndex>(curTriangle.Vertices[iEdge]);
+				table.m_OppositeCorners[curCorner] = InvalidCorner;
+
+				const int neighborIdx = curTriangle.Neighbors[iEdge];
+				if(neighborIdx == -1)
+					continue;
+
+				// The corner facing the shared edge in the neighbor has the index of the edge in the neighbor.
+				EdgeIndex neighborEdgeIdx = NeighborEdgeSlots::NoEdge;
+				if(neighborEdgeSlots != nullptr)
+				{
+					neighborEdgeIdx = neighborEdgeSlots[iTriangle].Get(iEdge);
+				}
+				else
+				{ // Search the shared edge, going in the opposite direction in the neighbor.
+					const Triangle& neighbor = triangles[neighborIdx];
+					const int firstVertexIdx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
+					const int secondVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+					for(EdgeIndex iNeighborEdge = 0; iNeighborEdge < 3; ++iNeighborEdge)
+					{
+						if(neighbor.Vertices[IndexHelpers::Next[iNeighborEdge]] == secondVertexIdx
+						   && neighbor.Vertices[IndexHelpers::Previous[iNeighborEdge]] == firstVertexIdx)
+							neighborEdgeIdx = iNeighborEdge;
+					}
+				}
+				if(neighborEdgeIdx != NeighborEdgeSlots::NoEdge)
+					table.m_OppositeCorners[curCorner] = 3 * neighborIdx + neighborEdgeIdx;
+			}
+		},
+		CornerTableGrainSize,
+		threadCount);
+
+	// The channel sets are copy-on-write: the storage is shared until written.
+	table.m_VertexAttributes = mesh.GetVertexAttributes();
+	table.m_TriangleAttributes = mesh.GetTriangleAttributes();
+	return table;
+}
+
+Mesh CornerTable::ToMesh(uint32_t threadCount) const
+{
+	Mesh mesh;
+	mesh.m_Vertices = Core::Container::ChunkedCowVector<Vertex>(std::vector<Vertex>(m_Positions.size()));
+	mesh.m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::vector<Triangle>(GetTriangleCount()));
+	const Core::Container::ChunkedSpan<Vertex> vertices = mesh.m_Vertices.Write();
+	const Core::Container::ChunkedSpan<Triangle> triangles = mesh.m_Triangles.Write();
+	std::vector<NeighborEdgeSlots>& slots = mesh.m_NeighborEdgeSlots.Write();
+	slots.resize(GetTriangleCount());
+
+	Core::Parallel::For(
+		m_Positions.size(),
+		[&](size_t iVertex)
+		{
+			const CornerIndex curCorner = m_VertexCorners[iVertex];
+			vertices[iVertex] = { .Position = m_Positions[iVertex],
+								  .IncidentTriangleIdx = curCorner == InvalidCorner ? -1 : curCorner / 3 };
+		},
+		CornerTableGrainSize,
+		threadCount);
+
+	Core::Parallel::For(
+		GetTriangleCount(),
+		[&](size_t iTriangle)
+		{
+			Triangle& curTriangle = triangles[iTriangle];
+			NeighborEdgeSlots curSlots;
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				const size_t curCorner = 3 * iTriangle + iEdge;
+				curTriangle.Vertices[iEdge] = static_cast<int>(m_CornerVertices[curCorner]);
+
+				const CornerIndex opposite = m_OppositeCorners[curCorner];
+				if(opposite == InvalidCorner)
+					continue;
+				curTriangle.Neighbors[iEdge] = opposite / 3;
+				curSlots.Set(iEdge, static_cast<EdgeIndex>(opposite % 3));
+			}
+			slots[iTriangle] = curSlots;
+		},
+		CornerTableGrainSize,
+		threadCount);
+
+	mesh.m_VertexAttributes = m_VertexAttributes;
+	mesh.m_TriangleAttributes = m_TriangleAttributes;
+	return mesh;
+}
+
+uint32_t CornerTable::GetVertexCount() const
+{
+	return static_cast<uint32_t>(m_Positions.size());
+}
+
+uint32_t CornerTable::GetTriangleCount() const
+{
+	return static_cast<uint32_t>(m_CornerVertices.size() / 3);
+}
+
+uint32_t CornerTable::GetCornerCount() const
+{
+	return static_cast<uint32_t>(m_CornerVertices.size());
+}
+
+std::span<Vec3> CornerTable::GetPositions()
+{
+	return m_Positions;
+}
+
+std::span<const Vec3> CornerTable::GetPositions() const
+{
+	return m_Positions;
+}
+
+std::span<const VertexIndex> CornerTable::GetCornerVertices() const
+{
+	return m_CornerVertices;
+}
+
+std::span<const CornerTable::CornerIndex> CornerTable::GetOppositeCorners() const
+{
+	return m_OppositeCorners;
+}
+
+Data::Attribute::AttributeChannelSet& CornerTable::GetVertexAttributes()
+{
+	return m_VertexAttributes;
+}
+
+const Data::Attribute::AttributeChannelSet& CornerTable::GetVertexAttributes() const
+{
+	return m_VertexAttributes;
+}
+
+Data::Attribute::AttributeChannelSet& CornerTable::GetTriangleAttributes()
+{
+	return m_TriangleAttributes;
+}
+
+const Data::Attribute::AttributeChannelSet& CornerTable::GetTriangleAttributes() const
+{
+	return m_TriangleAttributes;
+}
+
+CornerTable::VerticesAroundVertexRange CornerTable::GetVerticesAroundVertex(VertexIndex index) const
+{
+	return VerticesAroundVertexRange(*this, m_VertexCorners[index]);
+}
+
+CornerTable::TrianglesAroundVertexRange CornerTable::GetTrianglesAroundVertex(VertexIndex index) const
+{
+	return TrianglesAroundVertexRange(*this, m_VertexCorners[index]);
+}
+} // namespace Data::Surface
@@ -1,9 +1,18 @@
 #include "Application/Mesh.h"
 
 #include "Application/ExtraDataType.h"
+#include "Application/MeshBoundary.h"
+#include "Application/MeshConnectivity.h"
+#include "Application/MeshNormals.h"
+#include "Application/OneRingAdjacency.h"
 #include "Application/PrimitiveProxy.h"
-#include "Application/VertexPair.h"
 #include "Core/MathHelpers.h"
+#include "Core/ParallelHelpers.h"
+#include "Core/PrintHelpers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 
 using namespace Core::BaseType;
 using namespace Core::Math::Geometry;
@@ -11,23 +20,228 @@ using namespace Data::Primitive;
 using namespace Data::ExtraData;
 using namespace Utilitary::Primitive;
 
-#include <numeric>
+namespace
+{
+/// @brief Minimal number of vertices or triangles processed by a thread.
+constexpr size_t MeshGrainSize = 4096;
+
+/// @brief Compute the normal of a triangle, as stored in TriangleNormalExtraData.
+Vec3 ComputeTriangleNormal(const Core::Container::ChunkedCowVector<Vertex>& vertices,
+						   const Triangle& triangle,
+						   bool normalize)
+{
+	// Get each vertex position.
+	const Vec3& posA = vertices[triangle.Vertices[0]].Position;
+	const Vec3& posB = vertices[triangle.Vertices[1]].Position;
+	const Vec3& posC = vertices[triangle.Vertices[2]].Position;
+
+	const Vec3 AB = Normalize(posB - posA);
+	const Vec3 AC = Normalize(posC - posA);
+
+	Vec3 computedNormal = Cross(AB, AC);
+	if(normalize)
+		computedNormal = Normalize(computedNormal);
+	return computedNormal;
+}
+
+/// @brief Get the normal stored on each triangle (see ComputeTriangleNormals), or nothing if a triangle has none.
+std::vector<Vec3> GetStoredTriangleNormals(const std::vector<ExtraDataContainer>& containers, size_t triangleCount)
+{
+	if(containers.size() != triangleCount)
+		return {};
+
+	std::vector<Vec3> normals(triangleCount);
+	std::atomic<bool> hasAllNormals = true;
+	Core::Parallel::For(
+		triangleCount,
+		[&](size_t iTriangle)
+		{
+			if(const TriangleNormalExtraData* curNormal = containers[iTriangle].Get<TriangleNormalExtraData>())
+				normals[iTriangle] = curNormal->GetData();
+			else
+				hasAllNormals.store(false, std::memory_order_relaxed);
+		},
+		MeshGrainSize);
+	if(!hasAllNormals.load(std::memory_order_relaxed))
+		return {};
+	return normals;
+}
+
+/// @brief Warn about the edges left without neighbors by the connectivity.
+void WarnNonManifoldEdges(const Utilitary::Surface::ConnectivityReport& report)
+{
+	if(!report.IsManifold())
+		Warning("The mesh has {} non-manifold edges, left without neighbors.", report.NonManifoldEdges.size());
+}
+
+/// @brief Number the kept elements in order, the removed ones being mapped to -1.
+/// @param newIndices New index of each element, to fill.
+/// @param isKept Function returning whether an element is kept, from its index.
+/// @param rangeCount Number of ranges processed in parallel.
+/// @return Number of kept elements.
+template<typename IsKeptFunc>
+size_t ComputeCompactionMap(std::span<int> newIndices, IsKeptFunc&& isKept, uint32_t rangeCount)
+{
+	// Count the kept elements of each range, then number them from the offset of their range.
+	std::vector<size_t> rangeOffsets(rangeCount + 1, 0);
+	Core::Parallel::ForEachRange(
+		newIndices.size(),
+		rangeCount,
+		[&](uint32_t iRange, size_t begin, size_t end)
+		{
+			for(size_t iElement = begin; iElement < end; ++iElement)
+				rangeOffsets[iRange + 1] += isKept(iElement) ? 1 : 0;
+		});
+	std::inclusive_scan(rangeOffsets.begin(), rangeOffsets.end(), rangeOffsets.begin());
+
+	Core::Parallel::ForEachRange(
+		newIndices.size(),
+		rangeCount,
+		[&](uint32_t iRange, size_t begin, size_t end)
+		{
+			int nextIdx = static_cast<int>(rangeOffsets[iRange]);
+			for(size_t iElement = begin; iElement < end; ++iElement)
+				newIndices[iElement] = isKept(iElement) ? nextIdx++ : -1;
+		});
+	return rangeOffsets.back();
+}
+
+/// @brief Set an index to a smaller one, other threads setting it concurrently (-1 being greater than any index).
+void SetMinIndexAtomic(int& index, int value)
+{
+	std::atomic_ref<int> atomicIndex(index);
+	int curIndex = atomicIndex.load(std::memory_order_relaxed);
+	while((curIndex == -1 || curIndex > value)
+		  && !atomicIndex.compare_exchange_weak(curIndex, value, std::memory_order_relaxed))
+	{
+	}
+}
+
+/// @brief Move each kept value to its new index in place, and drop the others.
+/// @param values Values to compact.
+/// @param newIndices New index of each value, -1 if it is removed.
+/// @param rangeCount Number of ranges processed in parallel.
+/// @param update Function called on each kept value with its new index, once moved.
+/// @note Each range packs its kept values at its beginning in parallel, then the packed ranges are moved down in
+/// order. A value never moves past its old index, so no other buffer is needed.
+template<typename T, typename UpdateFunc>
+void CompactValues(std::vector<T>& values, std::span<const int> newIndices, uint32_t rangeCount, UpdateFunc&& update)
+{
+	assert(values.size() == newIndices.size() && "There must be a new index per value");
+	std::vector<size_t> packedEnds(rangeCount, 0);
+	Core::Parallel::ForEachRange(
+		values.size(),
+		rangeCount,
+		[&](uint32_t iRange, size_t begin, size_t end)
+		{
+			size_t packedEnd = begin;
+			for(size_t iValue = begin; iValue < end; ++iValue)
+			{
+				if(newIndices[iValue] == -1)
+					continue;
+				if(packedEnd != iValue)
+					values[packedEnd] = std::move(values[iValue]);
+				update(values[packedEnd], static_cast<size_t>(newIndices[iValue]));
+				++packedEnd;
+			}
+			packedEnds[iRange] = packedEnd;
+		});
+
+	size_t newCount = 0;
+	for(uint32_t iRange = 0; iRange < rangeCount; ++iRange)
+	{
+		const size_t curBegin = Core::Parallel::GetRangeBegin(values.size(), rangeCount, iRange);
+		if(newCount != curBegin)
+			std::move(values.begin() + curBegin, values.begin() + packedEnds[iRange], values.begin() + newCount);
+		newCount += packedEnds[iRange] - curBegin;
+	}
+	values.erase(values.begin() + newCount, values.end());
+}
+} // namespace
 
 namespace Data::Surface
 {
+Mesh::Mesh(std::span<const Vec3> positions,
+		   std::span<const std::array<int, 3>> triangleVertices,
+		   bool buildConnectivity,
+		   uint32_t threadCount)
+	: m_Vertices(std::vector<Vertex>(positions.size()))
+	, m_Triangles(std::vector<Triangle>(triangleVertices.size()))
+{
+	const Core::Container::ChunkedSpan<Vertex> vertices = m_Vertices.Write();
+	Core::Parallel::For(
+		positions.size(),
+		[&](size_t iVertex)
+		{
+			vertices[iVertex].Position = positions[iVertex];
+		},
+		MeshGrainSize,
+		threadCount);
+	const Core::Container::ChunkedSpan<Triangle> triangles = m_Triangles.Write();
+	Core::Parallel::For(
+		triangleVertices.size(),
+		[&](size_t iTriangle)
+		{
+			triangles[iTriangle].Vertices = triangleVertices[iTriangle];
+		},
+		MeshGrainSize,
+		threadCount);
+
+	if(buildConnectivity)
+		WarnNonManifoldEdges(Utilitary::Surface::MeshConnectivity::Build(*this, threadCount));
+}
+
+Mesh::Mesh(std::vector<Vertex>&& vertices,
+		   std::vector<Triangle>&& triangles,
+		   bool buildConnectivity,
+		   uint32_t threadCount)
+	: m_Vertices(std::move(vertices))
+	, m_Triangles(std::move(triangles))
+{
+	if(buildConnectivity)
+		WarnNonManifoldEdges(Utilitary::Surface::MeshConnectivity::Build(*this, threadCount));
+}
+
 Mesh::Mesh(const Mesh& other)
 	: m_Vertices(other.m_Vertices)
 	, m_Triangles(other.m_Triangles)
 	, m_VerticesExtraDataContainer(other.m_VerticesExtraDataContainer)
 	, m_TrianglesExtraDataContainer(other.m_TrianglesExtraDataContainer)
+	, m_VertexAttributes(other.m_VertexAttributes)
+	, m_TriangleAttributes(other.m_TriangleAttributes)
+	, m_EdgeAttributes(other.m_EdgeAttributes)
+	, m_NeighborEdgeSlots(other.m_NeighborEdgeSlots)
+	, m_Edges(other.m_Edges)
+	, m_TriangleEdges(other.m_TriangleEdges)
+	, m_HasEdges(other.m_HasEdges)
+	, m_OneRingAdjacency(other.m_OneRingAdjacency)
+	, m_DirtyVertices(other.m_DirtyVertices)
+	, m_IsVertexDirty(other.m_IsVertexDirty)
+	, m_IsVertexDeleted(other.m_IsVertexDeleted)
+	, m_IsTriangleDeleted(other.m_IsTriangleDeleted)
+	, m_DeletedVertexCount(other.m_DeletedVertexCount)
+	, m_DeletedTriangleCount(other.m_DeletedTriangleCount)
 {}
 
+Mesh& Mesh::operator=(const Mesh& other)
+{
+	// Copy and swap: the copy shares the arrays of the other mesh, and the arrays of this mesh are released.
+	Mesh copy(other);
+	*this = std::move(copy);
+	return *this;
+}
+
 /// @brief Get the number of faces in the mesh.
 std::unique_ptr<Mesh> Mesh::Clone() const
 {
 	return std::make_unique<Mesh>(*this);
 }
 
+std::shared_ptr<const Mesh> Mesh::CreateSnapshot() const
+{
+	return std::make_shared<const Mesh>(*this);
+}
+
 uint32_t Mesh::GetVertexCount() const
 {
 	return static_cast<uint32_t>(m_Vertices.size());
@@ -59,7 +273,7 @@ const Vertex& Mesh::GetVertexData(const VertexIndex index) const
 Vertex& Mesh::GetVertexData(const VertexIndex index)
 {
 	assert(index < GetVertexCount() && "Index out of bound");
-	return m_Vertices[index];
+	return m_Vertices.Write(index);
 }
 
 const Triangle& Mesh::GetTriangleData(const TriangleIndex index) const
@@ -68,110 +282,494 @@ const Triangle& Mesh::GetTriangleData(const TriangleIndex index) const
 	return m_Triangles[index];
 }
 
-Triangle& Mesh::GetTriangleData(const TriangleIndex index)
+void Mesh::SetTriangleData(const TriangleIndex index, const Triangle& triangle)
 {
 	assert(index < GetTriangleCount() && "Index out of bound");
-	return m_Triangles[index];
+	OnTrianglesEdited();
+	m_Triangles.Write(index) = triangle;
+}
+
+void Mesh::Reserve(size_t vertexCount, size_t triangleCount)
+{
+	m_Vertices.reserve(vertexCount);
+	m_Triangles.reserve(triangleCount);
+	if(!m_VerticesExtraDataContainer.empty())
+		m_VerticesExtraDataContainer.Write().reserve(vertexCount);
+	if(!m_TrianglesExtraDataContainer.empty())
+		m_TrianglesExtraDataContainer.Write().reserve(triangleCount);
 }
 
 VertexIndex Mesh::AddVertex(const Vertex& vertex)
 {
 	VertexIndex index = static_cast<VertexIndex>(m_Vertices.size());
 	if(!m_Vertices.empty() && m_VerticesExtraDataContainer.size() == m_Vertices.size())
-		m_VerticesExtraDataContainer.emplace_back();
+		m_VerticesExtraDataContainer.Write().emplace_back();
 	m_Vertices.emplace_back(vertex);
+	m_VertexAttributes.Resize(m_Vertices.size());
+	m_OneRingAdjacency.reset();
 	return index;
 }
 
 TriangleIndex Mesh::AddTriangle(const Triangle& triangle)
 {
 	TriangleIndex index = static_cast<TriangleIndex>(m_Triangles.size());
+	if(HasEdges())
+		AddTriangleEdges(triangle);
 	if(!m_Triangles.empty() && m_TrianglesExtraDataContainer.size() == m_Triangles.size())
-		m_TrianglesExtraDataContainer.emplace_back();
+		m_TrianglesExtraDataContainer.Write().emplace_back();
 	m_Triangles.emplace_back(triangle);
+	m_TriangleAttributes.Resize(m_Triangles.size());
+	m_NeighborEdgeSlots = {};
+	m_OneRingAdjacency.reset();
 	return index;
 }
 
-void Mesh::AddVerticesExtraDataContainer()
+void Mesh::OnTrianglesEdited()
 {
-	if(!m_VerticesExtraDataContainer.empty())
-		m_VerticesExtraDataContainer.clear();
-	m_VerticesExtraDataContainer.resize(GetVertexCount());
+	m_NeighborEdgeSlots = {};
+	m_OneRingAdjacency.reset();
+	m_Edges = {};
+	m_TriangleEdges = {};
+	m_EdgeAttributes.Resize(0);
+	m_HasEdges = false;
 }
 
-void Mesh::AddTrianglesExtraDataContainer()
+void Mesh::AddTriangleEdges(const Triangle& triangle)
 {
-	if(!m_TrianglesExtraDataContainer.empty())
-		m_TrianglesExtraDataContainer.clear();
-	m_TrianglesExtraDataContainer.resize(GetTriangleCount());
+	const int triangleIdx = static_cast<int>(m_Triangles.size());
+	std::vector<Edge>& edges = m_Edges.Write();
+	std::array<int, 3> edgeIndices{ -1, -1, -1 };
+	for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+	{
+		const auto [minVertexIdx, maxVertexIdx] = std::minmax(triangle.Vertices[IndexHelpers::Next[iEdge]],
+															  triangle.Vertices[IndexHelpers::Previous[iEdge]]);
+		const std::array<int, 2> edgeVertices{ minVertexIdx, maxVertexIdx };
+
+		// Reuse the edge of the neighbor across the edge, if it has it.
+		const int neighborIdx = triangle.Neighbors[iEdge];
+		if(neighborIdx >= 0 && neighborIdx < triangleIdx)
+		{
+			for(int curEdgeIdx : m_TriangleEdges[neighborIdx])
+			{
+				if(edges[curEdgeIdx].Vertices == edgeVertices)
+					edgeIndices[iEdge] = curEdgeIdx;
+			}
+		}
+
+		if(edgeIndices[iEdge] == -1)
+		{
+			edgeIndices[iEdge] = static_cast<int>(edges.size());
+			edges.push_back({ .Vertices = edgeVertices, .TriangleIdx = triangleIdx, .EdgeIdx = iEdge });
+		}
+	}
+	m_TriangleEdges.Write().push_back(edgeIndices);
+	m_EdgeAttributes.Resize(edges.size());
 }
 
-void Mesh::UpdateMeshConnectivity()
+void Mesh::DeleteVertex(const VertexIndex index)
 {
-	std::unordered_map<VertexPair, std::pair<TriangleIndex, EdgeIndex>> neighborMap;
+	assert(index < GetVertexCount() && "Index out of bound");
+	if(m_IsVertexDeleted.GetSize() < m_Vertices.size())
+		m_IsVertexDeleted.Resize(m_Vertices.size());
 
-	for(TriangleIndex iTriangle = 0; iTriangle < GetTriangleCount(); ++iTriangle)
+	if(!m_IsVertexDeleted.Get(index))
 	{
-		Triangle& curTriangle = m_Triangles[iTriangle];
+		m_IsVertexDeleted.Set(index);
+		++m_DeletedVertexCount;
+	}
+}
+
+void Mesh::DeleteTriangle(const TriangleIndex index)
+{
+	assert(index < GetTriangleCount() && "Index out of bound");
+	if(m_IsTriangleDeleted.GetSize() < m_Triangles.size())
+		m_IsTriangleDeleted.Resize(m_Triangles.size());
+
+	if(!m_IsTriangleDeleted.Get(index))
+	{
+		m_IsTriangleDeleted.Set(index);
+		++m_DeletedTriangleCount;
+	}
+}
 
-		// Set the incident triangle index for each vertex if it's not already the case.
-		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+bool Mesh::IsVertexDeleted(const VertexIndex index) const
+{
+	assert(index < GetVertexCount() && "Index out of bound");
+	return index < m_IsVertexDeleted.GetSize() && m_IsVertexDeleted.Get(index);
+}
+
+bool Mesh::IsTriangleDeleted(const TriangleIndex index) const
+{
+	assert(index < GetTriangleCount() && "Index out of bound");
+	return index < m_IsTriangleDeleted.GetSize() && m_IsTriangleDeleted.Get(index);
+}
+
+size_t Mesh::GetDeletedVertexCount() const
+{
+	return m_DeletedVertexCount;
+}
+
+size_t Mesh::GetDeletedTriangleCount() const
+{
+	return m_DeletedTriangleCount;
+}
+
+bool Mesh::HasGarbage() const
+{
+	return m_DeletedVertexCount > 0 || m_DeletedTriangleCount > 0;
+}
+
+CompactionMaps Mesh::GarbageCollect(uint32_t threadCount)
+{
+	const bool hasEdges = HasEdges();
+	CompactionMaps maps;
+	maps.VertexMap.resize(m_Vertices.size());
+	maps.TriangleMap.resize(m_Triangles.size());
+	maps.EdgeMap.resize(hasEdges ? m_Edges.size() : 0);
+	if(!HasGarbage())
+	{
+		std::iota(maps.VertexMap.begin(), maps.VertexMap.end(), 0);
+		std::iota(maps.TriangleMap.begin(), maps.TriangleMap.end(), 0);
+		std::iota(maps.EdgeMap.begin(), maps.EdgeMap.end(), 0);
+		return maps;
+	}
+
+	const uint32_t vertexRangeCount = Core::Parallel::GetRangeCount(m_Vertices.size(), MeshGrainSize, threadCount);
+	const uint32_t triangleRangeCount = Core::Parallel::GetRangeCount(m_Triangles.size(), MeshGrainSize, threadCount);
+
+	// A triangle using a deleted vertex is removed too.
+	const size_t vertexCount = ComputeCompactionMap(
+		maps.VertexMap,
+		[this](size_t iVertex)
+		{
+			return !IsVertexDeleted(static_cast<VertexIndex>(iVertex));
+		},
+		vertexRangeCount);
+	const size_t triangleCount = ComputeCompactionMap(
+		maps.TriangleMap,
+		[this](size_t iTriangle)
 		{
-			int curVertexIdx = curTriangle.Vertices[iEdge];
-			assert(curVertexIdx != -1);
+			return !IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle))
+				&& std::ranges::none_of(m_Triangles[iTriangle].Vertices,
+										[this](int vertexIdx)
+										{
+											return IsVertexDeleted(static_cast<VertexIndex>(vertexIdx));
+										});
+		},
+		triangleRangeCount);
+
+	// The vertices whose incident triangle is removed are marked to get another one.
+	Core::Container::BitArray hasLostIncidentTriangle(vertexCount);
+	std::vector<Vertex> vertices = m_Vertices.Extract();
+	CompactValues(vertices,
+				  maps.VertexMap,
+				  vertexRangeCount,
+				  [&](Vertex& vertex, size_t newVertexIdx)
+				  {
+					  if(vertex.IncidentTriangleIdx == -1)
+						  return;
+					  vertex.IncidentTriangleIdx = maps.TriangleMap[vertex.IncidentTriangleIdx];
+					  if(vertex.IncidentTriangleIdx == -1)
+						  hasLostIncidentTriangle.SetAtomic(newVertexIdx);
+				  });
+	std::vector<Triangle> triangles = m_Triangles.Extract();
+	CompactValues(triangles,
+				  maps.TriangleMap,
+				  triangleRangeCount,
+				  [&](Triangle& triangle, size_t)
+				  {
+					  for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+					  {
+						  triangle.Vertices[iEdge] = maps.VertexMap[triangle.Vertices[iEdge]];
+						  if(triangle.Neighbors[iEdge] != -1)
+							  triangle.Neighbors[iEdge] = maps.TriangleMap[triangle.Neighbors[iEdge]];
+					  }
+				  });
+	assert(vertices.size() == vertexCount && triangles.size() == triangleCount && "Compaction mismatch");
+
+	// Give the smallest remaining triangle to the vertices which lost their incident triangle, so the result does
+	// not depend on the number of threads.
+	if(hasLostIncidentTriangle.FindNext(0) != vertexCount)
+	{
+		Core::Parallel::For(
+			triangleCount,
+			[&](size_t iTriangle)
+			{
+				for(int curVertexIdx : triangles[iTriangle].Vertices)
+				{
+					if(hasLostIncidentTriangle.Get(curVertexIdx))
+						SetMinIndexAtomic(vertices[curVertexIdx].IncidentTriangleIdx, static_cast<int>(iTriangle));
+				}
+			},
+			MeshGrainSize,
+			threadCount);
+	}
+	m_Vertices = Core::Container::ChunkedCowVector<Vertex>(std::move(vertices));
+	m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::move(triangles));
 
-			Vertex& curVertex = m_Vertices[curVertexIdx];
+	// The edges shared with a removed triangle become boundary edges.
+	if(m_NeighborEdgeSlots.size() == maps.TriangleMap.size())
+	{
+		CompactValues(m_NeighborEdgeSlots.Write(),
+					  maps.TriangleMap,
+					  triangleRangeCount,
+					  [&](NeighborEdgeSlots& slots, size_t newTriangleIdx)
+					  {
+						  for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+						  {
+							  if(m_Triangles[newTriangleIdx].Neighbors[iEdge] == -1)
+								  slots.Set(iEdge, NeighborEdgeSlots::NoEdge);
+						  }
+					  });
+	}
+	else
+		m_NeighborEdgeSlots = {};
+
+	if(hasEdges)
+		CompactEdges(maps, triangleRangeCount, threadCount);
+
+	const auto KeepExtraData = [](ExtraDataContainer&, size_t) {};
+	if(m_VerticesExtraDataContainer.size() == maps.VertexMap.size())
+		CompactValues(m_VerticesExtraDataContainer.Write(), maps.VertexMap, vertexRangeCount, KeepExtraData);
+	if(m_TrianglesExtraDataContainer.size() == maps.TriangleMap.size())
+		CompactValues(m_TrianglesExtraDataContainer.Write(), maps.TriangleMap, triangleRangeCount, KeepExtraData);
+	m_VertexAttributes.Compact(maps.VertexMap, vertexCount);
+	m_TriangleAttributes.Compact(maps.TriangleMap, triangleCount);
+
+	// The dirty vertices keep their marking order.
+	if(!m_DirtyVertices.empty())
+	{
+		std::vector<VertexIndex>& dirtyVertices = m_DirtyVertices.Write();
+		std::erase_if(dirtyVertices,
+					  [&](VertexIndex vertexIdx)
+					  {
+						  return maps.VertexMap[vertexIdx] == -1;
+					  });
+		for(VertexIndex& curVertexIdx : dirtyVertices)
+			curVertexIdx = static_cast<VertexIndex>(maps.VertexMap[curVertexIdx]);
+	}
+	if(!m_IsVertexDirty.empty())
+	{
+		std::vector<bool>& isVertexDirty = m_IsVertexDirty.Write();
+		isVertexDirty.assign(vertexCount, false);
+		for(VertexIndex curVertexIdx : m_DirtyVertices)
+			isVertexDirty[curVertexIdx] = true;
+	}
 
-			if(curVertex.IncidentTriangleIdx == -1)
-				curVertex.IncidentTriangleIdx = iTriangle;
-		}
+	m_IsVertexDeleted = {};
+	m_IsTriangleDeleted = {};
+	m_DeletedVertexCount = 0;
+	m_DeletedTriangleCount = 0;
+	m_OneRingAdjacency.reset();
+	return maps;
+}
 
-		// Set neighboring faces using the edges
-		auto SetFacesNeigbhor = [&](VertexIndex firstVertexIdx, VertexIndex secondVertexIdx, uint8_t edgeIdx)
+void Mesh::CompactEdges(CompactionMaps& maps, uint32_t triangleRangeCount, uint32_t threadCount)
+{
+	// The edges of the kept triangles are kept.
+	Core::Container::BitArray isEdgeKept(m_Edges.size());
+	Core::Parallel::For(
+		maps.TriangleMap.size(),
+		[&](size_t iTriangle)
 		{
-			if(neighborMap.find({ firstVertexIdx, secondVertexIdx }) == neighborMap.end())
+			if(maps.TriangleMap[iTriangle] == -1)
+				return;
+			for(int curEdgeIdx : m_TriangleEdges[iTriangle])
+				isEdgeKept.SetAtomic(curEdgeIdx);
+		},
+		MeshGrainSize,
+		threadCount);
+
+	const uint32_t edgeRangeCount = Core::Parallel::GetRangeCount(m_Edges.size(), MeshGrainSize, threadCount);
+	const size_t edgeCount = ComputeCompactionMap(
+		maps.EdgeMap,
+		[&isEdgeKept](size_t iEdge)
+		{
+			return isEdgeKept.Get(iEdge);
+		},
+		edgeRangeCount);
+
+	std::vector<std::array<int, 3>>& triangleEdges = m_TriangleEdges.Write();
+	CompactValues(triangleEdges,
+				  maps.TriangleMap,
+				  triangleRangeCount,
+				  [&](std::array<int, 3>& edgeIndices, size_t)
+				  {
+					  for(int& curEdgeIdx : edgeIndices)
+						  curEdgeIdx = maps.EdgeMap[curEdgeIdx];
+				  });
+
+	// The vertices of a kept edge are kept in the same order. The edges whose triangle is removed are marked to get
+	// another one.
+	Core::Container::BitArray hasLostTriangle(edgeCount);
+	std::vector<Edge>& edges = m_Edges.Write();
+	CompactValues(edges,
+				  maps.EdgeMap,
+				  edgeRangeCount,
+				  [&](Edge& edge, size_t newEdgeIdx)
+				  {
+					  for(int& curVertexIdx : edge.Vertices)
+						  curVertexIdx = maps.VertexMap[curVertexIdx];
+					  edge.TriangleIdx = maps.TriangleMap[edge.TriangleIdx];
+					  if(edge.TriangleIdx == -1)
+						  hasLostTriangle.SetAtomic(newEdgeIdx);
+				  });
+
+	// Give them their first remaining triangle, so the result does not depend on the number of threads.
+	if(hasLostTriangle.FindNext(0) != edgeCount)
+	{
+		Core::Parallel::For(
+			triangleEdges.size(),
+			[&](size_t iTriangle)
 			{
-				neighborMap[{ firstVertexIdx, secondVertexIdx }] = { iTriangle, edgeIdx };
-			}
-			else // The edge with firstVertex and secondVertex is already registered in map
+				for(int curEdgeIdx : triangleEdges[iTriangle])
+				{
+					if(hasLostTriangle.Get(curEdgeIdx))
+						SetMinIndexAtomic(edges[curEdgeIdx].TriangleIdx, static_cast<int>(iTriangle));
+				}
+			},
+			MeshGrainSize,
+			threadCount);
+		Core::Parallel::For(
+			edgeCount,
+			[&](size_t iEdge)
 			{
-				auto [faceNeighborIdx, neighborEdgeIdx] = neighborMap[{ firstVertexIdx, secondVertexIdx }];
-				m_Triangles[faceNeighborIdx].Neighbors[neighborEdgeIdx] = iTriangle;
-				curTriangle.Neighbors[edgeIdx] = faceNeighborIdx;
-			}
-		};
-
-		const VertexIndex v0Idx = static_cast<VertexIndex>(curTriangle.Vertices[0]);
-		const VertexIndex v1Idx = static_cast<VertexIndex>(curTriangle.Vertices[1]);
-		const VertexIndex v2Idx = static_cast<VertexIndex>(curTriangle.Vertices[2]);
-
-		// Edge v0-v1
-		SetFacesNeigbhor(v0Idx, v1Idx, 2);
-		// Edge v1-v2
-		SetFacesNeigbhor(v1Idx, v2Idx, 0);
-		// Edge v2-v0
-		SetFacesNeigbhor(v2Idx, v0Idx, 1);
+				if(!hasLostTriangle.Get(iEdge))
+					return;
+				const std::array<int, 3>& edgeIndices = triangleEdges[edges[iEdge].TriangleIdx];
+				const auto edgeIt = std::ranges::find(edgeIndices, static_cast<int>(iEdge));
+				edges[iEdge].EdgeIdx = static_cast<EdgeIndex>(edgeIt - edgeIndices.begin());
+			},
+			MeshGrainSize,
+			threadCount);
 	}
+
+	m_EdgeAttributes.Compact(maps.EdgeMap, edgeCount);
 }
 
-std::vector<Data::Primitive::Vertex>& Mesh::GetVertices()
+void Mesh::AddVerticesExtraDataContainer()
 {
-	return m_Vertices;
+	m_VerticesExtraDataContainer = Core::Container::CowVector<ExtraDataContainer>(
+		std::vector<ExtraDataContainer>(GetVertexCount()));
+}
+
+void Mesh::AddTrianglesExtraDataContainer()
+{
+	m_TrianglesExtraDataContainer = Core::Container::CowVector<ExtraDataContainer>(
+		std::vector<ExtraDataContainer>(GetTriangleCount()));
+}
+
+bool Mesh::HasVertexAttribute(std::string_view name) const
+{
+	return m_VertexAttributes.Has(name);
+}
+
+void Mesh::RemoveVertexAttribute(std::string_view name)
+{
+	m_VertexAttributes.Remove(name);
+}
+
+const Data::Attribute::AttributeChannelSet& Mesh::GetVertexAttributes() const
+{
+	return m_VertexAttributes;
+}
+
+bool Mesh::HasTriangleAttribute(std::string_view name) const
+{
+	return m_TriangleAttributes.Has(name);
+}
+
+void Mesh::RemoveTriangleAttribute(std::string_view name)
+{
+	m_TriangleAttributes.Remove(name);
+}
+
+const Data::Attribute::AttributeChannelSet& Mesh::GetTriangleAttributes() const
+{
+	return m_TriangleAttributes;
+}
+
+bool Mesh::HasEdgeAttribute(std::string_view name) const
+{
+	return m_EdgeAttributes.Has(name);
+}
+
+void Mesh::RemoveEdgeAttribute(std::string_view name)
+{
+	m_EdgeAttributes.Remove(name);
+}
+
+const Data::Attribute::AttributeChannelSet& Mesh::GetEdgeAttributes() const
+{
+	return m_EdgeAttributes;
+}
+
+void Mesh::UpdateMeshConnectivity()
+{
+	WarnNonManifoldEdges(Utilitary::Surface::MeshConnectivity::Build(*this));
+}
+
+bool Mesh::HasNeighborEdgeSlots() const
+{
+	return m_NeighborEdgeSlots.size() == m_Triangles.size();
+}
+
+const std::vector<NeighborEdgeSlots>& Mesh::GetNeighborEdgeSlots() const
+{
+	return m_NeighborEdgeSlots;
+}
+
+bool Mesh::HasEdges() const
+{
+	return m_HasEdges;
+}
+
+uint32_t Mesh::GetEdgeCount() const
+{
+	return static_cast<uint32_t>(m_Edges.size());
+}
+
+const std::vector<Edge>& Mesh::GetEdges() const
+{
+	return m_Edges;
+}
+
+const std::vector<std::array<int, 3>>& Mesh::GetTriangleEdges() const
+{
+	return m_TriangleEdges;
+}
+
+const OneRingAdjacency& Mesh::BuildOneRingAdjacency(uint32_t threadCount)
+{
+	if(!m_OneRingAdjacency)
+		m_OneRingAdjacency = std::make_shared<const OneRingAdjacency>(OneRingAdjacency::Build(*this, threadCount));
+	return *m_OneRingAdjacency;
 }
 
-const std::vector<Data::Primitive::Vertex>& Mesh::GetVertices() const
+const OneRingAdjacency* Mesh::GetOneRingAdjacency() const
+{
+	return m_OneRingAdjacency.get();
+}
+
+Core::Container::ChunkedWriteSpan<Data::Primitive::Vertex> Mesh::GetVertices()
+{
+	return Core::Container::ChunkedWriteSpan<Vertex>(m_Vertices);
+}
+
+const Core::Container::ChunkedCowVector<Data::Primitive::Vertex>& Mesh::GetVertices() const
 {
 	return m_Vertices;
 }
 
-std::vector<Data::Primitive::Triangle>& Mesh::GetTriangles()
+const Core::Container::ChunkedCowVector<Data::Primitive::Triangle>& Mesh::GetTriangles() const
 {
 	return m_Triangles;
 }
 
-const std::vector<Data::Primitive::Triangle>& Mesh::GetTriangles() const
+Core::Container::ChunkedWriteSpan<Data::Primitive::Triangle> Mesh::EditTriangles()
 {
-	return m_Triangles;
+	OnTrianglesEdited();
+	return Core::Container::ChunkedWriteSpan<Triangle>(m_Triangles);
 }
 
 bool Mesh::HasVerticesExtraDataContainer() const
@@ -194,109 +792,118 @@ void Mesh::ComputeTriangleNormals(bool normalize)
 	{
 		const TriangleProxy& curTriangle = GetTriangle(iTriangle);
 
-		// Get each vertex position.
-		const Vec3& posA = m_Vertices[curTriangle.GetVertex(0)].Position;
-		const Vec3& posB = m_Vertices[curTriangle.GetVertex(1)].Position;
-		const Vec3& posC = m_Vertices[curTriangle.GetVertex(2)].Position;
-
-		const Vec3 AB = Normalize(posB - posA);
-		const Vec3 AC = Normalize(posC - posA);
-
 		// Compute and store the normal as an extra data to the current triangle.
 		TriangleNormalExtraData& curTriangleNormal = curTriangle.GetOrCreateExtraData<TriangleNormalExtraData>();
-		Vec3 computedNormal = Cross(AB, AC);
-		if(normalize)
-			computedNormal = Normalize(computedNormal);
-		curTriangleNormal.SetData(computedNormal);
+		curTriangleNormal.SetData(ComputeTriangleNormal(m_Vertices, m_Triangles[iTriangle], normalize));
 	}
 }
 
 void Mesh::ComputeSmoothVertexNormals(bool normalize)
 {
-	// Add extra data containers for triangles if necessary.
-	if(!HasTrianglesExtraDataContainer())
-		AddTrianglesExtraDataContainer();
-
 	// Add extra data containers for vertices if necessary.
 	if(!HasVerticesExtraDataContainer())
 		AddVerticesExtraDataContainer();
 
-	for(TriangleIndex iTriangle = 0; iTriangle < GetTriangleCount(); ++iTriangle)
-	{
-		const TriangleProxy& curTriangle = GetTriangle(iTriangle);
-
-		// Get each vertex position.
-		const Vec3& posA = m_Vertices[curTriangle.GetVertex(0)].Position;
-		const Vec3& posB = m_Vertices[curTriangle.GetVertex(1)].Position;
-		const Vec3& posC = m_Vertices[curTriangle.GetVertex(2)].Position;
-
-		const Vec3 AB = Normalize(posB - posA);
-		const Vec3 AC = Normalize(posC - posA);
-
-		// Get or compute the current triangle normal.
-		Vec3 curTriangleNormal;
-		if(curTriangle.HasExtraData<TriangleNormalExtraData>())
-		{
-			curTriangleNormal = curTriangle.GetExtraData<TriangleNormalExtraData>()->GetData();
-		}
-		else
+	// The normals stored on the triangles (e.g. loaded from a file) are used if every triangle has one.
+	const std::vector<Vec3> triangleNormals =
+		GetStoredTriangleNormals(m_TrianglesExtraDataContainer, m_Triangles.size());
+	std::vector<Vec3> normals(m_Vertices.size());
+	Utilitary::Surface::MeshNormals::ComputeVertexNormals(
+		m_Vertices, m_Triangles, normals, Utilitary::Surface::NormalWeighting::Angle, normalize, 0, triangleNormals);
+
+	// Each vertex has its own container, so they can be filled in parallel.
+	std::vector<ExtraDataContainer>& containers = m_VerticesExtraDataContainer.Write();
+	Core::Parallel::For(
+		m_Vertices.size(),
+		[&](size_t iVertex)
 		{
-			curTriangleNormal = Cross(AB, AC);
-		}
+			containers[iVertex].GetOrCreate<SmoothVertexNormalExtraData>().SetData(normals[iVertex]);
+		});
+}
 
-		curTriangleNormal = Normalize(curTriangleNormal);
+void Mesh::SetVertexPosition(const VertexIndex index, const Vec3& position)
+{
+	assert(index < GetVertexCount() && "Index out of bound");
+	m_Vertices.Write(index).Position = position;
+	MarkVertexDirty(index);
+}
+
+void Mesh::MarkVertexDirty(const VertexIndex index)
+{
+	assert(index < GetVertexCount() && "Index out of bound");
+	std::vector<bool>& isVertexDirty = m_IsVertexDirty.Write();
+	if(isVertexDirty.size() < m_Vertices.size())
+		isVertexDirty.resize(m_Vertices.size(), false);
 
-		// Compute the remaining vectors of the triangle.
-		const Vec3 BC = glm::normalize(posC - posB);
-		const Vec3 BA = glm::normalize(posA - posB);
+	if(!isVertexDirty[index])
+	{
+		isVertexDirty[index] = true;
+		m_DirtyVertices.Write().push_back(index);
+	}
+}
 
-		const Vec3 CA = glm::normalize(posA - posC);
-		const Vec3 CB = glm::normalize(posB - posC);
+const std::vector<VertexIndex>& Mesh::GetDirtyVertices() const
+{
+	return m_DirtyVertices;
+}
 
-		// Compute each angle (in randian).
-		const float angleA = Angle(AB, AC);
-		const float angleB = Angle(BC, BA);
-		const float angleC = Angle(CA, CB);
+void Mesh::ClearDirtyVertices()
+{
+	if(m_DirtyVertices.empty())
+		return;
+
+	std::vector<bool>& isVertexDirty = m_IsVertexDirty.Write();
+	for(VertexIndex curVertexIdx : m_DirtyVertices)
+		isVertexDirty[curVertexIdx] = false;
+
+	// A list shared with a copy of the mesh is released rather than copied to be cleared.
+	if(m_DirtyVertices.IsShared())
+		m_DirtyVertices = {};
+	else
+		m_DirtyVertices.Write().clear();
+}
 
-		// Get a proxy on each vertex of the triangle.
-		const VertexProxy& vertexA = GetVertex(curTriangle.GetVertex(0));
-		const VertexProxy& vertexB = GetVertex(curTriangle.GetVertex(1));
-		const VertexProxy& vertexC = GetVertex(curTriangle.GetVertex(2));
+void Mesh::UpdateDirtyNormals(bool normalize)
+{
+	if(m_DirtyVertices.empty())
+		return;
 
-		// Add the normal weighted by the related angle as an extra data to each vertex.
-		FlatVertexNormalsExtraData& vertexAExtraData = vertexA.GetOrCreateExtraData<FlatVertexNormalsExtraData>();
-		vertexAExtraData.GetData().emplace_back(curTriangleNormal * angleA);
-		FlatVertexNormalsExtraData& vertexBExtraData = vertexB.GetOrCreateExtraData<FlatVertexNormalsExtraData>();
-		vertexBExtraData.GetData().emplace_back(curTriangleNormal * angleB);
-		FlatVertexNormalsExtraData& vertexCExtraData = vertexC.GetOrCreateExtraData<FlatVertexNormalsExtraData>();
-		vertexCExtraData.GetData().emplace_back(curTriangleNormal * angleC);
+	// Update the normal of the triangles around the dirty vertices.
+	if(HasTrianglesExtraDataContainer())
+	{
+		std::vector<ExtraDataContainer>& containers = m_TrianglesExtraDataContainer.Write();
+		const std::vector<TriangleIndex> triangleIndices =
+			Utilitary::Surface::MeshNormals::GetTrianglesAroundVertices(*this, m_DirtyVertices);
+		for(TriangleIndex curTriangleIdx : triangleIndices)
+		{
+			if(TriangleNormalExtraData* curTriangleNormal = containers[curTriangleIdx].Get<TriangleNormalExtraData>())
+				curTriangleNormal->SetData(ComputeTriangleNormal(m_Vertices, m_Triangles[curTriangleIdx], normalize));
+		}
 	}
 
-	// Compute the smooth normal for each vertex of the mesh.
-	for(VertexIndex iVertex = 0; iVertex < GetVertexCount(); ++iVertex)
+	// Update the smooth normal of the vertices of these triangles.
+	if(HasVerticesExtraDataContainer())
 	{
-		// Get the current vertex and create the extra data that will handle the smooth vertex normal.
-		const VertexProxy& curVertex = GetVertex(iVertex);
-		SmoothVertexNormalExtraData& curVertexNormal = curVertex.GetOrCreateExtraData<SmoothVertexNormalExtraData>();
-
-		// Get the precomputed flat vertex normals weighted by the angles.
-		auto vertexFlatNormals = curVertex.GetExtraData<FlatVertexNormalsExtraData>();
-		assert(vertexFlatNormals != nullptr);
-
-		// Accumulate the weighted flat vertex normals.
-		Vec3 computedNormal = std::accumulate(
-			vertexFlatNormals->GetData().begin(),
-			vertexFlatNormals->GetData().end(),
-			Vec3{ 0., 0., 0. },
-			std::plus<Vec3>());
-
-		if(normalize)
-			computedNormal = Normalize(computedNormal);
-		curVertexNormal.SetData(computedNormal);
-
-		// Erase extra data that is used to compute smooth vertex normal.
-		curVertex.EraseExtraData<FlatVertexNormalsExtraData>();
+		std::vector<VertexIndex> vertexIndices =
+			Utilitary::Surface::MeshNormals::GetVerticesAroundVertices(*this, m_DirtyVertices);
+		std::erase_if(vertexIndices,
+					  [this](VertexIndex vertexIdx)
+					  {
+						  return !m_VerticesExtraDataContainer[vertexIdx].Has<SmoothVertexNormalExtraData>();
+					  });
+
+		// The triangle normals are taken from the triangles like in ComputeSmoothVertexNormals.
+		const std::vector<Vec3> triangleNormals =
+			GetStoredTriangleNormals(m_TrianglesExtraDataContainer, m_Triangles.size());
+		std::vector<Vec3> normals(vertexIndices.size());
+		Utilitary::Surface::MeshNormals::ComputeVertexNormals(
+			*this, vertexIndices, normals, Utilitary::Surface::NormalWeighting::Angle, normalize, 0, triangleNormals);
+		std::vector<ExtraDataContainer>& containers = m_VerticesExtraDataContainer.Write();
+		for(size_t index = 0; index < vertexIndices.size(); ++index)
+			containers[vertexIndices[index]].Get<SmoothVertexNormalExtraData>()->SetData(normals[index]);
 	}
+
+	ClearDirtyVertices();
 }
 
 void Mesh::UpdateVerticesBoundaryStatus()
@@ -305,30 +912,15 @@ void Mesh::UpdateVerticesBoundaryStatus()
 	if(!HasVerticesExtraDataContainer())
 		AddVerticesExtraDataContainer();
 
-	for(VertexIndex iVertex = 0; iVertex < GetVertexCount(); ++iVertex)
-	{
-		VertexProxy curVertex = GetVertex(iVertex);
-		auto& curBoundaryStatus = curVertex.GetOrCreateExtraData<IsBoundaryVertexExtraData>();
-		curBoundaryStatus.SetData(false);
-	}
+	const Utilitary::Surface::BoundaryReport report = Utilitary::Surface::MeshBoundary::Analyze(*this, false);
 
-	for(auto&& curTriangle : m_Triangles)
-	{
-		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+	// Each vertex has its own container, so they can be filled in parallel.
+	std::vector<ExtraDataContainer>& containers = m_VerticesExtraDataContainer.Write();
+	Core::Parallel::For(
+		m_Vertices.size(),
+		[&](size_t iVertex)
 		{
-			// If the edge opposite to the current vertex is a boundary edge,
-			// set the boundary status on the two incident vertices.
-			if(curTriangle.Neighbors[iEdge] == -1)
-			{
-				VertexProxy nextVertex = GetVertex(curTriangle.Vertices[IndexHelpers::Next[iEdge]]);
-				auto& nextBoundaryStatus = nextVertex.GetOrCreateExtraData<IsBoundaryVertexExtraData>();
-				nextBoundaryStatus.SetData(true);
-
-				VertexProxy previousVertex = GetVertex(curTriangle.Vertices[IndexHelpers::Previous[iEdge]]);
-				auto& previousBoundaryStatus = previousVertex.GetOrCreateExtraData<IsBoundaryVertexExtraData>();
-				previousBoundaryStatus.SetData(true);
-			}
-		}
-	}
+			containers[iVertex].GetOrCreate<IsBoundaryVertexExtraData>().SetData(report.IsBoundaryVertex(iVertex));
+		});
 }
 } // namespace Data::Surface
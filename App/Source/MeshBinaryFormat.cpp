@@ -0,0 +1,212 @@
+#include "Application/MeshBinaryFormat.h"
+
+#include "Core/PrintHelpers.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <span>
+
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+using namespace Utilitary::Surface::BinaryFormat;
+
+namespace
+{
+/// @brief Get the expected element size and count of a chunk, or {0, 0} if the chunk type is unknown.
+std::pair<uint32_t, uint64_t> GetExpectedChunkLayout(const ChunkEntry& chunk, const FileHeader& header)
+{
+	switch(chunk.Type)
+	{
+		case ChunkType::Vertices:
+			return { sizeof(Vertex), header.VertexCount };
+		case ChunkType::Triangles:
+			return { sizeof(Triangle), header.TriangleCount };
+		case ChunkType::TriangleNormals:
+			return { sizeof(Vec3), header.TriangleCount };
+		case ChunkType::TriangleTexCoords:
+			return { sizeof(std::array<Vec2, 3>), header.TriangleCount };
+		case ChunkType::SmoothVertexNormals:
+			return { sizeof(Vec3), header.VertexCount };
+	}
+	return { 0, 0 };
+}
+
+/// @brief Check that the indices stored in a chunk are in the range of the vertices and triangles of the header.
+/// @note The connectivity is used as is by the loaded meshes, an out of range index would be read out of bounds.
+bool HasValidIndices(const char* data, const ChunkEntry& chunk, const FileHeader& header)
+{
+	const auto IsVertexIdx = [&header](int index)
+	{
+		return index >= 0 && static_cast<uint64_t>(index) < header.VertexCount;
+	};
+	const auto IsTriangleIdxOrNone = [&header](int index)
+	{
+		return index >= -1 && index < static_cast<int64_t>(header.TriangleCount);
+	};
+
+	if(chunk.Type == ChunkType::Vertices)
+	{
+		const std::span<const Vertex> vertices{ reinterpret_cast<const Vertex*>(data + chunk.Offset),
+												static_cast<size_t>(chunk.ElementCount) };
+		return std::ranges::all_of(vertices,
+								   [&](const Vertex& curVertex)
+								   {
+									   return IsTriangleIdxOrNone(curVertex.IncidentTriangleIdx);
+								   });
+	}
+	if(chunk.Type == ChunkType::Triangles)
+	{
+		const std::span<const Triangle> triangles{ reinterpret_cast<const Triangle*>(data + chunk.Offset),
+												   static_cast<size_t>(chunk.ElementCount) };
+		return std::ranges::all_of(triangles,
+								   [&](const Triangle& curTriangle)
+								   {
+									   return std::ranges::all_of(curTriangle.Vertices, IsVertexIdx)
+										   && std::ranges::all_of(curTriangle.Neighbors, IsTriangleIdxOrNone);
+								   });
+	}
+	return true;
+}
+
+/// @brief Check that the header, the chunk table and the connectivity of a mapped file are valid.
+bool IsValidBinaryMesh(const Core::IO::MappedFile& file)
+{
+	if constexpr(std::endian::native != std::endian::little)
+		return false; // The arrays are stored in little-endian.
+
+	const uint64_t fileSize = file.GetSize();
+	if(fileSize < sizeof(FileHeader))
+		return false;
+
+	const auto& header = *reinterpret_cast<const FileHeader*>(file.GetData());
+	if(header.FileMagic != Magic || header.Version == 0 || header.Version > CurrentVersion
+	   || header.HeaderSize != sizeof(FileHeader))
+		return false;
+
+	// Vertex and triangle indices are stored as int.
+	if(header.VertexCount > static_cast<uint64_t>(std::numeric_limits<int>::max())
+	   || header.TriangleCount > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+		return false;
+
+	// Check the chunk table bounds.
+	if(header.ChunkTableOffset % alignof(ChunkEntry) != 0 || header.ChunkTableOffset > fileSize
+	   || header.ChunkCount > (fileSize - header.ChunkTableOffset) / sizeof(ChunkEntry))
+		return false;
+
+	const auto* chunks = reinterpret_cast<const ChunkEntry*>(file.GetData() + header.ChunkTableOffset);
+	bool hasVertices = false;
+	bool hasTriangles = false;
+	for(uint32_t iChunk = 0; iChunk < header.ChunkCount; ++iChunk)
+	{
+		const ChunkEntry& curChunk = chunks[iChunk];
+
+		// Skip chunks unknown to this version.
+		auto [elementSize, elementCount] = GetExpectedChunkLayout(curChunk, header);
+		if(elementSize == 0)
+			continue;
+
+		// Check the chunk layout and bounds.
+		if(curChunk.ElementSize != elementSize || curChunk.ElementCount != elementCount
+		   || curChunk.Offset % ChunkAlignment != 0 || curChunk.Offset > fileSize
+		   || curChunk.ElementCount > (fileSize - curChunk.Offset) / elementSize)
+			return false;
+
+		if(!HasValidIndices(file.GetData(), curChunk, header))
+			return false;
+
+		hasVertices |= curChunk.Type == ChunkType::Vertices;
+		hasTriangles |= curChunk.Type == ChunkType::Triangles;
+	}
+
+	return hasVertices && hasTriangles;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+std::unique_ptr<BinaryMeshView> BinaryMeshView::Open(const std::filesystem::path& filepath)
+{
+	Core::IO::MappedFile file(filepath);
+
+	// Checking file opening
+	if(!file.IsOpen())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return nullptr;
+	}
+
+	// Checking file type
+	if(!IsValidBinaryMesh(file))
+	{
+		Error("Wrong file format (must be a binary mesh) : {}", filepath.string());
+		return nullptr;
+	}
+
+	return std::unique_ptr<BinaryMeshView>(new BinaryMeshView(std::move(file)));
+}
+
+BinaryMeshView::BinaryMeshView(Core::IO::MappedFile&& file)
+	: m_File(std::move(file))
+{
+	m_Header = reinterpret_cast<const FileHeader*>(m_File.GetData());
+	m_Chunks = { reinterpret_cast<const ChunkEntry*>(m_File.GetData() + m_Header->ChunkTableOffset),
+				 m_Header->ChunkCount };
+}
+
+uint32_t BinaryMeshView::GetVertexCount() const
+{
+	return static_cast<uint32_t>(m_Header->VertexCount);
+}
+
+uint32_t BinaryMeshView::GetTriangleCount() const
+{
+	return static_cast<uint32_t>(m_Header->TriangleCount);
+}
+
+std::span<const Vertex> BinaryMeshView::GetVertices() const
+{
+	return GetChunk<Vertex>(ChunkType::Vertices);
+}
+
+std::span<const Triangle> BinaryMeshView::GetTriangles() const
+{
+	return GetChunk<Triangle>(ChunkType::Triangles);
+}
+
+std::span<const Vec3> BinaryMeshView::GetTriangleNormals() const
+{
+	return GetChunk<Vec3>(ChunkType::TriangleNormals);
+}
+
+std::span<const std::array<Vec2, 3>> BinaryMeshView::GetTriangleTexCoords() const
+{
+	return GetChunk<std::array<Vec2, 3>>(ChunkType::TriangleTexCoords);
+}
+
+std::span<const Vec3> BinaryMeshView::GetSmoothVertexNormals() const
+{
+	return GetChunk<Vec3>(ChunkType::SmoothVertexNormals);
+}
+
+size_t BinaryMeshView::GetFileSize() const
+{
+	return m_File.GetSize();
+}
+
+template<typename T>
+std::span<const T> BinaryMeshView::GetChunk(ChunkType type) const
+{
+	auto it = std::find_if(
+		m_Chunks.begin(),
+		m_Chunks.end(),
+		[type](const ChunkEntry& chunk)
+		{
+			return chunk.Type == type;
+		});
+	if(it == m_Chunks.end() || it->ElementCount == 0)
+		return {};
+
+	return { reinterpret_cast<const T*>(m_File.GetData() + it->Offset), static_cast<size_t>(it->ElementCount) };
+}
+} // namespace Utilitary::Surface
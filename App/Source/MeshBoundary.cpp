@@ -0,0 +1,168 @@
+#include "Application/MeshBoundary.h"
+
+#include "Core/ParallelHelpers.h"
+
+#include <cassert>
+#include <limits>
+
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+using Core::Container::BitArray;
+using Core::Container::ChunkedSpan;
+
+namespace
+{
+/// @brief Minimal number of triangles processed by a thread.
+constexpr size_t BoundaryGrainSize = 4096;
+
+/// @brief Value returned when no half-edge is found.
+constexpr size_t InvalidHalfEdge = std::numeric_limits<size_t>::max();
+
+/// @brief Get the boundary half-edge starting at the end vertex of a boundary half-edge.
+/// @param triangles Triangles of the mesh.
+/// @param neighborEdgeSlots Neighbor edge slots of the triangles, or empty.
+/// @param halfEdgeIdx Boundary half-edge (3 * triangle index + edge index).
+/// @note The half-edge i of a triangle goes from its vertex Next[i] to its vertex Previous[i]. The walk crosses the
+/// interior edges around the end vertex until it reaches a half-edge without neighbor.
+/// @return Next boundary half-edge, or InvalidHalfEdge if the connectivity is inconsistent.
+size_t GetNextBoundaryHalfEdge(
+	ChunkedSpan<const Triangle> triangles, std::span<const NeighborEdgeSlots> neighborEdgeSlots, size_t halfEdgeIdx)
+{
+	TriangleIndex curTriangleIdx = static_cast<TriangleIndex>(halfEdgeIdx / 3);
+	const EdgeIndex edgeIdx = static_cast<EdgeIndex>(halfEdgeIdx % 3);
+	const VertexIndex endVertexIdx =
+		static_cast<VertexIndex>(triangles[curTriangleIdx].Vertices[IndexHelpers::Previous[edgeIdx]]);
+
+	// Half-edge of the current triangle starting at the end vertex.
+	EdgeIndex curEdgeIdx = IndexHelpers::Next[edgeIdx];
+	for(size_t iStep = 0; iStep < triangles.size(); ++iStep)
+	{
+		const int neighborIdx = triangles[curTriangleIdx].Neighbors[curEdgeIdx];
+		if(neighborIdx == -1)
+			return 3 * static_cast<size_t>(curTriangleIdx) + curEdgeIdx;
+
+		// The end vertex starts the current half-edge, it ends the shared half-edge in the neighbor.
+		const EdgeIndex neighborEdgeIdx =
+			neighborEdgeSlots.empty() ? NeighborEdgeSlots::NoEdge : neighborEdgeSlots[curTriangleIdx].Get(curEdgeIdx);
+		curTriangleIdx = static_cast<TriangleIndex>(neighborIdx);
+		if(neighborEdgeIdx != NeighborEdgeSlots::NoEdge)
+		{
+			curEdgeIdx = IndexHelpers::Next[neighborEdgeIdx];
+			continue;
+		}
+
+		const int localIdx = Utilitary::Primitive::GetVertexLocalIndex(triangles[curTriangleIdx], endVertexIdx);
+		if(localIdx == -1)
+			return InvalidHalfEdge;
+		curEdgeIdx = IndexHelpers::Previous[localIdx];
+	}
+	return InvalidHalfEdge;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+bool BoundaryReport::IsBoundaryVertex(VertexIndex vertexIdx) const
+{
+	return BoundaryVertices.Get(vertexIdx);
+}
+
+bool BoundaryReport::IsBoundaryEdge(TriangleIndex triangleIdx, EdgeIndex edgeIdx) const
+{
+	assert(edgeIdx < 3);
+	return BoundaryEdges.Get(3 * static_cast<size_t>(triangleIdx) + edgeIdx);
+}
+
+size_t BoundaryReport::GetLoopCount() const
+{
+	return LoopOffsets.size() - 1;
+}
+
+std::span<const VertexIndex> BoundaryReport::GetLoop(size_t loopIdx) const
+{
+	assert(loopIdx < GetLoopCount() && "Index out of bound");
+	return std::span<const VertexIndex>(LoopVertices)
+		.subspan(LoopOffsets[loopIdx], LoopOffsets[loopIdx + 1] - LoopOffsets[loopIdx]);
+}
+
+BoundaryReport MeshBoundary::Analyze(size_t vertexCount,
+									 ChunkedSpan<const Triangle> triangles,
+									 bool extractLoops,
+									 uint32_t threadCount,
+									 std::span<const NeighborEdgeSlots> neighborEdgeSlots)
+{
+	assert(neighborEdgeSlots.empty() || neighborEdgeSlots.size() == triangles.size());
+
+	BoundaryReport report;
+	report.BoundaryVertices.Resize(vertexCount);
+	report.BoundaryEdges.Resize(3 * triangles.size());
+
+	// Each thread fills whole words of the edge bitset, the vertex bits are shared and set atomically.
+	const size_t halfEdgeCount = report.BoundaryEdges.GetSize();
+	std::span<BitArray::WordType> edgeWords = report.BoundaryEdges.GetWords();
+	Core::Parallel::For(
+		edgeWords.size(),
+		[&](size_t iWord)
+		{
+			BitArray::WordType curWord = 0;
+			const size_t wordEnd = std::min(halfEdgeCount, (iWord + 1) * BitArray::WordBitCount);
+			for(size_t iHalfEdge = iWord * BitArray::WordBitCount; iHalfEdge < wordEnd; ++iHalfEdge)
+			{
+				const Triangle& curTriangle = triangles[iHalfEdge / 3];
+				const EdgeIndex curEdgeIdx = static_cast<EdgeIndex>(iHalfEdge % 3);
+				if(curTriangle.Neighbors[curEdgeIdx] != -1)
+					continue;
+
+				curWord |= BitArray::WordType(1) << (iHalfEdge % BitArray::WordBitCount);
+				report.BoundaryVertices.SetAtomic(
+					static_cast<size_t>(curTriangle.Vertices[IndexHelpers::Next[curEdgeIdx]]));
+				report.BoundaryVertices.SetAtomic(
+					static_cast<size_t>(curTriangle.Vertices[IndexHelpers::Previous[curEdgeIdx]]));
+			}
+			edgeWords[iWord] = curWord;
+		},
+		3 * BoundaryGrainSize / BitArray::WordBitCount,
+		threadCount);
+
+	if(!extractLoops)
+		return report;
+
+	// Walk each loop from its first boundary half-edge, removing its half-edges from the remaining ones.
+	BitArray remainingEdges = report.BoundaryEdges;
+	for(size_t startHalfEdge = remainingEdges.FindNext(0); startHalfEdge < halfEdgeCount;
+		startHalfEdge = remainingEdges.FindNext(startHalfEdge + 1))
+	{
+		size_t curHalfEdge = startHalfEdge;
+		while(true)
+		{
+			remainingEdges.Reset(curHalfEdge);
+			const Triangle& curTriangle = triangles[curHalfEdge / 3];
+			const EdgeIndex curEdgeIdx = static_cast<EdgeIndex>(curHalfEdge % 3);
+			report.LoopVertices.push_back(
+				static_cast<VertexIndex>(curTriangle.Vertices[IndexHelpers::Next[curEdgeIdx]]));
+
+			const size_t nextHalfEdge = GetNextBoundaryHalfEdge(triangles, neighborEdgeSlots, curHalfEdge);
+			if(nextHalfEdge == startHalfEdge)
+				break;
+			if(nextHalfEdge == InvalidHalfEdge || !remainingEdges.Get(nextHalfEdge))
+			{ // Open chain, end it with the end vertex of its last half-edge.
+				report.LoopVertices.push_back(
+					static_cast<VertexIndex>(curTriangle.Vertices[IndexHelpers::Previous[curEdgeIdx]]));
+				break;
+			}
+			curHalfEdge = nextHalfEdge;
+		}
+		report.LoopOffsets.push_back(static_cast<uint32_t>(report.LoopVertices.size()));
+	}
+
+	return report;
+}
+
+BoundaryReport MeshBoundary::Analyze(const Data::Surface::Mesh& mesh, bool extractLoops, uint32_t threadCount)
+{
+	std::span<const NeighborEdgeSlots> neighborEdgeSlots;
+	if(mesh.HasNeighborEdgeSlots())
+		neighborEdgeSlots = mesh.GetNeighborEdgeSlots();
+	return Analyze(mesh.GetVertexCount(), mesh.GetTriangles(), extractLoops, threadCount, neighborEdgeSlots);
+}
+} // namespace Utilitary::Surface
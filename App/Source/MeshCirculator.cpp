@@ -4,12 +4,53 @@ using namespace Data::Primitive;
 using namespace Utilitary::Primitive;
 using namespace Core::BaseType;
 
+namespace
+{
+/// @brief Move from a triangle to its neighbor across one of its edges containing the central vertex.
+/// @param triangles The triangles of the mesh.
+/// @param neighborEdgeSlots The neighbor edge slots of the triangles, or nullptr if they are not known.
+/// @param triangleIdx The current triangle, replaced by its neighbor (or -1 if there is no neighbor).
+/// @param centralVertexLocalIdx The local index of the central vertex in the current triangle, replaced by its local
+/// index in the neighbor (unchanged if there is no neighbor).
+/// @param edgeIdx The edge to cross.
+/// @note The neighbor edge slot gives the local index in O(1), it is searched in the neighbor otherwise.
+void CrossEdge(const Core::Container::ChunkedCowVector<Triangle>& triangles,
+			   const NeighborEdgeSlots* neighborEdgeSlots,
+			   int& triangleIdx,
+			   EdgeIndex& centralVertexLocalIdx,
+			   EdgeIndex edgeIdx)
+{
+	const Triangle& curFace = triangles[triangleIdx];
+	const int neighborFaceIdx = curFace.Neighbors[edgeIdx];
+	if(neighborFaceIdx == -1)
+	{
+		triangleIdx = -1;
+		return;
+	}
+
+	const EdgeIndex neighborEdgeIdx =
+		neighborEdgeSlots != nullptr ? neighborEdgeSlots[triangleIdx].Get(edgeIdx) : NeighborEdgeSlots::NoEdge;
+	if(neighborEdgeIdx != NeighborEdgeSlots::NoEdge)
+	{
+		centralVertexLocalIdx = GetVertexLocalIndexInNeighbor(edgeIdx, neighborEdgeIdx, centralVertexLocalIdx);
+	}
+	else
+	{
+		const int localIdx = GetVertexLocalIndex(triangles[neighborFaceIdx], curFace.Vertices[centralVertexLocalIdx]);
+		assert(localIdx != -1); // The neighbor must contains the central vertex.
+		centralVertexLocalIdx = static_cast<EdgeIndex>(localIdx);
+	}
+	triangleIdx = neighborFaceIdx;
+}
+} // namespace
+
 namespace Data::Surface
 {
 //==========================VerticesAroundVertexCirculator==========================//
 Mesh::VerticesAroundVertexCirculator::VerticesAroundVertexCirculator(const Mesh& mesh, const VertexIndex index)
 	: m_Mesh(mesh)
 	, m_CentralVertexIdx(index)
+	, m_NeighborEdgeSlots(mesh.HasNeighborEdgeSlots() ? mesh.m_NeighborEdgeSlots.data() : nullptr)
 {
 	// Get the vertex data of the central vertex.
 	const Vertex& curVertex = m_Mesh.GetVertexData(m_CentralVertexIdx);
@@ -23,6 +64,7 @@ Mesh::VerticesAroundVertexCirculator::VerticesAroundVertexCirculator(const Mesh&
 	// Get the local index of the central mesh in the current triangle.
 	int localIdx = GetVertexLocalIndex(curFace, m_CentralVertexIdx);
 	assert(localIdx != -1); // The current triangle must contains the central vertex.
+	m_CentralVertexLocalIdx = static_cast<EdgeIndex>(localIdx);
 
 	//  Set the current vertex index.
 	m_CurVertexLocalIdx = IndexHelpers::Previous[localIdx];
@@ -52,17 +94,14 @@ Mesh::VerticesAroundVertexCirculator& Mesh::VerticesAroundVertexCirculator::oper
 		int neighborFaceIdx;
 		{
 			const Triangle& curFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-			neighborFaceIdx = curFace.Neighbors[IndexHelpers::Previous[m_CurVertexLocalIdx]];
+			neighborFaceIdx = curFace.Neighbors[IndexHelpers::Next[m_CentralVertexLocalIdx]];
 		}
 		if(neighborFaceIdx == -1)
 		{ // If there is no next triangle, we reached a boundary.
 			while(m_JumpCount > 0)
 			{ // We need to go back to the previous triangle and start going in the opposite direction.
-				const Triangle& curFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-				int localIdx = GetVertexLocalIndex(curFace, m_CentralVertexIdx);
-				assert(localIdx != -1);
 				m_PrevTriangleIdx = m_CurTriangleIdx;
-				m_CurTriangleIdx = curFace.Neighbors[IndexHelpers::Previous[localIdx]];
+				MoveInCWOrder();
 				m_JumpCount--;
 			}
 
@@ -75,7 +114,7 @@ Mesh::VerticesAroundVertexCirculator& Mesh::VerticesAroundVertexCirculator::oper
 			// Update the jump count.
 			m_JumpCount++;
 			m_PrevTriangleIdx = m_CurTriangleIdx;
-			m_CurTriangleIdx = neighborFaceIdx;
+			MoveInCCWOrder();
 
 			UpdateCurVertexIndexInCCWOrder();
 		}
@@ -83,8 +122,7 @@ Mesh::VerticesAroundVertexCirculator& Mesh::VerticesAroundVertexCirculator::oper
 	else // We are going in the clock-wise direction.
 	{
 		m_PrevTriangleIdx = m_CurTriangleIdx;
-		const Triangle& prevFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-		m_CurTriangleIdx = prevFace.Neighbors[IndexHelpers::Next[m_CurVertexLocalIdx]];
+		MoveInCWOrder();
 
 		if(m_CurTriangleIdx == -1)
 			return *this; // We reached a boundary, we stop here.
@@ -105,25 +143,39 @@ void Mesh::VerticesAroundVertexCirculator::SetIsActive(bool value)
 	m_IsActive = value;
 }
 
+void Mesh::VerticesAroundVertexCirculator::MoveInCCWOrder()
+{
+	CrossEdge(m_Mesh.m_Triangles,
+			  m_NeighborEdgeSlots,
+			  m_CurTriangleIdx,
+			  m_CentralVertexLocalIdx,
+			  IndexHelpers::Next[m_CentralVertexLocalIdx]);
+}
+
+void Mesh::VerticesAroundVertexCirculator::MoveInCWOrder()
+{
+	CrossEdge(m_Mesh.m_Triangles,
+			  m_NeighborEdgeSlots,
+			  m_CurTriangleIdx,
+			  m_CentralVertexLocalIdx,
+			  IndexHelpers::Previous[m_CentralVertexLocalIdx]);
+}
+
 void Mesh::VerticesAroundVertexCirculator::UpdateCurVertexIndexInCWOrder()
 {
 	const Triangle& curFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-	int localIdx = GetVertexLocalIndex(curFace, m_CentralVertexIdx);
-	assert(localIdx != -1);
 
 	// Update the vertex and triangle informations.
-	m_CurVertexLocalIdx = IndexHelpers::Next[localIdx];
+	m_CurVertexLocalIdx = IndexHelpers::Next[m_CentralVertexLocalIdx];
 	m_CurVertexIdx = curFace.Vertices[m_CurVertexLocalIdx];
 }
 
 void Mesh::VerticesAroundVertexCirculator::UpdateCurVertexIndexInCCWOrder()
 {
 	const Triangle& curFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-	int localIdx = GetVertexLocalIndex(curFace, m_CentralVertexIdx);
-	assert(localIdx != -1);
 
 	// Update the vertex and triangle informations.
-	m_CurVertexLocalIdx = IndexHelpers::Previous[localIdx];
+	m_CurVertexLocalIdx = IndexHelpers::Previous[m_CentralVertexLocalIdx];
 	m_CurVertexIdx = curFace.Vertices[m_CurVertexLocalIdx];
 }
 
@@ -156,6 +208,7 @@ Mesh::VerticesAroundVertexRange Mesh::GetVerticesAroundVertex(const VertexIndex
 Mesh::TrianglesAroundVertexCirculator::TrianglesAroundVertexCirculator(const Mesh& mesh, const VertexIndex index)
 	: m_Mesh(mesh)
 	, m_CentralVertexIdx(index)
+	, m_NeighborEdgeSlots(mesh.HasNeighborEdgeSlots() ? mesh.m_NeighborEdgeSlots.data() : nullptr)
 {
 	// Get the vertex data of the central vertex.
 	const Vertex& curVertex = m_Mesh.GetVertexData(m_CentralVertexIdx);
@@ -165,6 +218,11 @@ Mesh::TrianglesAroundVertexCirculator::TrianglesAroundVertexCirculator(const Mes
 	m_CurTriangleIdx = curVertex.IncidentTriangleIdx;
 	m_PrevTriangleIdx = -1;
 	m_JumpCount++;
+
+	// Get the local index of the central vertex in the current triangle.
+	int localIdx = GetVertexLocalIndex(m_Mesh.GetTriangleData(m_CurTriangleIdx), m_CentralVertexIdx);
+	assert(localIdx != -1); // The current triangle must contains the central vertex.
+	m_CentralVertexLocalIdx = static_cast<EdgeIndex>(localIdx);
 }
 
 bool Mesh::TrianglesAroundVertexCirculator::operator==(const Mesh::TrianglesAroundVertexCirculator& rhs) const
@@ -185,13 +243,8 @@ Mesh::TrianglesAroundVertexCirculator& Mesh::TrianglesAroundVertexCirculator::op
 {
 	m_IsActive = true;
 
-	int neighborFaceIdx;
-	{
-		const Triangle& curFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-		int localIdx = GetVertexLocalIndex(curFace, m_CentralVertexIdx);
-		assert(localIdx != -1);
-		neighborFaceIdx = curFace.Neighbors[IndexHelpers::Next[localIdx]];
-	}
+	const Triangle& curFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
+	const int neighborFaceIdx = curFace.Neighbors[IndexHelpers::Next[m_CentralVertexLocalIdx]];
 
 	if(m_IsInCCWOrder)
 	{
@@ -199,11 +252,8 @@ Mesh::TrianglesAroundVertexCirculator& Mesh::TrianglesAroundVertexCirculator::op
 		{ // If there is no next triangle, we reached a boundary.
 			while(m_JumpCount > 0)
 			{ // We need to go back to the previous triangle and start going in the opposite direction.
-				const Triangle& curFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-				int localIdx = GetVertexLocalIndex(curFace, m_CentralVertexIdx);
-				assert(localIdx != -1);
 				m_PrevTriangleIdx = m_CurTriangleIdx;
-				m_CurTriangleIdx = curFace.Neighbors[IndexHelpers::Previous[localIdx]];
+				MoveInCWOrder();
 				m_JumpCount--;
 			}
 
@@ -215,16 +265,13 @@ Mesh::TrianglesAroundVertexCirculator& Mesh::TrianglesAroundVertexCirculator::op
 			// Update the jump count.
 			m_JumpCount++;
 			m_PrevTriangleIdx = m_CurTriangleIdx;
-			m_CurTriangleIdx = neighborFaceIdx;
+			MoveInCCWOrder();
 		}
 	}
 	else // We are going in the clock-wise direction.
 	{
 		m_PrevTriangleIdx = m_CurTriangleIdx;
-		const Triangle& prevFace = m_Mesh.GetTriangleData(m_CurTriangleIdx);
-		int localIdx = GetVertexLocalIndex(prevFace, m_CentralVertexIdx);
-		assert(localIdx != -1);
-		m_CurTriangleIdx = prevFace.Neighbors[IndexHelpers::Previous[localIdx]];
+		MoveInCWOrder();
 	}
 
 	return *this;
@@ -240,6 +287,24 @@ void Mesh::TrianglesAroundVertexCirculator::SetIsActive(bool value)
 	m_IsActive = value;
 }
 
+void Mesh::TrianglesAroundVertexCirculator::MoveInCCWOrder()
+{
+	CrossEdge(m_Mesh.m_Triangles,
+			  m_NeighborEdgeSlots,
+			  m_CurTriangleIdx,
+			  m_CentralVertexLocalIdx,
+			  IndexHelpers::Next[m_CentralVertexLocalIdx]);
+}
+
+void Mesh::TrianglesAroundVertexCirculator::MoveInCWOrder()
+{
+	CrossEdge(m_Mesh.m_Triangles,
+			  m_NeighborEdgeSlots,
+			  m_CurTriangleIdx,
+			  m_CentralVertexLocalIdx,
+			  IndexHelpers::Previous[m_CentralVertexLocalIdx]);
+}
+
 //==========================TrianglesAroundVertexRange==========================//
 Mesh::TrianglesAroundVertexRange::TrianglesAroundVertexRange(const Mesh& mesh, const VertexIndex index)
 	: m_Mesh(mesh)
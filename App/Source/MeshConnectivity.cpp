@@ -0,0 +1,334 @@
+#include "Application/MeshConnectivity.h"
+
+#include "Core/ParallelHelpers.h"
+#include "Core/RadixSort.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <numeric>
+
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Minimal number of triangles processed by a thread.
+constexpr size_t ConnectivityGrainSize = 4096;
+
+/// @brief Half-edge of a triangle, identified by the key of its undirected edge.
+struct HalfEdgeEntry
+{
+	/// @brief Key of the undirected edge (see GetEdgeKey).
+	uint64_t Key;
+	/// @brief Triangle containing the half-edge.
+	TriangleIndex TriangleIdx;
+	/// @brief Index of the half-edge in the triangle (i.e. the index of the opposite vertex).
+	EdgeIndex EdgeIdx;
+};
+
+/// @brief Pack an undirected edge into a key, the smaller vertex in the high bits.
+/// @param vertexBitCount Number of bits needed to store any vertex index of the mesh.
+uint64_t GetEdgeKey(VertexIndex firstIndex, VertexIndex secondIndex, uint32_t vertexBitCount)
+{
+	const auto [minIndex, maxIndex] = std::minmax(firstIndex, secondIndex);
+	return (static_cast<uint64_t>(minIndex) << vertexBitCount) | maxIndex;
+}
+
+/// @brief Check if two half-edges of the same edge go in opposite directions (consistent orientation).
+bool IsOppositeHalfEdge(Core::Container::ChunkedSpan<const Triangle> triangles,
+						const HalfEdgeEntry& first,
+						const HalfEdgeEntry& second)
+{
+	return triangles[first.TriangleIdx].Vertices[IndexHelpers::Next[first.EdgeIdx]]
+		   != triangles[second.TriangleIdx].Vertices[IndexHelpers::Next[second.EdgeIdx]];
+}
+
+/// @brief Set an edge from the run of its half-edges, and its index in the triangles of the run.
+void SetEdge(Core::Container::ChunkedSpan<const Triangle> triangles,
+			 std::span<const HalfEdgeEntry> run,
+			 int edgeIdx,
+			 Edge& edge,
+			 std::span<std::array<int, 3>> triangleEdges)
+{
+	// The sort is stable, the first half-edge of the run is in the first triangle.
+	const HalfEdgeEntry& first = run.front();
+	const Triangle& triangle = triangles[first.TriangleIdx];
+	const auto [minVertexIdx, maxVertexIdx] = std::minmax(triangle.Vertices[IndexHelpers::Next[first.EdgeIdx]],
+														  triangle.Vertices[IndexHelpers::Previous[first.EdgeIdx]]);
+	edge = { .Vertices = { minVertexIdx, maxVertexIdx },
+			 .TriangleIdx = static_cast<int>(first.TriangleIdx),
+			 .EdgeIdx = first.EdgeIdx };
+	for(const HalfEdgeEntry& curHalfEdge : run)
+		triangleEdges[curHalfEdge.TriangleIdx][curHalfEdge.EdgeIdx] = edgeIdx;
+}
+
+/// @brief Set the neighbor edge slot of an edge, the other slots of the triangle being set concurrently.
+void SetNeighborEdgeSlotAtomic(NeighborEdgeSlots& slots, EdgeIndex edgeIdx, EdgeIndex neighborEdgeIdx)
+{
+	// The slots start at NoEdge (all bits set), so clearing the bits not in the edge index sets it.
+	const uint8_t clearMask = static_cast<uint8_t>((NeighborEdgeSlots::NoEdge & ~neighborEdgeIdx) << (2 * edgeIdx));
+	std::atomic_ref<uint8_t>(slots.Packed).fetch_and(static_cast<uint8_t>(~clearMask), std::memory_order_relaxed);
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+bool ConnectivityReport::IsManifold() const
+{
+	return NonManifoldEdges.empty();
+}
+
+ConnectivityReport MeshConnectivity::Build(Core::Container::ChunkedSpan<Vertex> vertices,
+										   Core::Container::ChunkedSpan<Triangle> triangles,
+										   uint32_t threadCount,
+										   std::span<NeighborEdgeSlots> neighborEdgeSlots,
+										   std::span<std::array<int, 3>> triangleEdges,
+										   std::vector<Edge>* edges)
+{
+	assert(neighborEdgeSlots.empty() || neighborEdgeSlots.size() == triangles.size());
+	assert((edges == nullptr) == triangleEdges.empty() && "The edges and the triangle edges are built together");
+	assert(triangleEdges.empty() || triangleEdges.size() == triangles.size());
+	const bool hasNeighborEdgeSlots = !neighborEdgeSlots.empty();
+
+	const uint32_t vertexBitCount = std::max(static_cast<uint32_t>(std::bit_width(vertices.size())), 1u);
+
+	// Gather the half-edges of every triangle.
+	std::vector<HalfEdgeEntry> halfEdges(triangles.size() * 3);
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& curTriangle = triangles[iTriangle];
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				const int firstVertexIdx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
+				const int secondVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+				assert(firstVertexIdx >= 0 && static_cast<size_t>(firstVertexIdx) < vertices.size());
+				assert(secondVertexIdx >= 0 && static_cast<size_t>(secondVertexIdx) < vertices.size());
+
+				halfEdges[3 * iTriangle + iEdge] = {
+					.Key = GetEdgeKey(static_cast<VertexIndex>(firstVertexIdx),
+									  static_cast<VertexIndex>(secondVertexIdx),
+									  vertexBitCount),
+					.TriangleIdx = static_cast<TriangleIndex>(iTriangle),
+					.EdgeIdx = iEdge
+				};
+			}
+		},
+		ConnectivityGrainSize,
+		threadCount);
+
+	// Half-edges of the same edge become contiguous.
+	Core::Parallel::RadixSort(
+		halfEdges,
+		[](const HalfEdgeEntry& halfEdge)
+		{
+			return halfEdge.Key;
+		},
+		2 * vertexBitCount,
+		threadCount);
+
+	// Every slot starts without neighbor, only the interior edges are set.
+	std::ranges::fill(neighborEdgeSlots, NeighborEdgeSlots{});
+
+	// Match the half-edges of each run of equal keys, each range starting on a run boundary.
+	const size_t halfEdgeCount = halfEdges.size();
+	auto GetRunBegin = [&halfEdges, halfEdgeCount](size_t index)
+	{
+		while(index > 0 && index < halfEdgeCount && halfEdges[index].Key == halfEdges[index - 1].Key)
+			++index;
+		return index;
+	};
+
+	const uint32_t rangeCount = Core::Parallel::GetRangeCount(halfEdgeCount, 3 * ConnectivityGrainSize, threadCount);
+
+	// The edges are numbered in key order: count the runs of each range first.
+	std::vector<size_t> rangeEdgeOffsets;
+	if(edges != nullptr)
+	{
+		rangeEdgeOffsets.assign(rangeCount + 1, 0);
+		Core::Parallel::ForEachRange(
+			halfEdgeCount,
+			rangeCount,
+			[&](uint32_t iRange, size_t begin, size_t end)
+			{
+				const size_t rangeEnd = GetRunBegin(end);
+				for(size_t iHalfEdge = GetRunBegin(begin); iHalfEdge < rangeEnd; ++iHalfEdge)
+				{
+					if(iHalfEdge == 0 || halfEdges[iHalfEdge].Key != halfEdges[iHalfEdge - 1].Key)
+						++rangeEdgeOffsets[iRange + 1];
+				}
+			});
+		std::inclusive_scan(rangeEdgeOffsets.begin(), rangeEdgeOffsets.end(), rangeEdgeOffsets.begin());
+		edges->resize(rangeEdgeOffsets.back());
+	}
+
+	std::vector<ConnectivityReport> rangeReports(rangeCount);
+	Core::Parallel::ForEachRange(
+		halfEdgeCount,
+		rangeCount,
+		[&](uint32_t iRange, size_t begin, size_t end)
+		{
+			ConnectivityReport& curReport = rangeReports[iRange];
+			size_t nextEdgeIdx = edges != nullptr ? rangeEdgeOffsets[iRange] : 0;
+			const size_t rangeEnd = GetRunBegin(end);
+			for(size_t runBegin = GetRunBegin(begin), runEnd = runBegin; runBegin < rangeEnd; runBegin = runEnd)
+			{
+				while(runEnd < halfEdgeCount && halfEdges[runEnd].Key == halfEdges[runBegin].Key)
+					++runEnd;
+
+				if(edges != nullptr)
+				{
+					SetEdge(triangles,
+							std::span(halfEdges).subspan(runBegin, runEnd - runBegin),
+							static_cast<int>(nextEdgeIdx),
+							(*edges)[nextEdgeIdx],
+							triangleEdges);
+					++nextEdgeIdx;
+				}
+
+				const HalfEdgeEntry& first = halfEdges[runBegin];
+				if(runEnd - runBegin == 2)
+				{ // Interior edge
+					const HalfEdgeEntry& second = halfEdges[runBegin + 1];
+					triangles[first.TriangleIdx].Neighbors[first.EdgeIdx] = static_cast<int>(second.TriangleIdx);
+					triangles[second.TriangleIdx].Neighbors[second.EdgeIdx] = static_cast<int>(first.TriangleIdx);
+					if(hasNeighborEdgeSlots && IsOppositeHalfEdge(triangles, first, second))
+					{ // Each triangle owns its slot byte, but its three edges may be matched by different threads.
+						SetNeighborEdgeSlotAtomic(neighborEdgeSlots[first.TriangleIdx], first.EdgeIdx, second.EdgeIdx);
+						SetNeighborEdgeSlotAtomic(neighborEdgeSlots[second.TriangleIdx], second.EdgeIdx, first.EdgeIdx);
+					}
+					++curReport.InteriorEdgeCount;
+					continue;
+				}
+
+				// Boundary or non-manifold edge, the triangles have no neighbor across it.
+				for(size_t iHalfEdge = runBegin; iHalfEdge < runEnd; ++iHalfEdge)
+					triangles[halfEdges[iHalfEdge].TriangleIdx].Neighbors[halfEdges[iHalfEdge].EdgeIdx] = -1;
+
+				if(runEnd - runBegin == 1)
+				{
+					++curReport.BoundaryEdgeCount;
+				}
+				else
+				{
+					const uint64_t vertexMask = (uint64_t(1) << vertexBitCount) - 1;
+					curReport.NonManifoldEdges.emplace_back(
+						static_cast<VertexIndex>(first.Key >> vertexBitCount),
+						static_cast<VertexIndex>(first.Key & vertexMask));
+				}
+			}
+		});
+
+	// Set the incident triangle of each vertex to the first triangle using it.
+	Core::Parallel::For(
+		vertices.size(),
+		[&](size_t iVertex)
+		{
+			vertices[iVertex].IncidentTriangleIdx = -1;
+		},
+		ConnectivityGrainSize,
+		threadCount);
+
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const int curTriangleIdx = static_cast<int>(iTriangle);
+			for(int curVertexIdx : triangles[iTriangle].Vertices)
+			{
+				std::atomic_ref<int> incidentIdx(vertices[curVertexIdx].IncidentTriangleIdx);
+				int curIncidentIdx = incidentIdx.load(std::memory_order_relaxed);
+				while((curIncidentIdx == -1 || curTriangleIdx < curIncidentIdx)
+					  && !incidentIdx.compare_exchange_weak(curIncidentIdx, curTriangleIdx, std::memory_order_relaxed))
+				{}
+			}
+		},
+		ConnectivityGrainSize,
+		threadCount);
+
+	// Merge the reports, the ranges being sorted by key.
+	ConnectivityReport report;
+	for(ConnectivityReport& curReport : rangeReports)
+	{
+		report.InteriorEdgeCount += curReport.InteriorEdgeCount;
+		report.BoundaryEdgeCount += curReport.BoundaryEdgeCount;
+		report.NonManifoldEdges.insert(
+			report.NonManifoldEdges.end(), curReport.NonManifoldEdges.begin(), curReport.NonManifoldEdges.end());
+	}
+
+	return report;
+}
+
+void MeshConnectivity::BuildNeighborEdgeSlots(
+	Core::Container::ChunkedSpan<const Triangle> triangles,
+	std::span<NeighborEdgeSlots> neighborEdgeSlots,
+	uint32_t threadCount)
+{
+	assert(neighborEdgeSlots.size() == triangles.size());
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& curTriangle = triangles[iTriangle];
+			NeighborEdgeSlots curSlots;
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				const int neighborIdx = curTriangle.Neighbors[iEdge];
+				if(neighborIdx < 0 || static_cast<size_t>(neighborIdx) >= triangles.size())
+					continue;
+
+				// The shared edge goes in the opposite direction in the neighbor.
+				const Triangle& neighbor = triangles[neighborIdx];
+				const int firstVertexIdx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
+				const int secondVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+				for(EdgeIndex iNeighborEdge = 0; iNeighborEdge < 3; ++iNeighborEdge)
+				{
+					if(neighbor.Vertices[IndexHelpers::Next[iNeighborEdge]] == secondVertexIdx
+					   && neighbor.Vertices[IndexHelpers::Previous[iNeighborEdge]] == firstVertexIdx)
+						curSlots.Set(iEdge, iNeighborEdge);
+				}
+			}
+			neighborEdgeSlots[iTriangle] = curSlots;
+		},
+		ConnectivityGrainSize,
+		threadCount);
+}
+
+ConnectivityReport MeshConnectivity::Build(Data::Surface::Mesh& mesh, uint32_t threadCount)
+{
+	mesh.m_OneRingAdjacency.reset();
+	std::vector<NeighborEdgeSlots>& neighborEdgeSlots = mesh.m_NeighborEdgeSlots.Write();
+	neighborEdgeSlots.resize(mesh.m_Triangles.size());
+	std::vector<std::array<int, 3>> triangleEdges(mesh.m_Triangles.size());
+	std::vector<Edge> edges;
+	ConnectivityReport report = Build(
+		mesh.m_Vertices.Write(), mesh.m_Triangles.Write(), threadCount, neighborEdgeSlots, triangleEdges, &edges);
+
+	// The attribute values of an edge follow it if the previous edge table has it in the same triangle.
+	if(mesh.m_EdgeAttributes.GetCount() > 0)
+	{
+		const bool hadEdges = mesh.HasEdges();
+		std::vector<int> oldEdgeIndices(edges.size(), -1);
+		Core::Parallel::For(
+			hadEdges ? edges.size() : 0,
+			[&](size_t iEdge)
+			{
+				const Edge& curEdge = edges[iEdge];
+				const int oldEdgeIdx = mesh.m_TriangleEdges[curEdge.TriangleIdx][curEdge.EdgeIdx];
+				if(mesh.m_Edges[oldEdgeIdx].Vertices == curEdge.Vertices)
+					oldEdgeIndices[iEdge] = oldEdgeIdx;
+			},
+			ConnectivityGrainSize,
+			threadCount);
+		mesh.m_EdgeAttributes.Remap(oldEdgeIndices);
+	}
+
+	mesh.m_Edges = Core::Container::CowVector<Edge>(std::move(edges));
+	mesh.m_TriangleEdges = Core::Container::CowVector<std::array<int, 3>>(std::move(triangleEdges));
+	mesh.m_HasEdges = true;
+	return report;
+}
+} // namespace Utilitary::Surface
@@ -2,8 +2,13 @@
 
 #include "Application/ExtraDataContainer.h"
 #include "Application/ExtraDataType.h"
+#include "Application/MeshBinaryFormat.h"
 #include "Application/PrimitiveProxy.h"
 #include "Core/BaseType.h"
+#include "Core/ChunkedCowVector.h"
+#include "Core/FlatHashMap.h"
+#include "Core/FormatHelpers.h"
+#include "Core/ParallelHelpers.h"
 #include "Core/PrintHelpers.h"
 
 using namespace Data::Surface;
@@ -14,150 +19,491 @@ using namespace Core::BaseType;
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <fstream>
 #include <iostream>
-#include <unordered_set>
+#include <ranges>
+#include <span>
+#include <string>
+
+namespace
+{
+/// @brief Gather the data of an extra data type stored in each container into a contiguous array.
+/// @return True if every container has the extra data, false otherwise (values is then left empty).
+template<typename ExtraDataT, typename T>
+bool GatherExtraData(const std::vector<ExtraDataContainer>& containers, std::vector<T>& values)
+{
+	values.clear();
+	if(containers.empty() || !containers[0].Has<ExtraDataT>())
+		return false;
+
+	values.reserve(containers.size());
+	for(auto&& curContainer : containers)
+	{
+		const ExtraDataT* extraData = curContainer.Get<ExtraDataT>();
+		if(extraData == nullptr)
+		{
+			Warning("Extra data {} is not set on every primitive, it won't be exported", typeid(ExtraDataT).name());
+			values.clear();
+			return false;
+		}
+		values.emplace_back(extraData->GetData());
+	}
+	return true;
+}
+
+/// @brief Index the given values by their first occurrence, in a single hashed pass.
+/// @param values Values to index.
+/// @param uniqueValues Set to the distinct values, in order of first appearance.
+/// @return The index in uniqueValues of each value.
+template<typename T>
+std::vector<int> IndexUniqueValues(std::span<const T> values, std::vector<T>& uniqueValues)
+{
+	uniqueValues.clear();
+	std::vector<int> indices;
+	indices.reserve(values.size());
+	Core::Container::FlatHashMap<T, int> valueIndices;
+	for(const T& curValue : values)
+	{
+		const auto [valueIdx, isInserted] = valueIndices.TryEmplace(curValue, static_cast<int>(uniqueValues.size()));
+		if(isInserted)
+			uniqueValues.push_back(curValue);
+		indices.push_back(valueIdx);
+	}
+	return indices;
+}
+
+/// @brief Number of records formatted at once by a thread.
+constexpr size_t TextBlockSize = 1 << 14;
+
+/// @brief Format text records in parallel and write them in order.
+/// @param file File to write to.
+/// @param count Number of records.
+/// @param formatRecord Function appending the text of a record to a buffer, called as formatRecord(buffer, index).
+/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+/// @note Each round, every thread formats the next block of TextBlockSize records into its own buffer, then the
+/// buffers are written in block order. The bytes written thus do not depend on the thread count, and the memory used
+/// is bounded by the size of a round.
+template<typename Func>
+void WriteTextRecords(std::ofstream& file, size_t count, Func&& formatRecord, uint32_t threadCount)
+{
+	const uint32_t blockCount = Core::Parallel::GetRangeCount(count, TextBlockSize, threadCount);
+	std::vector<std::string> buffers(blockCount);
+	for(size_t roundBegin = 0; roundBegin < count; roundBegin += blockCount * TextBlockSize)
+	{
+		Core::Parallel::ForEachTask(
+			blockCount,
+			[&](uint32_t iBlock)
+			{
+				std::string& buffer = buffers[iBlock];
+				buffer.clear();
+				const size_t blockBegin = std::min(count, roundBegin + iBlock * TextBlockSize);
+				const size_t blockEnd = std::min(count, blockBegin + TextBlockSize);
+				for(size_t iRecord = blockBegin; iRecord < blockEnd; ++iRecord)
+					formatRecord(buffer, iRecord);
+			});
+
+		for(const std::string& curBuffer : buffers)
+			file.write(curBuffer.data(), static_cast<std::streamsize>(curBuffer.size()));
+	}
+}
+
+/// @brief Round offset up to the next multiple of the binary format chunk alignment.
+uint64_t AlignChunkOffset(uint64_t offset)
+{
+	constexpr uint64_t alignment = Utilitary::Surface::BinaryFormat::ChunkAlignment;
+	return (offset + alignment - 1) / alignment * alignment;
+}
+} // namespace
 
 namespace Utilitary::Surface
 {
-void MeshExporter::ExportOFF(const Mesh& mesh, const std::filesystem::path& filepath)
+void MeshExporter::ExportOFF(const Mesh& mesh, const std::filesystem::path& filepath, uint32_t threadCount)
 {
+	using Core::Format::AppendNumbers;
+
 	std::ofstream file(filepath, std::ios::trunc);
+	if(!file.is_open())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return;
+	}
 
 	Debug("Writing to {}", filepath.string());
 
-	// Write the OFF header.
-	file << "OFF" << '\n';
-
-	// Write the number of vertices, faces, and edges (0 for edges as per OFF format).
-	file << mesh.GetVertexCount() << ' ' << mesh.GetTriangleCount() << ' ' << 0 << '\n';
+	// Write the OFF header, with the number of vertices, faces, and edges (0 for edges as per OFF format).
+	std::string header = "OFF\n";
+	AppendNumbers(header, mesh.GetVertexCount(), mesh.GetTriangleCount(), 0);
+	header += '\n';
+	file.write(header.data(), static_cast<std::streamsize>(header.size()));
 
 	// Write vertex positions.
-	for(auto&& curVertex : mesh.m_Vertices)
-		file << curVertex.Position.x << ' ' << curVertex.Position.y << ' ' << curVertex.Position.z << '\n';
+	WriteTextRecords(
+		file,
+		mesh.m_Vertices.size(),
+		[&mesh](std::string& buffer, size_t iVertex)
+		{
+			const Vec3& position = mesh.m_Vertices[iVertex].Position;
+			AppendNumbers(buffer, position.x, position.y, position.z);
+			buffer += '\n';
+		},
+		threadCount);
 
 	// Write triangle definitions.
-	for(auto&& curFace : mesh.m_Triangles)
-		file << curFace.Vertices.size() << ' ' << (curFace.Vertices[0] + 1) << ' ' << (curFace.Vertices[1] + 1) << ' '
-			 << (curFace.Vertices[2] + 1) << '\n';
+	WriteTextRecords(
+		file,
+		mesh.m_Triangles.size(),
+		[&mesh](std::string& buffer, size_t iTriangle)
+		{
+			const std::array<int, 3>& vertices = mesh.m_Triangles[iTriangle].Vertices;
+			AppendNumbers(buffer, 3, vertices[0], vertices[1], vertices[2]);
+			buffer += '\n';
+		},
+		threadCount);
+
+	if(!file)
+		Error("Failed to write file: {}", filepath.string());
 
 	file.close();
 }
 
-void MeshExporter::ExportOBJ(const Mesh& mesh, const std::filesystem::path& filepath)
-
+void MeshExporter::ExportOBJ(const Mesh& mesh, const std::filesystem::path& filepath, uint32_t threadCount)
 {
+	using Core::Format::AppendNumber;
+	using Core::Format::AppendNumbers;
+
 	std::ofstream file(filepath, std::ios::trunc);
+	if(!file.is_open())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return;
+	}
 
 	Debug("Writing to {}", filepath.string());
 
 	// Write vertex positions.
-	for(auto&& curVertex : mesh.m_Vertices)
-		file << 'v' << ' ' << curVertex.Position.x << ' ' << curVertex.Position.y << ' ' << curVertex.Position.z << '\n';
+	WriteTextRecords(
+		file,
+		mesh.m_Vertices.size(),
+		[&mesh](std::string& buffer, size_t iVertex)
+		{
+			const Vec3& position = mesh.m_Vertices[iVertex].Position;
+			buffer += "v ";
+			AppendNumbers(buffer, position.x, position.y, position.z);
+			buffer += '\n';
+		},
+		threadCount);
 
-	// Write texture coordinates if available.
+	// Extra data are stored in one container per triangle: gather them into contiguous arrays.
+	std::vector<std::array<Vec2, 3>> triangleTexCoords;
+	std::vector<Vec3> triangleNormals;
+	GatherExtraData<VerticesTexCoordsExtraData>(mesh.m_TrianglesExtraDataContainer, triangleTexCoords);
+	GatherExtraData<TriangleNormalExtraData>(mesh.m_TrianglesExtraDataContainer, triangleNormals);
 
+	// Write the unique texture coordinates, each corner referencing its own.
+	std::vector<Vec2> cornerTexCoords;
+	cornerTexCoords.reserve(3 * triangleTexCoords.size());
+	for(auto&& curTexCoords : triangleTexCoords)
+		cornerTexCoords.insert(cornerTexCoords.end(), curTexCoords.begin(), curTexCoords.end());
 	std::vector<Vec2> uniqueTexCoords;
-	if(mesh.HasTrianglesExtraDataContainer() && mesh.m_TrianglesExtraDataContainer[0].Has<VerticesTexCoordsExtraData>())
-	{
-		std::unordered_set<Vec2> texCoords;
-		for(auto&& curTriangleED : mesh.m_TrianglesExtraDataContainer)
+	const std::vector<int> cornerTexCoordIndices = IndexUniqueValues<Vec2>(cornerTexCoords, uniqueTexCoords);
+	WriteTextRecords(
+		file,
+		uniqueTexCoords.size(),
+		[&uniqueTexCoords](std::string& buffer, size_t iTexCoords)
+		{
+			buffer += "vt ";
+			AppendNumbers(buffer, uniqueTexCoords[iTexCoords].x, uniqueTexCoords[iTexCoords].y);
+			buffer += '\n';
+		},
+		threadCount);
+
+	// Write the unique triangle normals.
+	std::vector<Vec3> uniqueTriangleNormals;
+	const std::vector<int> triangleNormalIndices = IndexUniqueValues<Vec3>(triangleNormals, uniqueTriangleNormals);
+	WriteTextRecords(
+		file,
+		uniqueTriangleNormals.size(),
+		[&uniqueTriangleNormals](std::string& buffer, size_t iNormal)
+		{
+			const Vec3& normal = uniqueTriangleNormals[iNormal];
+			buffer += "vn ";
+			AppendNumbers(buffer, normal.x, normal.y, normal.z);
+			buffer += '\n';
+		},
+		threadCount);
+
+	const bool hasTexCoords = !uniqueTexCoords.empty();
+	const bool hasNormals = !uniqueTriangleNormals.empty();
+	WriteTextRecords(
+		file,
+		mesh.m_Triangles.size(),
+		[&](std::string& buffer, size_t iTriangle)
 		{
-			auto texCoordsED = curTriangleED.Get<VerticesTexCoordsExtraData>();
-			assert(texCoordsED != nullptr && "All vertices must have texture coordinates if one has it");
-			for(auto&& curTexCoords : texCoordsED->GetData())
+			const Triangle& curTriangle = mesh.m_Triangles[iTriangle];
+			buffer += 'f';
+			for(VertexLocalIndex iCorner = 0; iCorner < 3; ++iCorner)
 			{
-				texCoords.insert(curTexCoords);
+				// OBJ format uses 1-based indexing
+				buffer += ' ';
+				AppendNumber(buffer, curTriangle.Vertices[iCorner] + 1);
+
+				// Check if texture coordinates and normals are available
+				if(hasTexCoords || hasNormals)
+				{
+					buffer += '/';
+					if(hasTexCoords)
+						AppendNumber(buffer, cornerTexCoordIndices[3 * iTriangle + iCorner] + 1);
+					if(hasNormals)
+					{
+						buffer += '/';
+						AppendNumber(buffer, triangleNormalIndices[iTriangle] + 1);
+					}
+				}
 			}
-		}
+			buffer += '\n';
+		},
+		threadCount);
 
-		uniqueTexCoords.insert(uniqueTexCoords.begin(), texCoords.begin(), texCoords.end());
-		for(auto&& curTexCoords : uniqueTexCoords)
-		{
-			file << "vt" << ' ' << curTexCoords.x << ' ' << curTexCoords.y << '\n';
-		}
+	if(!file)
+		Error("Failed to write file: {}", filepath.string());
+
+	file.close();
+}
+
+void MeshExporter::ExportPLY(const Mesh& mesh, const std::filesystem::path& filepath, PLYFormat::Encoding encoding)
+{
+	using namespace PLYFormat;
+
+	std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+	if(!file.is_open())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return;
 	}
 
-	bool hasTexCoords = !uniqueTexCoords.empty();
+	Debug("Writing to {}", filepath.string());
 
-	// Write face normals if available.
-	std::vector<Vec3> uniqueTriangleNormals;
-	if(mesh.HasTrianglesExtraDataContainer() && mesh.m_TrianglesExtraDataContainer[0].Has<TriangleNormalExtraData>())
+	// Extra data are stored in one container per vertex: gather them into contiguous arrays.
+	std::vector<Vec3> normals;
+	std::vector<Vec4> colors;
+	std::vector<float> qualities;
+	GatherExtraData<SmoothVertexNormalExtraData>(mesh.m_VerticesExtraDataContainer, normals);
+	GatherExtraData<VertexColorExtraData>(mesh.m_VerticesExtraDataContainer, colors);
+	GatherExtraData<VertexQualityExtraData>(mesh.m_VerticesExtraDataContainer, qualities);
+
+	auto ToColorChannel = [](float value)
 	{
-		std::unordered_set<Vec3> triangleNormals;
-		for(auto&& curTriangleED : mesh.m_TrianglesExtraDataContainer)
-		{
-			auto triangleNormalED = curTriangleED.Get<TriangleNormalExtraData>();
-			assert(triangleNormalED != nullptr && "All vertices must have a triangle normal if one has it");
-			const Vec3& triangleNormal = triangleNormalED->GetData();
-			triangleNormals.insert(triangleNormal);
-		}
+		return static_cast<uint8_t>(std::lround(std::clamp(value, 0.f, 1.f) * 255.f));
+	};
 
-		uniqueTriangleNormals.insert(uniqueTriangleNormals.begin(), triangleNormals.begin(), triangleNormals.end());
-		for(auto&& curTriangleNormal : uniqueTriangleNormals)
-		{
-			file << "vn" << ' ' << curTriangleNormal.x << ' ' << curTriangleNormal.y << ' ' << curTriangleNormal.z
-				 << '\n';
-		}
+	// Write the header.
+	file << "ply\n";
+	switch(encoding)
+	{
+		case Encoding::Ascii:
+			file << "format ascii 1.0\n";
+			break;
+		case Encoding::BinaryLittleEndian:
+			file << "format binary_little_endian 1.0\n";
+			break;
+		case Encoding::BinaryBigEndian:
+			file << "format binary_big_endian 1.0\n";
+			break;
 	}
+	file << "element vertex " << mesh.GetVertexCount() << '\n';
+	file << "property float x\nproperty float y\nproperty float z\n";
+	if(!normals.empty())
+		file << "property float nx\nproperty float ny\nproperty float nz\n";
+	if(!colors.empty())
+		file << "property uchar red\nproperty uchar green\nproperty uchar blue\nproperty uchar alpha\n";
+	if(!qualities.empty())
+		file << "property float quality\n";
+	file << "element face " << mesh.GetTriangleCount() << '\n';
+	file << "property list uchar int vertex_indices\n";
+	file << "end_header\n";
+
+	if(encoding == Encoding::Ascii)
+	{
+		using Core::Format::AppendNumber;
+		using Core::Format::AppendNumbers;
 
-	bool hasNormals = !uniqueTriangleNormals.empty();
+		WriteTextRecords(
+			file,
+			mesh.m_Vertices.size(),
+			[&](std::string& buffer, size_t iVertex)
+			{
+				const Vec3& position = mesh.m_Vertices[iVertex].Position;
+				AppendNumbers(buffer, position.x, position.y, position.z);
+				if(!normals.empty())
+				{
+					buffer += ' ';
+					AppendNumbers(buffer, normals[iVertex].x, normals[iVertex].y, normals[iVertex].z);
+				}
+				if(!colors.empty())
+				{
+					for(int iChannel = 0; iChannel < 4; ++iChannel)
+					{
+						buffer += ' ';
+						AppendNumber(buffer, static_cast<int>(ToColorChannel(colors[iVertex][iChannel])));
+					}
+				}
+				if(!qualities.empty())
+				{
+					buffer += ' ';
+					AppendNumber(buffer, qualities[iVertex]);
+				}
+				buffer += '\n';
+			},
+			0);
 
-	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		WriteTextRecords(
+			file,
+			mesh.m_Triangles.size(),
+			[&mesh](std::string& buffer, size_t iTriangle)
+			{
+				const std::array<int, 3>& vertices = mesh.m_Triangles[iTriangle].Vertices;
+				AppendNumbers(buffer, 3, vertices[0], vertices[1], vertices[2]);
+				buffer += '\n';
+			},
+			0);
+	}
+	else
 	{
-		const Triangle& curTriangle = mesh.m_Triangles[iTriangle];
-		auto&& curContainer = mesh.m_TrianglesExtraDataContainer[iTriangle];
-		file << 'f';
-		for(auto curVertexIdx : curTriangle.Vertices)
-		{
-			// OBJ format uses 1-based indexing
-			file << ' ' << (curVertexIdx + 1);
+		// Fixed-size records are filled in parallel, then written at once.
+		const bool isBigEndian = encoding == Encoding::BinaryBigEndian;
+		const size_t vertexStride = 3 * sizeof(float) + (normals.empty() ? 0 : 3 * sizeof(float))
+			+ (colors.empty() ? 0 : 4 * sizeof(uint8_t)) + (qualities.empty() ? 0 : sizeof(float));
+		const size_t triangleStride = sizeof(uint8_t) + 3 * sizeof(int32_t);
 
-			// Check if texture coordinates and normals are available
-			if(hasTexCoords || hasNormals)
+		std::vector<char> vertexRecords(mesh.GetVertexCount() * vertexStride);
+		Core::Parallel::For(
+			mesh.GetVertexCount(),
+			[&](size_t iVertex)
 			{
-				file << '/';
-				if(hasTexCoords)
+				char* record = vertexRecords.data() + iVertex * vertexStride;
+				auto WriteVec3 = [&record, isBigEndian](const Vec3& value)
+				{
+					for(int iCoord = 0; iCoord < 3; ++iCoord, record += sizeof(float))
+						WriteBinaryScalar(record, value[iCoord], isBigEndian);
+				};
+
+				WriteVec3(mesh.m_Vertices[iVertex].Position);
+				if(!normals.empty())
+					WriteVec3(normals[iVertex]);
+				if(!colors.empty())
 				{
-					auto texCoordsED = curContainer.Get<VerticesTexCoordsExtraData>();
-					assert(texCoordsED != nullptr);
-					int curVertexLocalIdx = GetVertexLocalIndex(curTriangle, curVertexIdx);
-					assert(curVertexLocalIdx != -1);
-					const Vec2& curTexCoods = texCoordsED->GetVertexTexCoords(curVertexLocalIdx);
-					ptrdiff_t position = std::find_if(
-											 std::begin(uniqueTexCoords),
-											 std::end(uniqueTexCoords),
-											 [curTexCoods](const Vec2& rhs)
-											 {
-												 return curTexCoods == rhs;
-											 })
-						- std::begin(uniqueTexCoords);
-					assert(static_cast<size_t>(position) < uniqueTexCoords.size());
-					file << static_cast<int>(position + 1);
+					for(int iChannel = 0; iChannel < 4; ++iChannel, ++record)
+						WriteBinaryScalar(record, ToColorChannel(colors[iVertex][iChannel]), isBigEndian);
 				}
+				if(!qualities.empty())
+					WriteBinaryScalar(record, qualities[iVertex], isBigEndian);
+			});
 
-				if(hasNormals)
+		std::vector<char> triangleRecords(mesh.GetTriangleCount() * triangleStride);
+		Core::Parallel::For(
+			mesh.GetTriangleCount(),
+			[&](size_t iTriangle)
+			{
+				char* record = triangleRecords.data() + iTriangle * triangleStride;
+				WriteBinaryScalar(record, uint8_t{ 3 }, isBigEndian);
+				for(VertexLocalIndex iVertex = 0; iVertex < 3; ++iVertex)
 				{
-					auto triangleNormalED = curContainer.Get<TriangleNormalExtraData>();
-					assert(triangleNormalED != nullptr);
-					const Vec3& triangleNormal = triangleNormalED->GetData();
-					file << '/';
-					ptrdiff_t position = std::find_if(
-											 std::begin(uniqueTriangleNormals),
-											 std::end(uniqueTriangleNormals),
-											 [triangleNormal](const Vec3& rhs)
-											 {
-												 return triangleNormal == rhs;
-											 })
-						- std::begin(uniqueTriangleNormals);
-					assert(static_cast<size_t>(position) < uniqueTriangleNormals.size());
-					file << static_cast<int>(position + 1);
+					WriteBinaryScalar(
+						record + sizeof(uint8_t) + iVertex * sizeof(int32_t),
+						static_cast<int32_t>(mesh.m_Triangles[iTriangle].Vertices[iVertex]),
+						isBigEndian);
 				}
-			}
+			});
+
+		file.write(vertexRecords.data(), static_cast<std::streamsize>(vertexRecords.size()));
+		file.write(triangleRecords.data(), static_cast<std::streamsize>(triangleRecords.size()));
+	}
+
+	if(!file)
+		Error("Failed to write file: {}", filepath.string());
+
+	file.close();
+}
+
+void MeshExporter::ExportBinary(const Mesh& mesh, const std::filesystem::path& filepath)
+{
+	using namespace BinaryFormat;
+
+	std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+	if(!file.is_open())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return;
+	}
+
+	Debug("Writing to {}", filepath.string());
+
+	// Extra data are stored in one container per primitive: gather them into contiguous arrays.
+	std::vector<Vec3> triangleNormals;
+	std::vector<std::array<Vec2, 3>> triangleTexCoords;
+	std::vector<Vec3> smoothVertexNormals;
+	GatherExtraData<TriangleNormalExtraData>(mesh.m_TrianglesExtraDataContainer, triangleNormals);
+	GatherExtraData<VerticesTexCoordsExtraData>(mesh.m_TrianglesExtraDataContainer, triangleTexCoords);
+	GatherExtraData<SmoothVertexNormalExtraData>(mesh.m_VerticesExtraDataContainer, smoothVertexNormals);
+
+	// List the chunks to write along with their data.
+	// The data of a chunk are split in contiguous parts, as the vertices and triangles may not be contiguous.
+	std::vector<std::pair<ChunkEntry, std::vector<std::span<const std::byte>>>> chunks;
+	auto AddChunk = [&chunks]<typename T>(ChunkType type, const T& values)
+	{
+		using Value = std::ranges::range_value_t<T>;
+		const Core::Container::ChunkedSpan<const Value> view = values;
+		ChunkEntry entry{ .Type = type, .ElementSize = sizeof(Value), .ElementCount = view.size() };
+		std::vector<std::span<const std::byte>> parts;
+		for(size_t iValue = 0; iValue < view.size();)
+		{
+			const std::span<const Value> curValues = view.GetContiguousValues(iValue);
+			parts.push_back(std::as_bytes(curValues));
+			iValue += curValues.size();
 		}
-		file << '\n';
+		chunks.emplace_back(entry, std::move(parts));
+	};
+	AddChunk(ChunkType::Vertices, mesh.m_Vertices);
+	AddChunk(ChunkType::Triangles, mesh.m_Triangles);
+	if(!triangleNormals.empty())
+		AddChunk(ChunkType::TriangleNormals, triangleNormals);
+	if(!triangleTexCoords.empty())
+		AddChunk(ChunkType::TriangleTexCoords, triangleTexCoords);
+	if(!smoothVertexNormals.empty())
+		AddChunk(ChunkType::SmoothVertexNormals, smoothVertexNormals);
+
+	// Compute the offset of each chunk.
+	FileHeader header{ .VertexCount = mesh.GetVertexCount(),
+					   .TriangleCount = mesh.GetTriangleCount(),
+					   .ChunkCount = static_cast<uint32_t>(chunks.size()),
+					   .ChunkTableOffset = sizeof(FileHeader) };
+	uint64_t offset = AlignChunkOffset(header.ChunkTableOffset + chunks.size() * sizeof(ChunkEntry));
+	for(auto&& [curEntry, curData] : chunks)
+	{
+		curEntry.Offset = offset;
+		offset = AlignChunkOffset(offset + curEntry.ElementCount * curEntry.ElementSize);
+	}
+
+	// Write the header and the chunk table.
+	file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+	for(auto&& [curEntry, curData] : chunks)
+		file.write(reinterpret_cast<const char*>(&curEntry), sizeof(ChunkEntry));
+
+	// Write each chunk, padded to its offset.
+	const std::array<char, ChunkAlignment> padding{};
+	for(auto&& [curEntry, curData] : chunks)
+	{
+		const uint64_t paddingSize = curEntry.Offset - static_cast<uint64_t>(file.tellp());
+		file.write(padding.data(), static_cast<std::streamsize>(paddingSize));
+		for(const std::span<const std::byte>& curPart : curData)
+			file.write(reinterpret_cast<const char*>(curPart.data()), static_cast<std::streamsize>(curPart.size()));
 	}
 
+	if(!file)
+		Error("Failed to write file: {}", filepath.string());
+
 	file.close();
 }
 } // namespace Utilitary::Surface
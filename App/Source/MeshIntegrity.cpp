@@ -1,5 +1,8 @@
 #include "Application/MeshIntegrity.h"
 
+#include <algorithm>
+#include <array>
+
 using namespace Core::BaseType;
 using namespace Data::Primitive;
 using namespace Data::Surface;
@@ -30,6 +33,9 @@ MeshIntegrity::ExitCode MeshIntegrity::CheckIntegrity(const Mesh& mesh)
 	// Check the integrity of each triangle of the mesh.
 	int vertexCount = static_cast<int>(mesh.GetVertexCount());
 	int triangleCount = static_cast<int>(mesh.GetTriangleCount());
+	const bool hasNeighborEdgeSlots = mesh.HasNeighborEdgeSlots();
+	const bool hasEdges = mesh.HasEdges();
+	const int edgeCount = static_cast<int>(mesh.GetEdgeCount());
 	for(int iTriangle = 0; iTriangle < triangleCount; ++iTriangle)
 	{
 		const Triangle& curTriangle = mesh.m_Triangles[iTriangle];
@@ -48,8 +54,31 @@ MeshIntegrity::ExitCode MeshIntegrity::CheckIntegrity(const Mesh& mesh)
 			if(curTriangle.Vertices[iEdge] >= vertexCount)
 				return MeshIntegrity::ExitCode::InvalidVertexIndex;
 
-			// Check that each neighbor triangle is reciprocal.
+			// Check that the edge table has the edge of the vertices.
 			int neighborIdx = curTriangle.Neighbors[iEdge];
+			if(hasEdges)
+			{
+				const int edgeIdx = mesh.m_TriangleEdges[iTriangle][iEdge];
+				if(edgeIdx < 0 || edgeIdx >= edgeCount)
+					return ExitCode::EdgeTableMismatch;
+				const int firstVertexIdx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
+				const int secondVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+				const auto [minVertexIdx, maxVertexIdx] = std::minmax(firstVertexIdx, secondVertexIdx);
+				if(mesh.m_Edges[edgeIdx].Vertices != std::array<int, 2>{ minVertexIdx, maxVertexIdx })
+					return ExitCode::EdgeTableMismatch;
+
+				// The neighbor across the edge must share it.
+				if(neighborIdx >= 0 && neighborIdx < triangleCount
+				   && std::ranges::count(mesh.m_TriangleEdges[neighborIdx], edgeIdx) == 0)
+					return ExitCode::EdgeTableMismatch;
+			}
+
+			// Check that each neighbor triangle is reciprocal.
+			const EdgeIndex neighborEdgeIdx =
+				hasNeighborEdgeSlots ? mesh.m_NeighborEdgeSlots[iTriangle].Get(iEdge) : NeighborEdgeSlots::NoEdge;
+			if(neighborIdx == -1 && neighborEdgeIdx != NeighborEdgeSlots::NoEdge)
+				return ExitCode::NeighborEdgeSlotMismatch;
+
 			if(neighborIdx != -1)
 			{
 				// Get the two vertices defining the edge opposite to the neighbor.
@@ -66,6 +95,18 @@ MeshIntegrity::ExitCode MeshIntegrity::CheckIntegrity(const Mesh& mesh)
 
 				// Get the neighbor triangle and the two vertices.
 				const Triangle& neighbor = mesh.m_Triangles[neighborIdx];
+				if(neighborEdgeIdx != NeighborEdgeSlots::NoEdge)
+				{
+					// The slot must give the shared edge, in the opposite direction, and the neighbor must point back.
+					if(static_cast<VertexIndex>(neighbor.Vertices[IndexHelpers::Next[neighborEdgeIdx]]) != v1Idx
+					   || static_cast<VertexIndex>(neighbor.Vertices[IndexHelpers::Previous[neighborEdgeIdx]]) != v0Idx
+					   || mesh.m_NeighborEdgeSlots[neighborIdx].Get(neighborEdgeIdx) != iEdge)
+						return ExitCode::NeighborEdgeSlotMismatch;
+					if(neighbor.Neighbors[neighborEdgeIdx] != iTriangle)
+						return ExitCode::TriangleNeighborNotReciprocal;
+					continue;
+				}
+
 				int edgeIndex = Utilitary::Primitive::GetEdgeIndex(neighbor, v0Idx, v1Idx);
 
 				// Check that the neighbor has the current triangle as neighbor on the same edge.
@@ -74,6 +115,14 @@ MeshIntegrity::ExitCode MeshIntegrity::CheckIntegrity(const Mesh& mesh)
 			}
 		}
 	}
+	// Check that each edge is in its triangle.
+	for(int iEdge = 0; hasEdges && iEdge < edgeCount; ++iEdge)
+	{
+		const Edge& curEdge = mesh.m_Edges[iEdge];
+		if(curEdge.TriangleIdx < 0 || curEdge.TriangleIdx >= triangleCount || curEdge.EdgeIdx > 2
+		   || mesh.m_TriangleEdges[curEdge.TriangleIdx][curEdge.EdgeIdx] != iEdge)
+			return ExitCode::EdgeTableMismatch;
+	}
 	return MeshIntegrity::ExitCode::MeshOK;
 }
 } // namespace Utilitary::Surface
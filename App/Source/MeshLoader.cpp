@@ -1,20 +1,34 @@
 #include "Application/MeshLoader.h"
 
 #include "Application/ExtraDataType.h"
+#include "Application/MeshBinaryFormat.h"
+#include "Application/MeshConnectivity.h"
+#include "Application/PLYFormat.h"
 #include "Application/PrimitiveProxy.h"
-#include "Application/VertexPair.h"
+#include "Core/Hash.h"
+#include "Core/MappedFile.h"
+#include "Core/ParallelHelpers.h"
+#include "Core/ParseHelpers.h"
 #include "Core/PrintHelpers.h"
+#include "Core/RadixSort.h"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <chrono>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <unordered_map>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 using namespace Data::Surface;
 using namespace Data::Primitive;
 using namespace Data::ExtraData;
 using namespace Core::BaseType;
+using namespace Core::Parse;
 
 namespace
 {
@@ -55,10 +69,587 @@ int ReadNextInteger(std::ifstream& file)
 	// Convert string to index
 	return std::stoi(buffer) - 1;
 }
+
+/// @brief Minimal size of an OBJ chunk, parsed by its own thread.
+constexpr size_t MinOBJChunkSize = size_t(1) << 20;
+
+/// @brief Number of bytes parsed between two progress updates.
+constexpr ptrdiff_t ProgressGranularity = ptrdiff_t(1) << 20;
+
+/// @brief Report the bytes parsed in a buffer to a LoadProgress, at most once per ProgressGranularity bytes.
+class ProgressReporter
+{
+public:
+	ProgressReporter(Utilitary::Surface::LoadProgress* progress, const char* begin)
+		: m_Progress(progress)
+		, m_ReportedCur(begin)
+	{}
+
+	/// @brief Report the bytes parsed up to cur if enough bytes have been parsed since the last report.
+	/// @return False if the cancellation has been requested.
+	bool Update(const char* cur)
+	{
+		if(m_Progress == nullptr || cur - m_ReportedCur < ProgressGranularity)
+			return true;
+		return Flush(cur);
+	}
+
+	/// @brief Report the bytes parsed up to cur.
+	/// @return False if the cancellation has been requested.
+	bool Flush(const char* cur)
+	{
+		if(m_Progress == nullptr)
+			return true;
+
+		m_Progress->AddByteCount(static_cast<uint64_t>(cur - m_ReportedCur));
+		m_ReportedCur = cur;
+		return !m_Progress->IsCancelRequested();
+	}
+
+private:
+	/// @brief Progress to update (may be null).
+	Utilitary::Surface::LoadProgress* m_Progress;
+	/// @brief End of the bytes already reported.
+	const char* m_ReportedCur;
+};
+
+/// @brief Set the phase of a loading if its progress is tracked.
+void SetLoadPhase(Utilitary::Surface::LoadProgress* progress, Utilitary::Surface::LoadPhase phase)
+{
+	if(progress != nullptr)
+		progress->SetPhase(phase);
+}
+
+/// @brief Check if the cancellation of a loading has been requested.
+bool IsCancelRequested(const Utilitary::Surface::LoadProgress* progress)
+{
+	return progress != nullptr && progress->IsCancelRequested();
+}
+
+/// @brief Stop a loading after a cancellation request.
+/// @return nullptr, to be returned by the loader.
+std::unique_ptr<Mesh> CancelLoading(Utilitary::Surface::LoadProgress* progress, const std::filesystem::path& filepath)
+{
+	SetLoadPhase(progress, Utilitary::Surface::LoadPhase::Cancelled);
+	Info("Loading cancelled: {}", filepath.string());
+	return nullptr;
+}
+
+/// @brief Channels referenced by an OBJ face corner.
+enum OBJChannel : uint8_t
+{
+	Position = 0,
+	TexCoord,
+	Normal,
+	ChannelCount
+};
+
+/// @brief Face corner read from an OBJ file.
+struct OBJCorner
+{
+	/// @brief 0-based index for each channel (-1 if the channel is not referenced).
+	std::array<int, OBJChannel::ChannelCount> Indices{ -1, -1, -1 };
+	/// @brief Bit i is set if Indices[i] is relative to the first record of the chunk.
+	uint8_t RelativeMask{ 0 };
+};
+
+/// @brief Records parsed from a chunk of an OBJ file.
+struct OBJChunk
+{
+	/// @brief Vertex positions (v).
+	std::vector<Vec3> Positions;
+	/// @brief Texture coordinates (vt).
+	std::vector<Vec2> TexCoords;
+	/// @brief Normals (vn).
+	std::vector<Vec3> Normals;
+	/// @brief Triangle corners (3 consecutive corners per triangle).
+	std::vector<OBJCorner> Corners;
+	/// @brief Whether the chunk contains an invalid record.
+	bool HasError{ false };
+	/// @brief Whether the parsing has been stopped by a cancellation request.
+	bool IsCancelled{ false };
+};
+
+/// @brief Parse a face corner (v, v/vt, v//vn or v/vt/vn) from a token.
+/// @param token Token to parse.
+/// @param localCounts Number of records of each channel already read in the chunk (to resolve negative indices).
+/// @param corner Parsed corner.
+/// @return True if the corner is valid, false otherwise.
+bool ParseOBJCorner(
+	std::string_view token, const std::array<size_t, OBJChannel::ChannelCount>& localCounts, OBJCorner& corner)
+{
+	const char* cur = token.data();
+	const char* end = cur + token.size();
+	for(uint8_t iChannel = 0; iChannel < OBJChannel::ChannelCount && cur != end; ++iChannel)
+	{
+		if(iChannel > 0)
+		{ // Skip '/' character.
+			if(*cur != '/')
+				return false;
+			++cur;
+		}
+
+		// The channel is not referenced (e.g. v//vn).
+		if(cur == end || *cur == '/')
+		{
+			if(iChannel == OBJChannel::Position)
+				return false;
+			continue;
+		}
+
+		int index;
+		auto [ptr, errorCode] = std::from_chars(cur, end, index);
+		if(errorCode != std::errc() || index == 0)
+			return false;
+		cur = ptr;
+
+		if(index > 0)
+		{ // OBJ format uses 1-based indexing.
+			corner.Indices[iChannel] = index - 1;
+		}
+		else
+		{ // Negative indices are relative to the last record read.
+			corner.Indices[iChannel] = static_cast<int>(localCounts[iChannel]) + index;
+			corner.RelativeMask |= static_cast<uint8_t>(1u << iChannel);
+		}
+	}
+
+	const bool hasPosition = corner.Indices[OBJChannel::Position] != -1 || (corner.RelativeMask & 1u);
+	return cur == end && hasPosition;
+}
+
+/// @brief Parse all the records of a newline-aligned chunk of an OBJ file.
+void ParseOBJChunk(const char* cur, const char* end, OBJChunk& chunk, Utilitary::Surface::LoadProgress* progress)
+{
+	ProgressReporter reporter(progress, cur);
+
+	// Corners of the current face, reused from one face to the next.
+	std::vector<OBJCorner> faceCorners;
+
+	while(cur != end)
+	{
+		const char* lineEnd = static_cast<const char*>(std::memchr(cur, '\n', static_cast<size_t>(end - cur)));
+		if(lineEnd == nullptr)
+			lineEnd = end;
+
+		const std::string_view type = ParseToken(cur, lineEnd);
+		if(type == "v")
+		{ // Vertex position
+			Vec3& position = chunk.Positions.emplace_back();
+			chunk.HasError |= !ParseNumber(cur, lineEnd, position.x) || !ParseNumber(cur, lineEnd, position.y)
+				|| !ParseNumber(cur, lineEnd, position.z);
+		}
+		else if(type == "vt")
+		{ // Vertex texture coordinate
+			Vec2& texCoords = chunk.TexCoords.emplace_back();
+			chunk.HasError |= !ParseNumber(cur, lineEnd, texCoords.x) || !ParseNumber(cur, lineEnd, texCoords.y);
+		}
+		else if(type == "vn")
+		{ // Normal vector
+			Vec3& normal = chunk.Normals.emplace_back();
+			chunk.HasError |= !ParseNumber(cur, lineEnd, normal.x) || !ParseNumber(cur, lineEnd, normal.y)
+				|| !ParseNumber(cur, lineEnd, normal.z);
+		}
+		else if(type == "f")
+		{ // Face, triangulated as a fan.
+			const std::array<size_t, OBJChannel::ChannelCount> localCounts{ chunk.Positions.size(),
+																			  chunk.TexCoords.size(),
+																			  chunk.Normals.size() };
+			faceCorners.clear();
+			for(std::string_view token = ParseToken(cur, lineEnd); !token.empty(); token = ParseToken(cur, lineEnd))
+			{
+				if(token.front() == '#')
+					break;
+
+				OBJCorner& corner = faceCorners.emplace_back();
+				chunk.HasError |= !ParseOBJCorner(token, localCounts, corner);
+			}
+
+			chunk.HasError |= faceCorners.size() < 3;
+			for(size_t iCorner = 2; iCorner < faceCorners.size(); ++iCorner)
+			{
+				chunk.Corners.emplace_back(faceCorners[0]);
+				chunk.Corners.emplace_back(faceCorners[iCorner - 1]);
+				chunk.Corners.emplace_back(faceCorners[iCorner]);
+			}
+		}
+		// Other records (comments, groups, materials, ...) are ignored.
+
+		if(chunk.HasError)
+			return;
+
+		cur = lineEnd == end ? end : lineEnd + 1;
+		if(!reporter.Update(cur))
+		{
+			chunk.IsCancelled = true;
+			return;
+		}
+	}
+
+	chunk.IsCancelled = !reporter.Flush(end);
+}
+
+/// @brief Indices of the PLY vertex properties mapped to the mesh (-1 if the property is missing).
+struct PLYVertexLayout
+{
+	/// @brief Properties x, y, z.
+	std::array<int, 3> Position{ -1, -1, -1 };
+	/// @brief Properties nx, ny, nz.
+	std::array<int, 3> Normal{ -1, -1, -1 };
+	/// @brief Properties red, green, blue and the optional alpha.
+	std::array<int, 4> Color{ -1, -1, -1, -1 };
+	/// @brief Property quality (or confidence).
+	int Quality{ -1 };
+
+	/// @brief Check if the vertices have a position.
+	bool HasPosition() const { return std::ranges::find(Position, -1) == Position.end(); }
+	/// @brief Check if the vertices have a normal.
+	bool HasNormal() const { return std::ranges::find(Normal, -1) == Normal.end(); }
+	/// @brief Check if the vertices have a color.
+	bool HasColor() const { return Color[0] != -1 && Color[1] != -1 && Color[2] != -1; }
+	/// @brief Check if the vertices have a quality.
+	bool HasQuality() const { return Quality != -1; }
+};
+
+/// @brief Find the vertex properties mapped to the mesh.
+PLYVertexLayout GetPLYVertexLayout(const Utilitary::Surface::PLYFormat::Element& element)
+{
+	PLYVertexLayout layout;
+	layout.Position = { element.FindProperty("x"), element.FindProperty("y"), element.FindProperty("z") };
+	layout.Normal = { element.FindProperty("nx"), element.FindProperty("ny"), element.FindProperty("nz") };
+	layout.Color = { element.FindProperty("red"),
+					 element.FindProperty("green"),
+					 element.FindProperty("blue"),
+					 element.FindProperty("alpha") };
+	layout.Quality = element.FindProperty("quality");
+	if(layout.Quality == -1)
+		layout.Quality = element.FindProperty("confidence");
+
+	// List properties can't be mapped to a vertex attribute.
+	auto IsScalar = [&element](int propertyIdx)
+	{
+		return propertyIdx == -1 || !element.Properties[propertyIdx].IsList;
+	};
+	if(!std::ranges::all_of(layout.Normal, IsScalar))
+		layout.Normal = { -1, -1, -1 };
+	if(!std::ranges::all_of(layout.Color, IsScalar))
+		layout.Color = { -1, -1, -1, -1 };
+	if(!IsScalar(layout.Quality))
+		layout.Quality = -1;
+	return layout;
+}
+
+/// @brief Get the factor converting a PLY color channel to [0, 1].
+float GetPLYColorScale(Utilitary::Surface::PLYFormat::ScalarType type)
+{
+	using Utilitary::Surface::PLYFormat::ScalarType;
+	switch(type)
+	{
+		case ScalarType::Int8:
+		case ScalarType::UInt8:
+			return 1.f / 255.f;
+		case ScalarType::Int16:
+		case ScalarType::UInt16:
+			return 1.f / 65535.f;
+		default:
+			return 1.f;
+	}
+}
+
+/// @brief Vertex attributes read from a PLY file.
+struct PLYVertexAttributes
+{
+	/// @brief Normal of each vertex (empty if not in the file).
+	std::vector<Vec3> Normals;
+	/// @brief Color of each vertex (empty if not in the file).
+	std::vector<Vec4> Colors;
+	/// @brief Quality of each vertex (empty if not in the file).
+	std::vector<float> Qualities;
+};
+
+/// @brief Store the scalar values of a PLY vertex record into the mesh arrays.
+/// @param getValue Function returning the value of a property as a float.
+template<typename GetValueFunc>
+void SetPLYVertex(const PLYVertexLayout& layout,
+				  const std::array<float, 4>& colorScales,
+				  size_t vertexIdx,
+				  GetValueFunc&& getValue,
+				  Vertex& vertex,
+				  PLYVertexAttributes& attributes)
+{
+	vertex.Position = { getValue(layout.Position[0]), getValue(layout.Position[1]), getValue(layout.Position[2]) };
+	if(!attributes.Normals.empty())
+		attributes.Normals[vertexIdx] = {
+			getValue(layout.Normal[0]), getValue(layout.Normal[1]), getValue(layout.Normal[2])
+		};
+	if(!attributes.Colors.empty())
+	{
+		Vec4& color = attributes.Colors[vertexIdx];
+		for(int iChannel = 0; iChannel < 4; ++iChannel)
+			color[iChannel] =
+				layout.Color[iChannel] != -1 ? getValue(layout.Color[iChannel]) * colorScales[iChannel] : 1.f;
+	}
+	if(!attributes.Qualities.empty())
+		attributes.Qualities[vertexIdx] = getValue(layout.Quality);
+}
+
+/// @brief Read one record of a PLY element.
+/// @param cur Cursor on the record, moved past it on success.
+/// @param end End of the data.
+/// @param element Element of the record.
+/// @param format Encoding of the record.
+/// @param listPropertyIdx Index of the list property whose items are kept (-1 for none).
+/// @param scalars Value of each scalar property (indexed by property, 0 for list properties).
+/// @param listItems Items of the kept list property.
+/// @return True if the record is valid, false otherwise.
+bool ReadPLYRecord(const char*& cur,
+				   const char* end,
+				   const Utilitary::Surface::PLYFormat::Element& element,
+				   Utilitary::Surface::PLYFormat::Encoding format,
+				   int listPropertyIdx,
+				   std::vector<double>& scalars,
+				   std::vector<int64_t>& listItems)
+{
+	using namespace Utilitary::Surface::PLYFormat;
+
+	scalars.assign(element.Properties.size(), 0.);
+	listItems.clear();
+
+	const bool isBigEndian = format == Encoding::BinaryBigEndian;
+	for(size_t iProperty = 0; iProperty < element.Properties.size(); ++iProperty)
+	{
+		const Property& curProperty = element.Properties[iProperty];
+		const bool isKeptList = static_cast<int>(iProperty) == listPropertyIdx;
+
+		if(format == Encoding::Ascii)
+		{
+			if(!curProperty.IsList)
+			{
+				if(!ParseNumber(cur, end, scalars[iProperty]))
+					return false;
+				continue;
+			}
+
+			uint64_t itemCount;
+			if(!ParseNumber(cur, end, itemCount))
+				return false;
+			for(uint64_t iItem = 0; iItem < itemCount; ++iItem)
+			{
+				double item;
+				if(!ParseNumber(cur, end, item))
+					return false;
+				if(isKeptList)
+					listItems.emplace_back(static_cast<int64_t>(item));
+			}
+			continue;
+		}
+
+		if(!curProperty.IsList)
+		{
+			const uint32_t size = GetScalarSize(curProperty.Type);
+			if(static_cast<size_t>(end - cur) < size)
+				return false;
+			scalars[iProperty] = ReadBinaryScalar<double>(cur, curProperty.Type, isBigEndian);
+			cur += size;
+			continue;
+		}
+
+		const uint32_t countSize = GetScalarSize(curProperty.CountType);
+		if(static_cast<size_t>(end - cur) < countSize)
+			return false;
+		const auto itemCount = ReadBinaryScalar<uint64_t>(cur, curProperty.CountType, isBigEndian);
+		cur += countSize;
+
+		const uint32_t itemSize = GetScalarSize(curProperty.Type);
+		if(itemCount > static_cast<size_t>(end - cur) / itemSize)
+			return false;
+		if(isKeptList)
+		{
+			for(uint64_t iItem = 0; iItem < itemCount; ++iItem)
+				listItems.emplace_back(
+					ReadBinaryScalar<int64_t>(cur + iItem * itemSize, curProperty.Type, isBigEndian));
+		}
+		cur += itemCount * itemSize;
+	}
+	return true;
+}
+
+/// @brief Size of the header of a binary STL file (80-byte comment followed by the facet count).
+constexpr size_t STLHeaderSize = 84;
+/// @brief Size of a binary STL facet record (normal, 3 corner positions and attribute byte count).
+constexpr size_t STLFacetSize = 50;
+
+/// @brief Read a little-endian scalar of a binary STL file.
+template<typename T>
+T ReadSTLScalar(const char* ptr)
+{
+	using UIntT = std::conditional_t<sizeof(T) == 4, uint32_t, uint16_t>;
+	UIntT value;
+	std::memcpy(&value, ptr, sizeof(T));
+	if constexpr(std::endian::native == std::endian::big)
+		value = std::byteswap(value);
+	return std::bit_cast<T>(value);
+}
+
+/// @brief Weld the corners of a triangle soup sharing the same position into the vertices of an indexed mesh.
+/// @param cornerPositions Position of each triangle corner, three consecutive corners per triangle.
+/// @param vertices Unique vertices, in order of first appearance.
+/// @param triangles Triangles of the soup, without the degenerated ones.
+/// @return Number of triangles dropped because two of their corners have been welded.
+/// @note Corners are sorted by a hash of the bits of their position (see Core::Hash::HashVector) with a parallel
+/// radix sort, so that identical positions end up in the same run. The runs are then resolved in parallel, the first
+/// corner of each position representing it.
+size_t WeldTriangleSoup(const std::vector<Vec3>& cornerPositions,
+						std::vector<Vertex>& vertices,
+						std::vector<Triangle>& triangles)
+{
+	struct HashedCorner
+	{
+		uint64_t Hash;
+		uint32_t CornerIdx;
+	};
+
+	const size_t cornerCount = cornerPositions.size();
+
+	// Twice as many hash bits as needed to index the corners keep collisions rare, while sparing radix passes.
+	const auto hashBitCount =
+		std::min<uint32_t>(64, 2 * static_cast<uint32_t>(std::bit_width(cornerCount)) + 8);
+	const uint64_t hashMask = hashBitCount == 64 ? ~uint64_t(0) : (uint64_t(1) << hashBitCount) - 1;
+
+	std::vector<HashedCorner> hashedCorners(cornerCount);
+	Core::Parallel::For(
+		cornerCount,
+		[&](size_t iCorner)
+		{
+			hashedCorners[iCorner] = { .Hash = Core::Hash::HashVector(cornerPositions[iCorner]) & hashMask,
+									   .CornerIdx = static_cast<uint32_t>(iCorner) };
+		});
+
+	// The sort is stable: the corners of a run stay in file order.
+	Core::Parallel::RadixSort(
+		hashedCorners,
+		[](const HashedCorner& corner)
+		{
+			return corner.Hash;
+		},
+		hashBitCount);
+
+	std::vector<size_t> runBegins;
+	for(size_t iSorted = 0; iSorted < cornerCount; ++iSorted)
+	{
+		if(iSorted == 0 || hashedCorners[iSorted].Hash != hashedCorners[iSorted - 1].Hash)
+			runBegins.emplace_back(iSorted);
+	}
+	runBegins.emplace_back(cornerCount);
+
+	// Map each corner to the first corner of its run with the same position (hash collisions are rare).
+	std::vector<uint32_t> representatives(cornerCount);
+	Core::Parallel::For(
+		runBegins.size() - 1,
+		[&](size_t iRun)
+		{
+			for(size_t iSorted = runBegins[iRun]; iSorted < runBegins[iRun + 1]; ++iSorted)
+			{
+				const Vec3& position = cornerPositions[hashedCorners[iSorted].CornerIdx];
+				size_t iFirst = runBegins[iRun];
+				while(iFirst < iSorted && cornerPositions[hashedCorners[iFirst].CornerIdx] != position)
+					++iFirst;
+				representatives[hashedCorners[iSorted].CornerIdx] = hashedCorners[iFirst].CornerIdx;
+			}
+		},
+		1024);
+
+	// Number the vertices in order of first appearance.
+	std::vector<int> cornerVertexIndices(cornerCount, -1);
+	vertices.clear();
+	for(size_t iCorner = 0; iCorner < cornerCount; ++iCorner)
+	{
+		if(representatives[iCorner] != iCorner)
+			continue;
+		cornerVertexIndices[iCorner] = static_cast<int>(vertices.size());
+		vertices.push_back({ .Position = cornerPositions[iCorner] });
+	}
+
+	triangles.resize(cornerCount / 3);
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			for(VertexLocalIndex iVertex = 0; iVertex < 3; ++iVertex)
+			{
+				const uint32_t representative = representatives[3 * iTriangle + iVertex];
+				triangles[iTriangle].Vertices[iVertex] = cornerVertexIndices[representative];
+			}
+		});
+
+	return std::erase_if(
+		triangles,
+		[](const Triangle& triangle)
+		{
+			const auto& vertexIndices = triangle.Vertices;
+			return vertexIndices[0] == vertexIndices[1] || vertexIndices[1] == vertexIndices[2]
+				|| vertexIndices[2] == vertexIndices[0];
+		});
+}
 } // namespace
 
 namespace Utilitary::Surface
 {
+double LoadStatistics::GetThroughput() const
+{
+	if(ElapsedSeconds <= 0.)
+		return 0.;
+	return static_cast<double>(ByteCount) / ElapsedSeconds;
+}
+
+uint64_t LoadProgress::GetByteCount() const
+{
+	return m_ByteCount.load(std::memory_order_relaxed);
+}
+
+uint64_t LoadProgress::GetTotalByteCount() const
+{
+	return m_TotalByteCount.load(std::memory_order_relaxed);
+}
+
+double LoadProgress::GetRatio() const
+{
+	const uint64_t totalByteCount = GetTotalByteCount();
+	if(totalByteCount == 0)
+		return GetPhase() == LoadPhase::Done ? 1. : 0.;
+	return std::min(static_cast<double>(GetByteCount()) / static_cast<double>(totalByteCount), 1.);
+}
+
+LoadPhase LoadProgress::GetPhase() const
+{
+	return m_Phase.load(std::memory_order_acquire);
+}
+
+void LoadProgress::RequestCancel()
+{
+	m_IsCancelRequested.store(true, std::memory_order_relaxed);
+}
+
+bool LoadProgress::IsCancelRequested() const
+{
+	return m_IsCancelRequested.load(std::memory_order_relaxed);
+}
+
+void LoadProgress::SetTotalByteCount(uint64_t byteCount)
+{
+	m_TotalByteCount.store(byteCount, std::memory_order_relaxed);
+}
+
+void LoadProgress::AddByteCount(uint64_t byteCount)
+{
+	m_ByteCount.fetch_add(byteCount, std::memory_order_relaxed);
+}
+
+void LoadProgress::SetPhase(LoadPhase phase)
+{
+	m_Phase.store(phase, std::memory_order_release);
+}
+
 std::unique_ptr<Mesh> MeshLoader::LoadOFF(const std::filesystem::path& filepath)
 {
 	std::ifstream file(filepath);
@@ -88,36 +679,18 @@ std::unique_ptr<Mesh> MeshLoader::LoadOFF(const std::filesystem::path& filepath)
 	file >> vertexCount >> faceCount >> unusedEdgeCount;
 
 	// Reading vertices
-	mesh->m_Vertices.resize(vertexCount);
-	for(auto&& curVertex : mesh->m_Vertices)
+	mesh->m_Vertices = Core::Container::ChunkedCowVector<Vertex>(std::vector<Vertex>(vertexCount));
+	for(auto&& curVertex : mesh->m_Vertices.Write())
 	{
 		SkipCommentsAndWhitespace(file);
 		file >> curVertex.Position.x >> curVertex.Position.y >> curVertex.Position.z;
 	}
 
-	// Map to store edges and their corresponding triangle and edge index
-	std::unordered_map<VertexPair, std::pair<TriangleIndex, EdgeIndex>> neighborMap;
-
-	// Set neighboring faces using the edges
-	auto SetFacesNeigbhor =
-		[&](TriangleIndex faceIdx, VertexIndex firstVertexIdx, VertexIndex secondVertexIdx, EdgeIndex edgeIdx)
-	{
-		if(neighborMap.find({ firstVertexIdx, secondVertexIdx }) == neighborMap.end())
-		{
-			neighborMap[{ firstVertexIdx, secondVertexIdx }] = { faceIdx, edgeIdx };
-		}
-		else // The edge with firstVertex and secondVertex is already registered in map
-		{
-			auto [faceNeighborIdx, neighborEdgeIdx] = neighborMap[{ firstVertexIdx, secondVertexIdx }];
-			mesh->m_Triangles[faceNeighborIdx].Neighbors[neighborEdgeIdx] = faceIdx;
-			mesh->m_Triangles[faceIdx].Neighbors[edgeIdx] = faceNeighborIdx;
-		}
-	};
-
-	mesh->m_Triangles.resize(faceCount);
+	mesh->m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::vector<Triangle>(faceCount));
+	const Core::Container::ChunkedSpan<Triangle> faces = mesh->m_Triangles.Write();
 	for(int iTriangle = 0; iTriangle < faceCount; ++iTriangle)
 	{
-		Triangle& curFace = mesh->m_Triangles[iTriangle];
+		Triangle& curFace = faces[iTriangle];
 
 		SkipCommentsAndWhitespace(file);
 
@@ -129,30 +702,133 @@ std::unique_ptr<Mesh> MeshLoader::LoadOFF(const std::filesystem::path& filepath)
 			VertexIndex curVertexIdx;
 			file >> curVertexIdx;
 
-			// Get pointers to the vertex.
-			Vertex& curVertex = mesh->m_Vertices[curVertexIdx];
-
-			// Set IncidentTriangleIdx for the vertex if it's not already the case.
-			if(curVertex.IncidentTriangleIdx == -1)
-				curVertex.IncidentTriangleIdx = iTriangle;
-
 			// Set vertices of the triangle.
 			curFace.Vertices[iEdge] = curVertexIdx;
 		}
+	}
+
+	file.close();
+
+	// Set neighbors and incident triangles.
+	mesh->UpdateMeshConnectivity();
+
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshLoader::LoadOFFMapped(
+	const std::filesystem::path& filepath, LoadStatistics* statistics, LoadProgress* progress)
+{
+	const auto startTime = std::chrono::steady_clock::now();
+
+	Core::IO::MappedFile file(filepath);
 
-		const VertexIndex iVertex0 = static_cast<VertexIndex>(curFace.Vertices[0]);
-		const VertexIndex iVertex1 = static_cast<VertexIndex>(curFace.Vertices[1]);
-		const VertexIndex iVertex2 = static_cast<VertexIndex>(curFace.Vertices[2]);
+	// Checking file opening
+	if(!file.IsOpen())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return nullptr;
+	}
+
+	const char* cur = file.GetData();
+	const char* end = cur + file.GetSize();
 
-		// Edge v0-v1
-		SetFacesNeigbhor(iTriangle, iVertex0, iVertex1, 2);
-		// Edge v1-v2
-		SetFacesNeigbhor(iTriangle, iVertex1, iVertex2, 0);
-		// Edge v2-v0
-		SetFacesNeigbhor(iTriangle, iVertex2, iVertex0, 1);
+	if(progress != nullptr)
+		progress->SetTotalByteCount(file.GetSize());
+	SetLoadPhase(progress, LoadPhase::Parsing);
+	ProgressReporter reporter(progress, cur);
+
+	// Checking file type
+	SkipWhitespaceAndComments(cur, end);
+	if(ParseToken(cur, end) != "OFF")
+	{
+		Error("Wrong file format (must be OFF) : {}", filepath.string());
+		return nullptr;
 	}
 
-	file.close();
+	// Retrieving the number of vertices / faces
+	SkipWhitespaceAndComments(cur, end);
+	int vertexCount, faceCount, unusedEdgeCount;
+	if(!ParseNumber(cur, end, vertexCount) || !ParseNumber(cur, end, faceCount)
+	   || !ParseNumber(cur, end, unusedEdgeCount) || vertexCount < 0 || faceCount < 0)
+	{
+		Error("Invalid OFF header : {}", filepath.string());
+		return nullptr;
+	}
+
+	// The arrays are allocated from the header counts: check that their records can fit in the file first. A vertex
+	// takes at least 6 bytes ("0 0 0\n") and a face 8 bytes ("3 0 0 0\n"), the last one needing no newline.
+	const size_t minRecordsSize = 6 * static_cast<size_t>(vertexCount) + 8 * static_cast<size_t>(faceCount);
+	if(minRecordsSize > static_cast<size_t>(end - cur) + 1)
+	{
+		Error("Unexpected end of file : {}", filepath.string());
+		return nullptr;
+	}
+
+	auto mesh = std::make_unique<Mesh>();
+
+	// Reading vertices
+	mesh->m_Vertices = Core::Container::ChunkedCowVector<Vertex>(std::vector<Vertex>(vertexCount));
+	for(auto&& curVertex : mesh->m_Vertices.Write())
+	{
+		SkipWhitespaceAndComments(cur, end);
+		Vec3& position = curVertex.Position;
+		if(!ParseNumber(cur, end, position.x) || !ParseNumber(cur, end, position.y)
+		   || !ParseNumber(cur, end, position.z))
+		{
+			Error("Invalid vertex position : {}", filepath.string());
+			return nullptr;
+		}
+
+		if(!reporter.Update(cur))
+			return CancelLoading(progress, filepath);
+	}
+
+	// Reading triangles
+	mesh->m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::vector<Triangle>(faceCount));
+	for(auto&& curFace : mesh->m_Triangles.Write())
+	{
+		SkipWhitespaceAndComments(cur, end);
+
+		int faceVertexCount;
+		if(!ParseNumber(cur, end, faceVertexCount) || faceVertexCount != 3)
+		{
+			Error("Only triangular faces are supported : {}", filepath.string());
+			return nullptr;
+		}
+
+		for(int& curVertexIdx : curFace.Vertices)
+		{
+			if(!ParseNumber(cur, end, curVertexIdx) || curVertexIdx < 0 || curVertexIdx >= vertexCount)
+			{
+				Error("Invalid vertex index : {}", filepath.string());
+				return nullptr;
+			}
+		}
+
+		if(!reporter.Update(cur))
+			return CancelLoading(progress, filepath);
+	}
+
+	if(!reporter.Flush(end))
+		return CancelLoading(progress, filepath);
+
+	// Set neighbors and incident triangles.
+	SetLoadPhase(progress, LoadPhase::BuildingConnectivity);
+	mesh->UpdateMeshConnectivity();
+	SetLoadPhase(progress, LoadPhase::Done);
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+	const LoadStatistics curStatistics{ .ByteCount = file.GetSize(), .ElapsedSeconds = elapsed.count() };
+	Debug(
+		"Loaded {} bytes from {} in {:.3f}s ({:.1f} MB/s)",
+		curStatistics.ByteCount,
+		filepath.string(),
+		curStatistics.ElapsedSeconds,
+		curStatistics.GetThroughput() / 1.e6);
+
+	if(statistics != nullptr)
+		*statistics = curStatistics;
+
 	return mesh;
 }
 
@@ -176,30 +852,11 @@ std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
 
 	auto mesh = std::make_unique<Mesh>();
 
-	// Map to store edges and their corresponding triangle and edge index.
-	std::unordered_map<VertexPair, std::pair<TriangleIndex, EdgeIndex>> neighborMap;
-
 	// While store texture coordinates informations.
 	std::vector<Vec2> texCoords;
 	// While store triangle (flat) normal informations.
 	std::vector<Vec3> flatNormals;
 
-	// Set neighboring faces using the edges
-	auto SetFacesNeigbhor =
-		[&](TriangleIndex faceIdx, VertexIndex firstVertexIdx, VertexIndex secondVertexIdx, EdgeIndex edgeIdx)
-	{
-		if(neighborMap.find({ firstVertexIdx, secondVertexIdx }) == neighborMap.end())
-		{
-			neighborMap[{ firstVertexIdx, secondVertexIdx }] = { faceIdx, edgeIdx };
-		}
-		else // The edge with firstVertex and secondVertex is already registered in map
-		{
-			auto [faceNeighborIdx, neighborEdgeIdx] = neighborMap[{ firstVertexIdx, secondVertexIdx }];
-			mesh->m_Triangles[faceNeighborIdx].Neighbors[neighborEdgeIdx] = faceIdx;
-			mesh->m_Triangles[faceIdx].Neighbors[edgeIdx] = faceNeighborIdx;
-		}
-	};
-
 	std::string type;
 	while(file.peek() != EOF)
 	{
@@ -254,21 +911,20 @@ std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
 		}
 		else if(type == "f")
 		{ // Triangle (triangle)
-			const TriangleIndex curTriangleIdx = mesh->GetTriangleCount();
 			Triangle& curFace = mesh->m_Triangles.emplace_back();
-			auto& curContainer = mesh->m_TrianglesExtraDataContainer.emplace_back();
+			auto& curContainer = mesh->m_TrianglesExtraDataContainer.Write().emplace_back();
 
 			// Read three vertices for the triangle
 			for(VertexLocalIndex iVertex = 0; iVertex < 3; ++iVertex)
 			{
 				int curVertexIdx = ReadNextInteger(file);
 				assert(curVertexIdx != -1);
-				Vertex& curVertex = mesh->m_Vertices[curVertexIdx];
-				if(curVertex.IncidentTriangleIdx == -1)
-					curVertex.IncidentTriangleIdx = curTriangleIdx;
-
 				curFace.Vertices[iVertex] = curVertexIdx;
 
+				// Position only.
+				if(file.peek() != '/')
+					continue;
+
 				// Skip '/' character.
 				file.ignore(1);
 
@@ -292,22 +948,695 @@ std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
 					faceNormal.SetData(flatNormals[flatNormalIdx]);
 				}
 			}
+		}
+	}
 
-			const VertexIndex iVertex0 = static_cast<VertexIndex>(curFace.Vertices[0]);
-			const VertexIndex iVertex1 = static_cast<VertexIndex>(curFace.Vertices[1]);
-			const VertexIndex iVertex2 = static_cast<VertexIndex>(curFace.Vertices[2]);
+	file.close();
+
+	// Set neighbors and incident triangles.
+	mesh->UpdateMeshConnectivity();
+
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshLoader::LoadOBJParallel(
+	const std::filesystem::path& filepath, uint32_t threadCount, LoadStatistics* statistics, LoadProgress* progress)
+{
+	const auto startTime = std::chrono::steady_clock::now();
+
+	Core::IO::MappedFile file(filepath);
 
-			// Edge v0-v1
-			SetFacesNeigbhor(curTriangleIdx, iVertex0, iVertex1, 2);
-			// Edge v1-v2
-			SetFacesNeigbhor(curTriangleIdx, iVertex1, iVertex2, 0);
-			// Edge v2-v0
-			SetFacesNeigbhor(curTriangleIdx, iVertex2, iVertex0, 1);
+	// Checking file opening
+	if(!file.IsOpen())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return nullptr;
+	}
+
+	// Check file extension
+	if(filepath.extension() != ".obj")
+	{
+		Error("Wrong file extension (must be .obj): {}", filepath.string());
+		return nullptr;
+	}
+
+	const char* begin = file.GetData();
+	const char* end = begin + file.GetSize();
+
+	if(progress != nullptr)
+		progress->SetTotalByteCount(file.GetSize());
+	SetLoadPhase(progress, LoadPhase::Parsing);
+
+	// Split the file into chunks starting at the beginning of a line.
+	const uint32_t chunkCount = Core::Parallel::GetRangeCount(file.GetSize(), MinOBJChunkSize, threadCount);
+	std::vector<const char*> chunkBounds(chunkCount + 1, end);
+	chunkBounds[0] = begin;
+	for(uint32_t iChunk = 1; iChunk < chunkCount; ++iChunk)
+	{
+		const char* cur = begin + Core::Parallel::GetRangeBegin(file.GetSize(), chunkCount, iChunk);
+		cur = std::max(cur, chunkBounds[iChunk - 1]);
+		if(cur != begin && cur[-1] != '\n')
+			SkipLine(cur, end);
+		chunkBounds[iChunk] = cur;
+	}
+
+	// Parse each chunk into its own buffers.
+	std::vector<OBJChunk> chunks(chunkCount);
+	Core::Parallel::ForEachTask(
+		chunkCount,
+		[&](uint32_t iChunk)
+		{
+			ParseOBJChunk(chunkBounds[iChunk], chunkBounds[iChunk + 1], chunks[iChunk], progress);
+		});
+
+	const bool isCancelled = std::ranges::any_of(
+		chunks,
+		[](const OBJChunk& chunk)
+		{
+			return chunk.IsCancelled;
+		});
+	if(isCancelled)
+		return CancelLoading(progress, filepath);
+
+	// Prefix sum of the record counts to get the global index of the first record of each chunk.
+	std::vector<std::array<size_t, OBJChannel::ChannelCount>> channelOffsets(chunkCount + 1);
+	std::vector<size_t> triangleOffsets(chunkCount + 1, 0);
+	for(uint32_t iChunk = 0; iChunk < chunkCount; ++iChunk)
+	{
+		const OBJChunk& curChunk = chunks[iChunk];
+		if(curChunk.HasError)
+		{
+			Error("Invalid record in file: {}", filepath.string());
+			return nullptr;
 		}
+
+		channelOffsets[iChunk + 1] = { channelOffsets[iChunk][OBJChannel::Position] + curChunk.Positions.size(),
+									   channelOffsets[iChunk][OBJChannel::TexCoord] + curChunk.TexCoords.size(),
+									   channelOffsets[iChunk][OBJChannel::Normal] + curChunk.Normals.size() };
+		triangleOffsets[iChunk + 1] = triangleOffsets[iChunk] + curChunk.Corners.size() / 3;
 	}
+	const std::array<size_t, OBJChannel::ChannelCount>& channelCounts = channelOffsets[chunkCount];
+
+	SetLoadPhase(progress, LoadPhase::Merging);
+
+	auto mesh = std::make_unique<Mesh>();
+	mesh->m_Vertices =
+		Core::Container::ChunkedCowVector<Vertex>(std::vector<Vertex>(channelCounts[OBJChannel::Position]));
+	mesh->m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::vector<Triangle>(triangleOffsets[chunkCount]));
+	const Core::Container::ChunkedSpan<Vertex> vertices = mesh->m_Vertices.Write();
+	const Core::Container::ChunkedSpan<Triangle> triangles = mesh->m_Triangles.Write();
+
+	const bool hasExtraData = channelCounts[OBJChannel::TexCoord] > 0 || channelCounts[OBJChannel::Normal] > 0;
+	if(hasExtraData)
+		mesh->AddTrianglesExtraDataContainer();
+	auto& triangleContainers = mesh->m_TrianglesExtraDataContainer.Write();
+
+	// Merge the vertex records.
+	std::vector<Vec2> texCoords(channelCounts[OBJChannel::TexCoord]);
+	std::vector<Vec3> flatNormals(channelCounts[OBJChannel::Normal]);
+	Core::Parallel::ForEachTask(
+		chunkCount,
+		[&](uint32_t iChunk)
+		{
+			const OBJChunk& curChunk = chunks[iChunk];
+			const auto& curOffsets = channelOffsets[iChunk];
+			for(size_t iPosition = 0; iPosition < curChunk.Positions.size(); ++iPosition)
+				vertices[curOffsets[OBJChannel::Position] + iPosition].Position = curChunk.Positions[iPosition];
+			std::copy(
+				curChunk.TexCoords.begin(),
+				curChunk.TexCoords.end(),
+				texCoords.begin() + static_cast<ptrdiff_t>(curOffsets[OBJChannel::TexCoord]));
+			std::copy(
+				curChunk.Normals.begin(),
+				curChunk.Normals.end(),
+				flatNormals.begin() + static_cast<ptrdiff_t>(curOffsets[OBJChannel::Normal]));
+		});
+
+	// Resolve the face indices and merge the triangles.
+	std::atomic<bool> hasInvalidIndex{ false };
+	Core::Parallel::ForEachTask(
+		chunkCount,
+		[&](uint32_t iChunk)
+		{
+			const OBJChunk& curChunk = chunks[iChunk];
+			const auto& curOffsets = channelOffsets[iChunk];
+			for(size_t iCorner = 0; iCorner < curChunk.Corners.size(); ++iCorner)
+			{
+				const OBJCorner& curCorner = curChunk.Corners[iCorner];
+				const size_t curTriangleIdx = triangleOffsets[iChunk] + iCorner / 3;
+				const VertexLocalIndex curVertexLocalIdx = static_cast<VertexLocalIndex>(iCorner % 3);
+
+				// Get the global index of each channel.
+				std::array<int, OBJChannel::ChannelCount> indices;
+				for(uint8_t iChannel = 0; iChannel < OBJChannel::ChannelCount; ++iChannel)
+				{
+					indices[iChannel] = curCorner.Indices[iChannel];
+
+					const bool isRelative = curCorner.RelativeMask & (1u << iChannel);
+					if(isRelative)
+						indices[iChannel] += static_cast<int>(curOffsets[iChannel]);
+					else if(indices[iChannel] == -1)
+						continue; // The channel is not referenced.
+
+					if(indices[iChannel] < 0 || indices[iChannel] >= static_cast<int>(channelCounts[iChannel]))
+					{
+						hasInvalidIndex = true;
+						return;
+					}
+				}
+
+				triangles[curTriangleIdx].Vertices[curVertexLocalIdx] = indices[OBJChannel::Position];
+
+				if(!hasExtraData)
+					continue;
+
+				auto& curContainer = triangleContainers[curTriangleIdx];
+				if(indices[OBJChannel::TexCoord] != -1)
+				{ // Vertex texCoords index.
+					auto& verticesTexCoords = curContainer.GetOrCreate<VerticesTexCoordsExtraData>();
+					verticesTexCoords.SetVertexTexCoords(texCoords[indices[OBJChannel::TexCoord]], curVertexLocalIdx);
+				}
+
+				if(indices[OBJChannel::Normal] != -1)
+				{ // Flat normal index.
+					auto& faceNormal = curContainer.GetOrCreate<TriangleNormalExtraData>();
+					faceNormal.SetData(flatNormals[indices[OBJChannel::Normal]]);
+				}
+			}
+		});
+
+	if(hasInvalidIndex)
+	{
+		Error("Invalid face index in file: {}", filepath.string());
+		return nullptr;
+	}
+
+	if(IsCancelRequested(progress))
+		return CancelLoading(progress, filepath);
+
+	// Set neighbors and incident triangles.
+	SetLoadPhase(progress, LoadPhase::BuildingConnectivity);
+	mesh->UpdateMeshConnectivity();
+	SetLoadPhase(progress, LoadPhase::Done);
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+	const LoadStatistics curStatistics{ .ByteCount = file.GetSize(), .ElapsedSeconds = elapsed.count() };
+	Debug(
+		"Loaded {} bytes from {} with {} threads in {:.3f}s ({:.1f} MB/s)",
+		curStatistics.ByteCount,
+		filepath.string(),
+		chunkCount,
+		curStatistics.ElapsedSeconds,
+		curStatistics.GetThroughput() / 1.e6);
+
+	if(statistics != nullptr)
+		*statistics = curStatistics;
+
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshLoader::LoadBinary(
+	const std::filesystem::path& filepath, LoadStatistics* statistics, LoadProgress* progress)
+{
+	const auto startTime = std::chrono::steady_clock::now();
+
+	std::unique_ptr<BinaryMeshView> view = BinaryMeshView::Open(filepath);
+	if(view == nullptr)
+		return nullptr;
+
+	if(progress != nullptr)
+		progress->SetTotalByteCount(view->GetFileSize());
+	if(IsCancelRequested(progress))
+		return CancelLoading(progress, filepath);
+	SetLoadPhase(progress, LoadPhase::Merging);
+
+	auto mesh = std::make_unique<Mesh>();
+
+	// Copy the arrays in bulk, the connectivity is already computed (except the edge table, which is not stored).
+	mesh->m_Vertices = Core::Container::ChunkedCowVector<Vertex>(
+		std::vector<Vertex>(view->GetVertices().begin(), view->GetVertices().end()));
+	mesh->m_Triangles = Core::Container::ChunkedCowVector<Triangle>(
+		std::vector<Triangle>(view->GetTriangles().begin(), view->GetTriangles().end()));
+	mesh->m_NeighborEdgeSlots.Write().resize(mesh->m_Triangles.size());
+	MeshConnectivity::BuildNeighborEdgeSlots(mesh->m_Triangles, mesh->m_NeighborEdgeSlots.Write());
+
+	// Set the extra data stored in the file.
+	std::span<const Vec3> triangleNormals = view->GetTriangleNormals();
+	std::span<const std::array<Vec2, 3>> triangleTexCoords = view->GetTriangleTexCoords();
+	if(!triangleNormals.empty() || !triangleTexCoords.empty())
+	{
+		mesh->AddTrianglesExtraDataContainer();
+		auto& triangleContainers = mesh->m_TrianglesExtraDataContainer.Write();
+		for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+		{
+			auto& curContainer = triangleContainers[iTriangle];
+			if(!triangleNormals.empty())
+				curContainer.GetOrCreate<TriangleNormalExtraData>().SetData(triangleNormals[iTriangle]);
+			if(!triangleTexCoords.empty())
+				curContainer.GetOrCreate<VerticesTexCoordsExtraData>().SetData(triangleTexCoords[iTriangle]);
+		}
+	}
+
+	std::span<const Vec3> smoothVertexNormals = view->GetSmoothVertexNormals();
+	if(!smoothVertexNormals.empty())
+	{
+		mesh->AddVerticesExtraDataContainer();
+		auto& vertexContainers = mesh->m_VerticesExtraDataContainer.Write();
+		for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+		{
+			auto& curContainer = vertexContainers[iVertex];
+			curContainer.GetOrCreate<SmoothVertexNormalExtraData>().SetData(smoothVertexNormals[iVertex]);
+		}
+	}
+
+	if(progress != nullptr)
+		progress->AddByteCount(view->GetFileSize());
+	SetLoadPhase(progress, LoadPhase::Done);
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+	const LoadStatistics curStatistics{ .ByteCount = view->GetFileSize(), .ElapsedSeconds = elapsed.count() };
+	Debug(
+		"Loaded {} bytes from {} in {:.3f}s ({:.1f} MB/s)",
+		curStatistics.ByteCount,
+		filepath.string(),
+		curStatistics.ElapsedSeconds,
+		curStatistics.GetThroughput() / 1.e6);
+
+	if(statistics != nullptr)
+		*statistics = curStatistics;
 
-	file.close();
 	return mesh;
 }
 
+std::unique_ptr<Mesh> MeshLoader::LoadPLY(
+	const std::filesystem::path& filepath, LoadStatistics* statistics, LoadProgress* progress)
+{
+	using namespace PLYFormat;
+
+	const auto startTime = std::chrono::steady_clock::now();
+
+	Core::IO::MappedFile file(filepath);
+
+	// Checking file opening
+	if(!file.IsOpen())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return nullptr;
+	}
+
+	// Checking file type
+	Header header;
+	if(!ParseHeader(file.GetView(), header))
+	{
+		Error("Wrong file format (must be PLY) : {}", filepath.string());
+		return nullptr;
+	}
+
+	const int vertexElementIdx = header.FindElement("vertex");
+	const int faceElementIdx = header.FindElement("face");
+	if(vertexElementIdx == -1)
+	{
+		Error("Missing vertex element : {}", filepath.string());
+		return nullptr;
+	}
+
+	const Element& vertexElement = header.Elements[vertexElementIdx];
+	const PLYVertexLayout vertexLayout = GetPLYVertexLayout(vertexElement);
+	if(!vertexLayout.HasPosition() || vertexElement.Count > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+	{
+		Error("Invalid vertex element : {}", filepath.string());
+		return nullptr;
+	}
+
+	int faceIndicesIdx = -1;
+	if(faceElementIdx != -1)
+	{
+		const Element& faceElement = header.Elements[faceElementIdx];
+		faceIndicesIdx = faceElement.FindProperty("vertex_indices");
+		if(faceIndicesIdx == -1)
+			faceIndicesIdx = faceElement.FindProperty("vertex_index");
+		if(faceIndicesIdx == -1 || !faceElement.Properties[faceIndicesIdx].IsList)
+		{
+			Error("Invalid face element : {}", filepath.string());
+			return nullptr;
+		}
+	}
+
+	const char* begin = file.GetData();
+	const char* cur = begin + header.DataOffset;
+	const char* end = begin + file.GetSize();
+
+	if(progress != nullptr)
+		progress->SetTotalByteCount(file.GetSize());
+	SetLoadPhase(progress, LoadPhase::Parsing);
+	ProgressReporter reporter(progress, begin);
+
+	const bool isBigEndian = header.Format == Encoding::BinaryBigEndian;
+	const auto vertexCount = static_cast<size_t>(vertexElement.Count);
+
+	// The vertices are allocated from the header count: check that their records can fit in the file first (the last
+	// ASCII value needs no separator).
+	const uint32_t minVertexSize = std::max(vertexElement.GetMinRecordSize(header.Format), 1u);
+	if(vertexCount > (static_cast<size_t>(end - cur) + 1) / minVertexSize)
+	{
+		Error("Unexpected end of file : {}", filepath.string());
+		return nullptr;
+	}
+
+	std::vector<Vertex> vertices(vertexCount);
+	std::vector<Triangle> triangles;
+
+	PLYVertexAttributes attributes;
+	if(vertexLayout.HasNormal())
+		attributes.Normals.resize(vertexCount);
+	if(vertexLayout.HasColor())
+		attributes.Colors.resize(vertexCount);
+	if(vertexLayout.HasQuality())
+		attributes.Qualities.resize(vertexCount);
+
+	std::array<float, 4> colorScales{ 1.f, 1.f, 1.f, 1.f };
+	for(int iChannel = 0; iChannel < 4 && vertexLayout.HasColor(); ++iChannel)
+	{
+		if(vertexLayout.Color[iChannel] != -1)
+			colorScales[iChannel] = GetPLYColorScale(vertexElement.Properties[vertexLayout.Color[iChannel]].Type);
+	}
+
+	// Read the elements in file order, the records of other elements are skipped.
+	std::vector<double> scalars;
+	std::vector<int64_t> listItems;
+	for(size_t iElement = 0; iElement < header.Elements.size(); ++iElement)
+	{
+		const Element& curElement = header.Elements[iElement];
+		const bool isVertexElement = static_cast<int>(iElement) == vertexElementIdx;
+		const bool isFaceElement = static_cast<int>(iElement) == faceElementIdx;
+
+		// Vertices with a fixed binary layout are read in place, in parallel.
+		const uint32_t stride = curElement.GetFixedStride();
+		if(isVertexElement && header.Format != Encoding::Ascii && stride != 0)
+		{
+			if(curElement.Count > static_cast<size_t>(end - cur) / stride)
+			{
+				Error("Unexpected end of file : {}", filepath.string());
+				return nullptr;
+			}
+
+			std::vector<uint32_t> offsets(curElement.Properties.size());
+			for(size_t iProperty = 0; iProperty < offsets.size(); ++iProperty)
+				offsets[iProperty] = curElement.GetPropertyOffset(static_cast<int>(iProperty));
+
+			Core::Parallel::For(
+				vertexCount,
+				[&](size_t iVertex)
+				{
+					const char* record = cur + iVertex * stride;
+					auto GetValue = [&](int propertyIdx)
+					{
+						return ReadBinaryScalar<float>(
+							record + offsets[propertyIdx], curElement.Properties[propertyIdx].Type, isBigEndian);
+					};
+					SetPLYVertex(vertexLayout, colorScales, iVertex, GetValue, vertices[iVertex], attributes);
+				});
+
+			cur += vertexCount * stride;
+			if(!reporter.Update(cur))
+				return CancelLoading(progress, filepath);
+			continue;
+		}
+
+		// Triangles with a fixed binary layout are read in place, in parallel.
+		if(isFaceElement && header.Format != Encoding::Ascii && curElement.Properties.size() == 1)
+		{
+			const Property& indicesProperty = curElement.Properties[faceIndicesIdx];
+			const uint32_t countSize = GetScalarSize(indicesProperty.CountType);
+			const uint32_t indexSize = GetScalarSize(indicesProperty.Type);
+			const uint32_t triangleStride = countSize + 3 * indexSize;
+			if(curElement.Count <= static_cast<size_t>(end - cur) / triangleStride)
+			{
+				const auto triangleCount = static_cast<size_t>(curElement.Count);
+				triangles.resize(triangleCount);
+
+				std::atomic<bool> isTriangleLayout{ true };
+				std::atomic<bool> hasInvalidIndex{ false };
+				Core::Parallel::For(
+					triangleCount,
+					[&](size_t iTriangle)
+					{
+						const char* record = cur + iTriangle * triangleStride;
+						if(ReadBinaryScalar<uint64_t>(record, indicesProperty.CountType, isBigEndian) != 3)
+						{
+							isTriangleLayout.store(false, std::memory_order_relaxed);
+							return;
+						}
+
+						Triangle& curTriangle = triangles[iTriangle];
+						for(VertexLocalIndex iVertex = 0; iVertex < 3; ++iVertex)
+						{
+							const auto vertexIdx = ReadBinaryScalar<int64_t>(
+								record + countSize + iVertex * indexSize, indicesProperty.Type, isBigEndian);
+							if(vertexIdx < 0 || static_cast<uint64_t>(vertexIdx) >= vertexCount)
+								hasInvalidIndex.store(true, std::memory_order_relaxed);
+							curTriangle.Vertices[iVertex] = static_cast<int>(vertexIdx);
+						}
+					});
+
+				// Polygonal faces are read by the generic path below.
+				if(isTriangleLayout)
+				{
+					if(hasInvalidIndex)
+					{
+						Error("Invalid vertex index : {}", filepath.string());
+						return nullptr;
+					}
+
+					cur += triangleCount * triangleStride;
+					if(!reporter.Update(cur))
+						return CancelLoading(progress, filepath);
+					continue;
+				}
+				triangles.clear();
+			}
+		}
+
+		// Generic path, record by record.
+		const int listPropertyIdx = isFaceElement ? faceIndicesIdx : -1;
+		for(uint64_t iRecord = 0; iRecord < curElement.Count; ++iRecord)
+		{
+			if(!ReadPLYRecord(cur, end, curElement, header.Format, listPropertyIdx, scalars, listItems))
+			{
+				Error("Invalid {} record : {}", curElement.Name, filepath.string());
+				return nullptr;
+			}
+
+			if(isVertexElement)
+			{
+				auto GetValue = [&scalars](int propertyIdx)
+				{
+					return static_cast<float>(scalars[propertyIdx]);
+				};
+				SetPLYVertex(vertexLayout, colorScales, iRecord, GetValue, vertices[iRecord], attributes);
+			}
+			else if(isFaceElement)
+			{
+				const bool isValid = listItems.size() >= 3
+					&& std::ranges::all_of(
+										 listItems,
+										 [vertexCount](int64_t vertexIdx)
+										 {
+											 return vertexIdx >= 0 && static_cast<uint64_t>(vertexIdx) < vertexCount;
+										 });
+				if(!isValid)
+				{
+					Error("Invalid face : {}", filepath.string());
+					return nullptr;
+				}
+
+				// Polygons are triangulated as fans.
+				for(size_t iItem = 2; iItem < listItems.size(); ++iItem)
+				{
+					triangles.push_back({ .Vertices = { static_cast<int>(listItems[0]),
+														static_cast<int>(listItems[iItem - 1]),
+														static_cast<int>(listItems[iItem]) } });
+				}
+			}
+
+			if(!reporter.Update(cur))
+				return CancelLoading(progress, filepath);
+		}
+	}
+
+	if(!reporter.Flush(end))
+		return CancelLoading(progress, filepath);
+
+	auto mesh = std::make_unique<Mesh>();
+	mesh->m_Vertices = Core::Container::ChunkedCowVector<Vertex>(std::move(vertices));
+	mesh->m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::move(triangles));
+
+	// Map the extra vertex properties to extra data.
+	SetLoadPhase(progress, LoadPhase::Merging);
+	if(!attributes.Normals.empty() || !attributes.Colors.empty() || !attributes.Qualities.empty())
+	{
+		mesh->AddVerticesExtraDataContainer();
+		auto& vertexContainers = mesh->m_VerticesExtraDataContainer.Write();
+		for(VertexIndex iVertex = 0; iVertex < vertexCount; ++iVertex)
+		{
+			auto& curContainer = vertexContainers[iVertex];
+			if(!attributes.Normals.empty())
+				curContainer.GetOrCreate<SmoothVertexNormalExtraData>().SetData(attributes.Normals[iVertex]);
+			if(!attributes.Colors.empty())
+				curContainer.GetOrCreate<VertexColorExtraData>().SetData(attributes.Colors[iVertex]);
+			if(!attributes.Qualities.empty())
+				curContainer.GetOrCreate<VertexQualityExtraData>().SetData(attributes.Qualities[iVertex]);
+		}
+	}
+
+	// Set neighbors and incident triangles.
+	SetLoadPhase(progress, LoadPhase::BuildingConnectivity);
+	mesh->UpdateMeshConnectivity();
+	SetLoadPhase(progress, LoadPhase::Done);
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+	const LoadStatistics curStatistics{ .ByteCount = file.GetSize(), .ElapsedSeconds = elapsed.count() };
+	Debug(
+		"Loaded {} bytes from {} in {:.3f}s ({:.1f} MB/s)",
+		curStatistics.ByteCount,
+		filepath.string(),
+		curStatistics.ElapsedSeconds,
+		curStatistics.GetThroughput() / 1.e6);
+
+	if(statistics != nullptr)
+		*statistics = curStatistics;
+
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshLoader::LoadSTL(
+	const std::filesystem::path& filepath, LoadStatistics* statistics, LoadProgress* progress)
+{
+	const auto startTime = std::chrono::steady_clock::now();
+
+	Core::IO::MappedFile file(filepath);
+
+	// Checking file opening
+	if(!file.IsOpen())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return nullptr;
+	}
+
+	const char* begin = file.GetData();
+	const char* cur = begin;
+	const char* end = begin + file.GetSize();
+
+	if(progress != nullptr)
+		progress->SetTotalByteCount(file.GetSize());
+	SetLoadPhase(progress, LoadPhase::Parsing);
+	ProgressReporter reporter(progress, begin);
+
+	// A binary file is recognized by its size, as some exporters start their binary header with "solid" too.
+	uint64_t facetCount = 0;
+	if(file.GetSize() >= STLHeaderSize)
+		facetCount = ReadSTLScalar<uint32_t>(begin + STLHeaderSize - sizeof(uint32_t));
+	const bool isBinary =
+		file.GetSize() >= STLHeaderSize && file.GetSize() == STLHeaderSize + facetCount * STLFacetSize;
+
+	if(isBinary && facetCount > static_cast<uint64_t>(std::numeric_limits<int>::max() / 3))
+	{
+		Error("Too many facets : {}", filepath.string());
+		return nullptr;
+	}
+
+	std::vector<Vec3> cornerPositions;
+	if(isBinary)
+	{
+		// Corner positions are read in place, skipping the facet normals and attributes.
+		cornerPositions.resize(3 * facetCount);
+		Core::Parallel::For(
+			facetCount,
+			[&](size_t iFacet)
+			{
+				const char* record = begin + STLHeaderSize + iFacet * STLFacetSize + 3 * sizeof(float);
+				for(size_t iCorner = 0; iCorner < 3; ++iCorner)
+				{
+					Vec3& position = cornerPositions[3 * iFacet + iCorner];
+					for(int iCoord = 0; iCoord < 3; ++iCoord, record += sizeof(float))
+						position[iCoord] = ReadSTLScalar<float>(record);
+				}
+			});
+		cur = end;
+	}
+	else
+	{
+		// Checking file type
+		SkipWhitespace(cur, end);
+		if(ParseToken(cur, end) != "solid")
+		{
+			Error("Wrong file format (must be STL) : {}", filepath.string());
+			return nullptr;
+		}
+		SkipLine(cur, end);
+
+		// Only the vertex lines matter, facet / loop keywords are skipped.
+		while(cur != end)
+		{
+			SkipWhitespace(cur, end);
+			if(ParseToken(cur, end) == "vertex")
+			{
+				Vec3& position = cornerPositions.emplace_back();
+				if(!ParseNumber(cur, end, position.x) || !ParseNumber(cur, end, position.y)
+				   || !ParseNumber(cur, end, position.z))
+				{
+					Error("Invalid vertex position : {}", filepath.string());
+					return nullptr;
+				}
+			}
+			SkipLine(cur, end);
+
+			if(!reporter.Update(cur))
+				return CancelLoading(progress, filepath);
+		}
+
+		if(cornerPositions.size() % 3 != 0
+		   || cornerPositions.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+		{
+			Error("Invalid facet : {}", filepath.string());
+			return nullptr;
+		}
+	}
+
+	if(!reporter.Flush(end))
+		return CancelLoading(progress, filepath);
+
+	// Weld the corners sharing the same position.
+	SetLoadPhase(progress, LoadPhase::Merging);
+	std::vector<Vertex> vertices;
+	std::vector<Triangle> triangles;
+	const size_t degeneratedTriangleCount = WeldTriangleSoup(cornerPositions, vertices, triangles);
+	auto mesh = std::make_unique<Mesh>();
+	mesh->m_Vertices = Core::Container::ChunkedCowVector<Vertex>(std::move(vertices));
+	mesh->m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::move(triangles));
+	if(degeneratedTriangleCount != 0)
+		Warning("{} degenerated triangles have been removed : {}", degeneratedTriangleCount, filepath.string());
+
+	if(IsCancelRequested(progress))
+		return CancelLoading(progress, filepath);
+
+	// Set neighbors and incident triangles.
+	SetLoadPhase(progress, LoadPhase::BuildingConnectivity);
+	mesh->UpdateMeshConnectivity();
+	SetLoadPhase(progress, LoadPhase::Done);
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+	const LoadStatistics curStatistics{ .ByteCount = file.GetSize(), .ElapsedSeconds = elapsed.count() };
+	Debug(
+		"Loaded {} bytes from {} in {:.3f}s ({:.1f} MB/s)",
+		curStatistics.ByteCount,
+		filepath.string(),
+		curStatistics.ElapsedSeconds,
+		curStatistics.GetThroughput() / 1.e6);
+
+	if(statistics != nullptr)
+		*statistics = curStatistics;
+
+	return mesh;
+}
 } // namespace Utilitary::Surface
@@ -0,0 +1,350 @@
+#include "Application/MeshNormals.h"
+
+#include "Core/ParallelHelpers.h"
+#include "Core/RadixSort.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using Core::Container::ChunkedSpan;
+
+namespace
+{
+/// @brief Minimal number of primitives processed by a thread.
+constexpr size_t NormalsGrainSize = 4096;
+
+/// @brief Unit normal of a triangle, with its weight in the normal of each of its vertices.
+struct WeightedTriangleNormal
+{
+	/// @brief Unit normal of the triangle.
+	Vec3 Normal{ 0.f, 0.f, 0.f };
+	/// @brief Weight of the normal for each vertex of the triangle.
+	std::array<float, 3> CornerWeights{ 0.f, 0.f, 0.f };
+};
+
+/// @brief Corner of a triangle (3 * triangle index + vertex local index), with the vertex at this corner.
+struct VertexCorner
+{
+	/// @brief Vertex at the corner.
+	VertexIndex VertexIdx;
+	/// @brief Index of the corner.
+	uint32_t CornerIdx;
+};
+
+/// @brief Angle (in radians) between u and v.
+/// @note More accurate than the arc cosine of the dot product for small and flat angles, and needs no normalization.
+float GetAngle(const Vec3& u, const Vec3& v)
+{
+	return std::atan2(glm::length(glm::cross(u, v)), glm::dot(u, v));
+}
+
+/// @brief Compute the unit normal of a triangle and the weight of each of its corners.
+/// @note A degenerate triangle gets null weights.
+WeightedTriangleNormal ComputeWeightedNormal(const Vec3& posA,
+											 const Vec3& posB,
+											 const Vec3& posC,
+											 NormalWeighting weighting)
+{
+	const Vec3 AB = posB - posA;
+	const Vec3 AC = posC - posA;
+	const Vec3 crossProduct = glm::cross(AB, AC);
+	const float crossLength = glm::length(crossProduct);
+	if(!(crossLength > 0.f))
+		return {};
+
+	WeightedTriangleNormal result{ .Normal = crossProduct / crossLength };
+	switch(weighting)
+	{
+		case NormalWeighting::Uniform:
+			result.CornerWeights = { 1.f, 1.f, 1.f };
+			break;
+		case NormalWeighting::Area:
+			result.CornerWeights.fill(0.5f * crossLength);
+			break;
+		case NormalWeighting::Angle:
+		{
+			const Vec3 BC = posC - posB;
+			result.CornerWeights = { GetAngle(AB, AC), GetAngle(BC, -AB), GetAngle(-AC, -BC) };
+			break;
+		}
+	}
+	return result;
+}
+
+/// @brief Compute the unit normal of a triangle of a mesh and the weight of each of its corners.
+/// @param triangleNormals Normal of each triangle of the mesh, used instead of the one of the positions if not empty.
+WeightedTriangleNormal ComputeWeightedNormal(ChunkedSpan<const Vertex> vertices,
+											 const Triangle& triangle,
+											 std::span<const Vec3> triangleNormals,
+											 size_t triangleIdx,
+											 NormalWeighting weighting)
+{
+	WeightedTriangleNormal result = ComputeWeightedNormal(vertices[triangle.Vertices[0]].Position,
+														  vertices[triangle.Vertices[1]].Position,
+														  vertices[triangle.Vertices[2]].Position,
+														  weighting);
+	if(!triangleNormals.empty())
+	{
+		const float normalLength = glm::length(triangleNormals[triangleIdx]);
+		result.Normal = normalLength > 0.f ? triangleNormals[triangleIdx] / normalLength : Vec3(0.f, 0.f, 0.f);
+	}
+	return result;
+}
+
+/// @brief Get the corners of some vertices, in one pass over the corners of all the triangles.
+/// @note Unlike the circulators, the pass finds all the triangles of a non-manifold vertex (e.g. the two fans of a
+/// bowtie vertex).
+/// @return Corners sorted by vertex, the corners of a vertex being in increasing order like in the whole mesh pass.
+std::vector<VertexCorner> GetVertexCorners(ChunkedSpan<const Triangle> triangles,
+										   size_t vertexCount,
+										   std::span<const VertexIndex> vertexIndices,
+										   uint32_t threadCount)
+{
+	std::vector<bool> isSearchedVertex(vertexCount, false);
+	for(VertexIndex curVertexIdx : vertexIndices)
+		isSearchedVertex[curVertexIdx] = true;
+
+	// Each range of triangles collects its own corners, the ranges being then concatenated in order.
+	const uint32_t rangeCount = Core::Parallel::GetRangeCount(triangles.size(), NormalsGrainSize, threadCount);
+	std::vector<std::vector<VertexCorner>> rangeCorners(rangeCount);
+	Core::Parallel::ForEachRange(
+		triangles.size(),
+		rangeCount,
+		[&](uint32_t rangeIdx, size_t begin, size_t end)
+		{
+			for(size_t iTriangle = begin; iTriangle < end; ++iTriangle)
+			{
+				const Triangle& curTriangle = triangles[iTriangle];
+				for(VertexLocalIndex iCorner = 0; iCorner < 3; ++iCorner)
+				{
+					const VertexIndex curVertexIdx = static_cast<VertexIndex>(curTriangle.Vertices[iCorner]);
+					if(isSearchedVertex[curVertexIdx])
+						rangeCorners[rangeIdx].push_back(
+							{ .VertexIdx = curVertexIdx, .CornerIdx = static_cast<uint32_t>(3 * iTriangle + iCorner) });
+				}
+			}
+		});
+
+	std::vector<VertexCorner> corners;
+	for(const std::vector<VertexCorner>& curCorners : rangeCorners)
+		corners.insert(corners.end(), curCorners.begin(), curCorners.end());
+	std::ranges::stable_sort(corners, {}, &VertexCorner::VertexIdx);
+	return corners;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+void MeshNormals::ComputeTriangleNormals(ChunkedSpan<const Vertex> vertices,
+										 ChunkedSpan<const Triangle> triangles,
+										 std::span<Vec3> normals,
+										 bool normalize,
+										 uint32_t threadCount)
+{
+	assert(normals.size() == triangles.size());
+
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& curTriangle = triangles[iTriangle];
+			const Vec3& posA = vertices[curTriangle.Vertices[0]].Position;
+			const Vec3& posB = vertices[curTriangle.Vertices[1]].Position;
+			const Vec3& posC = vertices[curTriangle.Vertices[2]].Position;
+
+			Vec3 computedNormal = glm::cross(posB - posA, posC - posA);
+			const float normalLength = glm::length(computedNormal);
+			if(normalize && normalLength > 0.f)
+				computedNormal /= normalLength;
+			normals[iTriangle] = computedNormal;
+		},
+		NormalsGrainSize,
+		threadCount);
+}
+
+void MeshNormals::ComputeVertexNormals(ChunkedSpan<const Vertex> vertices,
+									   ChunkedSpan<const Triangle> triangles,
+									   std::span<Vec3> normals,
+									   NormalWeighting weighting,
+									   bool normalize,
+									   uint32_t threadCount,
+									   std::span<const Vec3> triangleNormals)
+{
+	assert(normals.size() == vertices.size());
+	assert(triangleNormals.empty() || triangleNormals.size() == triangles.size());
+
+	// Compute the normal of each triangle and the weight of its corners, along with the vertex of each corner.
+	std::vector<WeightedTriangleNormal> weightedNormals(triangles.size());
+	std::vector<VertexCorner> corners(triangles.size() * 3);
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& curTriangle = triangles[iTriangle];
+			for(VertexLocalIndex iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				const int curVertexIdx = curTriangle.Vertices[iCorner];
+				assert(curVertexIdx >= 0 && static_cast<size_t>(curVertexIdx) < vertices.size());
+				corners[3 * iTriangle + iCorner] = { .VertexIdx = static_cast<VertexIndex>(curVertexIdx),
+													 .CornerIdx = static_cast<uint32_t>(3 * iTriangle + iCorner) };
+			}
+
+			weightedNormals[iTriangle] =
+				ComputeWeightedNormal(vertices, curTriangle, triangleNormals, iTriangle, weighting);
+		},
+		NormalsGrainSize,
+		threadCount);
+
+	// Corners of the same vertex become contiguous, in triangle order.
+	const uint32_t vertexBitCount = std::max(static_cast<uint32_t>(std::bit_width(vertices.size())), 1u);
+	Core::Parallel::RadixSort(
+		corners,
+		[](const VertexCorner& corner)
+		{
+			return corner.VertexIdx;
+		},
+		vertexBitCount,
+		threadCount);
+
+	// Vertices without triangle are not part of any run.
+	Core::Parallel::For(
+		vertices.size(),
+		[&](size_t iVertex)
+		{
+			normals[iVertex] = Vec3(0.f, 0.f, 0.f);
+		},
+		NormalsGrainSize,
+		threadCount);
+
+	// Sum the weighted normals of each run of corners, each range starting on a run boundary.
+	const size_t cornerCount = corners.size();
+	auto GetRunBegin = [&corners, cornerCount](size_t index)
+	{
+		while(index > 0 && index < cornerCount && corners[index].VertexIdx == corners[index - 1].VertexIdx)
+			++index;
+		return index;
+	};
+
+	Core::Parallel::ForEachRange(
+		cornerCount,
+		Core::Parallel::GetRangeCount(cornerCount, 3 * NormalsGrainSize, threadCount),
+		[&](uint32_t, size_t begin, size_t end)
+		{
+			const size_t rangeEnd = GetRunBegin(end);
+			for(size_t runBegin = GetRunBegin(begin), runEnd = runBegin; runBegin < rangeEnd; runBegin = runEnd)
+			{
+				Vec3 computedNormal(0.f, 0.f, 0.f);
+				const VertexIndex curVertexIdx = corners[runBegin].VertexIdx;
+				for(runEnd = runBegin; runEnd < cornerCount && corners[runEnd].VertexIdx == curVertexIdx; ++runEnd)
+				{
+					const uint32_t curCornerIdx = corners[runEnd].CornerIdx;
+					const WeightedTriangleNormal& curTriangleNormal = weightedNormals[curCornerIdx / 3];
+					computedNormal += curTriangleNormal.Normal * curTriangleNormal.CornerWeights[curCornerIdx % 3];
+				}
+
+				const float normalLength = glm::length(computedNormal);
+				if(normalize && normalLength > 0.f)
+					computedNormal /= normalLength;
+				normals[curVertexIdx] = computedNormal;
+			}
+		});
+}
+
+std::vector<Vec3> MeshNormals::ComputeVertexNormals(
+	const Data::Surface::Mesh& mesh, NormalWeighting weighting, bool normalize, uint32_t threadCount)
+{
+	std::vector<Vec3> normals(mesh.GetVertexCount());
+	ComputeVertexNormals(mesh.GetVertices(), mesh.GetTriangles(), normals, weighting, normalize, threadCount);
+	return normals;
+}
+
+std::vector<TriangleIndex> MeshNormals::GetTrianglesAroundVertices(
+	const Data::Surface::Mesh& mesh, std::span<const VertexIndex> vertexIndices)
+{
+	std::vector<TriangleIndex> triangleIndices;
+	for(const VertexCorner& curCorner : GetVertexCorners(mesh.GetTriangles(), mesh.GetVertexCount(), vertexIndices, 0))
+		triangleIndices.push_back(curCorner.CornerIdx / 3);
+
+	std::ranges::sort(triangleIndices);
+	const auto duplicates = std::ranges::unique(triangleIndices);
+	triangleIndices.erase(duplicates.begin(), duplicates.end());
+	return triangleIndices;
+}
+
+std::vector<VertexIndex> MeshNormals::GetVerticesAroundVertices(
+	const Data::Surface::Mesh& mesh, std::span<const VertexIndex> vertexIndices)
+{
+	std::vector<VertexIndex> aroundVertexIndices;
+	for(TriangleIndex curTriangleIdx : GetTrianglesAroundVertices(mesh, vertexIndices))
+	{
+		for(int curVertexIdx : mesh.GetTriangleData(curTriangleIdx).Vertices)
+			aroundVertexIndices.push_back(static_cast<VertexIndex>(curVertexIdx));
+	}
+
+	std::ranges::sort(aroundVertexIndices);
+	const auto duplicates = std::ranges::unique(aroundVertexIndices);
+	aroundVertexIndices.erase(duplicates.begin(), duplicates.end());
+	return aroundVertexIndices;
+}
+
+void MeshNormals::ComputeVertexNormals(const Data::Surface::Mesh& mesh,
+									   std::span<const VertexIndex> vertexIndices,
+									   std::span<Vec3> normals,
+									   NormalWeighting weighting,
+									   bool normalize,
+									   uint32_t threadCount,
+									   std::span<const Vec3> triangleNormals)
+{
+	assert(normals.size() == vertexIndices.size());
+	assert(triangleNormals.empty() || triangleNormals.size() == mesh.GetTriangleCount());
+
+	const ChunkedSpan<const Vertex> vertices = mesh.GetVertices();
+	const ChunkedSpan<const Triangle> triangles = mesh.GetTriangles();
+	const std::vector<VertexCorner> corners = GetVertexCorners(triangles, vertices.size(), vertexIndices, threadCount);
+	Core::Parallel::For(
+		vertexIndices.size(),
+		[&](size_t index)
+		{
+			// Sum the corners in the order used for the whole mesh, to get exactly the same normal.
+			Vec3 computedNormal(0.f, 0.f, 0.f);
+			const auto curCorners =
+				std::ranges::equal_range(corners, vertexIndices[index], {}, &VertexCorner::VertexIdx);
+			for(const VertexCorner& curCorner : curCorners)
+			{
+				const TriangleIndex curTriangleIdx = curCorner.CornerIdx / 3;
+				const WeightedTriangleNormal curTriangleNormal = ComputeWeightedNormal(
+					vertices, triangles[curTriangleIdx], triangleNormals, curTriangleIdx, weighting);
+				computedNormal += curTriangleNormal.Normal * curTriangleNormal.CornerWeights[curCorner.CornerIdx % 3];
+			}
+
+			const float normalLength = glm::length(computedNormal);
+			if(normalize && normalLength > 0.f)
+				computedNormal /= normalLength;
+			normals[index] = computedNormal;
+		},
+		NormalsGrainSize / 8,
+		threadCount);
+}
+
+void MeshNormals::UpdateVertexNormals(const Data::Surface::Mesh& mesh,
+									  std::span<const VertexIndex> movedVertexIndices,
+									  std::span<Vec3> normals,
+									  NormalWeighting weighting,
+									  bool normalize,
+									  uint32_t threadCount)
+{
+	assert(normals.size() == mesh.GetVertexCount());
+
+	const std::vector<VertexIndex> vertexIndices = GetVerticesAroundVertices(mesh, movedVertexIndices);
+	std::vector<Vec3> updatedNormals(vertexIndices.size());
+	ComputeVertexNormals(mesh, vertexIndices, updatedNormals, weighting, normalize, threadCount);
+	for(size_t index = 0; index < vertexIndices.size(); ++index)
+		normals[vertexIndices[index]] = updatedNormals[index];
+}
+} // namespace Utilitary::Surface
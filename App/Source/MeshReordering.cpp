@@ -0,0 +1,389 @@
+#include "Application/MeshReordering.h"
+
+#include "Core/BitArray.h"
+#include "Core/ParallelHelpers.h"
+#include "Core/RadixSort.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+using Core::Container::ChunkedSpan;
+
+namespace
+{
+/// @brief Minimal number of primitives processed by a thread.
+constexpr size_t ReorderingGrainSize = 4096;
+
+/// @brief Number of bits of each coordinate in a Morton code.
+constexpr uint32_t MortonAxisBitCount = 21;
+
+/// @brief Index to sort with its key.
+struct SortedIndex
+{
+	/// @brief Sort key.
+	uint64_t Key;
+	/// @brief Old index of the element.
+	uint32_t Index;
+};
+
+/// @brief Insert two zero bits between each of the 21 lower bits of a value.
+uint64_t SpreadBits(uint32_t value)
+{
+	uint64_t bits = value & ((1u << MortonAxisBitCount) - 1);
+	bits = (bits | (bits << 32)) & 0x1F00000000FFFFull;
+	bits = (bits | (bits << 16)) & 0x1F0000FF0000FFull;
+	bits = (bits | (bits << 8)) & 0x100F00F00F00F00Full;
+	bits = (bits | (bits << 4)) & 0x10C30C30C30C30C3ull;
+	bits = (bits | (bits << 2)) & 0x1249249249249249ull;
+	return bits;
+}
+
+/// @brief Get the new index of each element from the old index of each new element.
+std::vector<uint32_t> InvertOrder(std::span<const uint32_t> order, uint32_t threadCount)
+{
+	std::vector<uint32_t> newIndices(order.size());
+	Core::Parallel::For(
+		order.size(),
+		[&](size_t iNew)
+		{
+			newIndices[order[iNew]] = static_cast<uint32_t>(iNew);
+		},
+		ReorderingGrainSize,
+		threadCount);
+	return newIndices;
+}
+
+/// @brief Get the new index of an element, keeping -1 for a missing element.
+int RemapIndex(std::span<const uint32_t> newIndices, int index)
+{
+	return index == -1 ? -1 : static_cast<int>(newIndices[index]);
+}
+
+/// @brief Check if an order is a permutation of [0, count).
+[[maybe_unused]] bool IsPermutation(std::span<const uint32_t> order, size_t count)
+{
+	if(order.size() != count)
+		return false;
+	Core::Container::BitArray isUsed(count);
+	for(uint32_t curIdx : order)
+	{
+		if(curIdx >= count || isUsed.Get(curIdx))
+			return false;
+		isUsed.Set(curIdx);
+	}
+	return true;
+}
+
+/// @brief Move the elements of a vector in a new order, the new element i being the old element order[i].
+template<typename T>
+void PermuteVector(Core::Container::CowVector<T>& values, std::span<const uint32_t> order, uint32_t threadCount)
+{
+	std::vector<T> permutedValues(values.size());
+	const auto PermuteFrom = [&](auto& oldValues)
+	{
+		Core::Parallel::For(
+			oldValues.size(),
+			[&](size_t iNew)
+			{
+				permutedValues[iNew] = std::move(oldValues[order[iNew]]);
+			},
+			ReorderingGrainSize,
+			threadCount);
+	};
+
+	// The values shared with a copy of the mesh are copied instead of moved.
+	if(values.IsShared())
+		PermuteFrom(values.Read());
+	else
+		PermuteFrom(values.Write());
+	values = Core::Container::CowVector<T>(std::move(permutedValues));
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+std::vector<VertexIndex> MeshReordering::ComputeMortonVertexOrder(ChunkedSpan<const Vertex> vertices,
+																 uint32_t threadCount)
+{
+	if(vertices.empty())
+		return {};
+
+	// Bounding box of each range, then of the mesh.
+	const uint32_t rangeCount = Core::Parallel::GetRangeCount(vertices.size(), ReorderingGrainSize, threadCount);
+	std::vector<Vec3> minPositions(rangeCount, Vec3(std::numeric_limits<float>::max()));
+	std::vector<Vec3> maxPositions(rangeCount, Vec3(std::numeric_limits<float>::lowest()));
+	Core::Parallel::ForEachRange(
+		vertices.size(),
+		rangeCount,
+		[&](uint32_t iRange, size_t begin, size_t end)
+		{
+			for(size_t iVertex = begin; iVertex < end; ++iVertex)
+			{
+				minPositions[iRange] = glm::min(minPositions[iRange], vertices[iVertex].Position);
+				maxPositions[iRange] = glm::max(maxPositions[iRange], vertices[iVertex].Position);
+			}
+		});
+	Vec3 minPosition = minPositions.front();
+	Vec3 maxPosition = maxPositions.front();
+	for(uint32_t iRange = 1; iRange < rangeCount; ++iRange)
+	{
+		minPosition = glm::min(minPosition, minPositions[iRange]);
+		maxPosition = glm::max(maxPosition, maxPositions[iRange]);
+	}
+
+	// Flat axes are quantized to 0.
+	constexpr float MaxCoordinate = static_cast<float>((1u << MortonAxisBitCount) - 1);
+	const Vec3 extent = maxPosition - minPosition;
+	Vec3 scale(0.f);
+	for(int iAxis = 0; iAxis < 3; ++iAxis)
+	{
+		if(extent[iAxis] > 0.f)
+			scale[iAxis] = MaxCoordinate / extent[iAxis];
+	}
+
+	std::vector<SortedIndex> codes(vertices.size());
+	Core::Parallel::For(
+		vertices.size(),
+		[&](size_t iVertex)
+		{
+			const Vec3 coordinates =
+				glm::min(glm::max((vertices[iVertex].Position - minPosition) * scale, Vec3(0.f)), Vec3(MaxCoordinate));
+			codes[iVertex] = { .Key = SpreadBits(static_cast<uint32_t>(coordinates.x))
+									  | (SpreadBits(static_cast<uint32_t>(coordinates.y)) << 1)
+									  | (SpreadBits(static_cast<uint32_t>(coordinates.z)) << 2),
+							   .Index = static_cast<uint32_t>(iVertex) };
+		},
+		ReorderingGrainSize,
+		threadCount);
+
+	Core::Parallel::RadixSort(
+		codes,
+		[](const SortedIndex& code)
+		{
+			return code.Key;
+		},
+		3 * MortonAxisBitCount,
+		threadCount);
+
+	std::vector<VertexIndex> order(vertices.size());
+	Core::Parallel::For(
+		vertices.size(),
+		[&](size_t iNew)
+		{
+			order[iNew] = codes[iNew].Index;
+		},
+		ReorderingGrainSize,
+		threadCount);
+	return order;
+}
+
+std::vector<TriangleIndex> MeshReordering::ComputeTriangleOrder(ChunkedSpan<const Triangle> triangles,
+																std::span<const VertexIndex> vertexOrder,
+																uint32_t threadCount)
+{
+	const std::vector<uint32_t> newVertexIndices = InvertOrder(vertexOrder, threadCount);
+
+	std::vector<SortedIndex> keys(triangles.size());
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& curTriangle = triangles[iTriangle];
+			uint32_t minVertexIdx = std::numeric_limits<uint32_t>::max();
+			for(int curVertexIdx : curTriangle.Vertices)
+			{
+				if(curVertexIdx != -1)
+					minVertexIdx = std::min(minVertexIdx, newVertexIndices[curVertexIdx]);
+			}
+			keys[iTriangle] = { .Key = minVertexIdx, .Index = static_cast<uint32_t>(iTriangle) };
+		},
+		ReorderingGrainSize,
+		threadCount);
+
+	Core::Parallel::RadixSort(
+		keys,
+		[](const SortedIndex& key)
+		{
+			return key.Key;
+		},
+		32,
+		threadCount);
+
+	std::vector<TriangleIndex> order(triangles.size());
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iNew)
+		{
+			order[iNew] = keys[iNew].Index;
+		},
+		ReorderingGrainSize,
+		threadCount);
+	return order;
+}
+
+std::vector<TriangleIndex> MeshReordering::ComputeBreadthFirstTriangleOrder(ChunkedSpan<const Triangle> triangles)
+{
+	// The order is the queue of the traversal.
+	std::vector<TriangleIndex> order;
+	order.reserve(triangles.size());
+	Core::Container::BitArray isVisited(triangles.size());
+
+	for(TriangleIndex iSeed = 0; iSeed < triangles.size(); ++iSeed)
+	{
+		if(isVisited.Get(iSeed))
+			continue;
+
+		isVisited.Set(iSeed);
+		order.push_back(iSeed);
+		for(size_t iQueue = order.size() - 1; iQueue < order.size(); ++iQueue)
+		{
+			for(int curNeighborIdx : triangles[order[iQueue]].Neighbors)
+			{
+				if(curNeighborIdx == -1 || isVisited.Get(curNeighborIdx))
+					continue;
+				isVisited.Set(curNeighborIdx);
+				order.push_back(static_cast<TriangleIndex>(curNeighborIdx));
+			}
+		}
+	}
+	return order;
+}
+
+std::vector<VertexIndex> MeshReordering::ComputeVertexOrder(size_t vertexCount,
+															ChunkedSpan<const Triangle> triangles,
+															std::span<const TriangleIndex> triangleOrder)
+{
+	std::vector<VertexIndex> order;
+	order.reserve(vertexCount);
+	Core::Container::BitArray isPlaced(vertexCount);
+
+	for(TriangleIndex curTriangleIdx : triangleOrder)
+	{
+		for(int curVertexIdx : triangles[curTriangleIdx].Vertices)
+		{
+			if(curVertexIdx == -1 || isPlaced.Get(curVertexIdx))
+				continue;
+			isPlaced.Set(curVertexIdx);
+			order.push_back(static_cast<VertexIndex>(curVertexIdx));
+		}
+	}
+
+	// Vertices without triangle.
+	for(VertexIndex iVertex = 0; order.size() < vertexCount; ++iVertex)
+	{
+		if(!isPlaced.Get(iVertex))
+			order.push_back(iVertex);
+	}
+	return order;
+}
+
+void MeshReordering::Permute(Data::Surface::Mesh& mesh,
+							 std::span<const VertexIndex> vertexOrder,
+							 std::span<const TriangleIndex> triangleOrder,
+							 uint32_t threadCount)
+{
+	assert(IsPermutation(vertexOrder, mesh.m_Vertices.size()) && "The vertex order must be a permutation");
+	assert(IsPermutation(triangleOrder, mesh.m_Triangles.size()) && "The triangle order must be a permutation");
+	assert(!mesh.HasGarbage() && "The deleted elements must be removed by GarbageCollect first");
+
+	const bool hasEdges = mesh.HasEdges();
+	const std::vector<uint32_t> newVertexIndices = InvertOrder(vertexOrder, threadCount);
+	const std::vector<uint32_t> newTriangleIndices = InvertOrder(triangleOrder, threadCount);
+
+	std::vector<Vertex> vertices(mesh.m_Vertices.size());
+	Core::Parallel::For(
+		vertices.size(),
+		[&](size_t iVertex)
+		{
+			Vertex& curVertex = vertices[iVertex];
+			curVertex = mesh.m_Vertices[vertexOrder[iVertex]];
+			curVertex.IncidentTriangleIdx = RemapIndex(newTriangleIndices, curVertex.IncidentTriangleIdx);
+		},
+		ReorderingGrainSize,
+		threadCount);
+	mesh.m_Vertices = Core::Container::ChunkedCowVector<Vertex>(std::move(vertices));
+
+	// The local indices are kept, so the neighbor edge slots only move with their triangle.
+	std::vector<Triangle> triangles(mesh.m_Triangles.size());
+	Core::Parallel::For(
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& oldTriangle = mesh.m_Triangles[triangleOrder[iTriangle]];
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				triangles[iTriangle].Vertices[iEdge] = RemapIndex(newVertexIndices, oldTriangle.Vertices[iEdge]);
+				triangles[iTriangle].Neighbors[iEdge] = RemapIndex(newTriangleIndices, oldTriangle.Neighbors[iEdge]);
+			}
+		},
+		ReorderingGrainSize,
+		threadCount);
+	mesh.m_Triangles = Core::Container::ChunkedCowVector<Triangle>(std::move(triangles));
+
+	if(mesh.m_NeighborEdgeSlots.size() == mesh.m_Triangles.size())
+		PermuteVector(mesh.m_NeighborEdgeSlots, triangleOrder, threadCount);
+
+	// The edges keep their order, their vertices and triangle are remapped.
+	if(hasEdges)
+	{
+		PermuteVector(mesh.m_TriangleEdges, triangleOrder, threadCount);
+		std::vector<Edge>& edges = mesh.m_Edges.Write();
+		Core::Parallel::For(
+			edges.size(),
+			[&](size_t iEdge)
+			{
+				Edge& curEdge = edges[iEdge];
+				const int firstVertexIdx = RemapIndex(newVertexIndices, curEdge.Vertices[0]);
+				const int secondVertexIdx = RemapIndex(newVertexIndices, curEdge.Vertices[1]);
+				const auto [minVertexIdx, maxVertexIdx] = std::minmax(firstVertexIdx, secondVertexIdx);
+				curEdge.Vertices = { minVertexIdx, maxVertexIdx };
+				curEdge.TriangleIdx = RemapIndex(newTriangleIndices, curEdge.TriangleIdx);
+			},
+			ReorderingGrainSize,
+			threadCount);
+	}
+	if(mesh.m_VerticesExtraDataContainer.size() == mesh.m_Vertices.size())
+		PermuteVector(mesh.m_VerticesExtraDataContainer, vertexOrder, threadCount);
+	if(mesh.m_TrianglesExtraDataContainer.size() == mesh.m_Triangles.size())
+		PermuteVector(mesh.m_TrianglesExtraDataContainer, triangleOrder, threadCount);
+	mesh.m_VertexAttributes.Permute(vertexOrder);
+	mesh.m_TriangleAttributes.Permute(triangleOrder);
+
+	// The dirty vertices keep their marking order.
+	if(!mesh.m_DirtyVertices.empty())
+	{
+		for(VertexIndex& curVertexIdx : mesh.m_DirtyVertices.Write())
+			curVertexIdx = newVertexIndices[curVertexIdx];
+	}
+	if(!mesh.m_IsVertexDirty.empty())
+	{
+		std::vector<bool> isVertexDirty(mesh.m_IsVertexDirty.size(), false);
+		for(VertexIndex curVertexIdx : mesh.m_DirtyVertices)
+			isVertexDirty[curVertexIdx] = true;
+		mesh.m_IsVertexDirty = Core::Container::CowVector<bool>(std::move(isVertexDirty));
+	}
+
+	mesh.m_OneRingAdjacency.reset();
+}
+
+void MeshReordering::Reorder(Data::Surface::Mesh& mesh, ReorderingMethod method, uint32_t threadCount)
+{
+	std::vector<VertexIndex> vertexOrder;
+	std::vector<TriangleIndex> triangleOrder;
+	if(method == ReorderingMethod::Morton)
+	{
+		vertexOrder = ComputeMortonVertexOrder(mesh.m_Vertices, threadCount);
+		triangleOrder = ComputeTriangleOrder(mesh.m_Triangles, vertexOrder, threadCount);
+	}
+	else
+	{
+		triangleOrder = ComputeBreadthFirstTriangleOrder(mesh.m_Triangles);
+		vertexOrder = ComputeVertexOrder(mesh.m_Vertices.size(), mesh.m_Triangles, triangleOrder);
+	}
+	Permute(mesh, vertexOrder, triangleOrder, threadCount);
+}
+} // namespace Utilitary::Surface
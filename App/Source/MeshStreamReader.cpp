@@ -0,0 +1,362 @@
+#include "Application/MeshStreamReader.h"
+
+#include "Core/ParseHelpers.h"
+#include "Core/PrintHelpers.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Core::Parse;
+
+namespace
+{
+/// @brief Read a file line by line through a fixed size buffer.
+class LineReader
+{
+public:
+	LineReader(const std::filesystem::path& filepath, size_t bufferSize)
+		: m_File(filepath, std::ios::binary)
+		, m_Buffer(std::max<size_t>(bufferSize, 2))
+	{}
+
+	/// @brief Check if the file has been opened.
+	bool IsOpen() const { return m_File.is_open(); }
+
+	/// @brief Check if a line did not fit in the buffer.
+	bool HasOverflow() const { return m_HasOverflow; }
+
+	/// @brief Get the number of the last line read (1-based).
+	uint64_t GetLineNumber() const { return m_LineNumber; }
+
+	/// @brief Get the next line, without its line break.
+	/// @note The line is only valid until the next call.
+	/// @return False at the end of the file, or if the line does not fit in the buffer.
+	bool NextLine(std::string_view& line)
+	{
+		while(true)
+		{
+			const char* begin = m_Buffer.data() + m_Begin;
+			const size_t availableCount = m_End - m_Begin;
+			const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', availableCount));
+			if(lineEnd != nullptr)
+			{
+				line = { begin, static_cast<size_t>(lineEnd - begin) };
+				m_Begin += line.size() + 1;
+				++m_LineNumber;
+				return true;
+			}
+
+			if(m_IsEnd)
+			{ // Last line without line break.
+				if(availableCount == 0)
+					return false;
+
+				line = { begin, availableCount };
+				m_Begin = m_End;
+				++m_LineNumber;
+				return true;
+			}
+
+			if(availableCount == m_Buffer.size())
+			{
+				m_HasOverflow = true;
+				return false;
+			}
+
+			// Move the beginning of the line to the front of the buffer and fill the rest.
+			std::memmove(m_Buffer.data(), begin, availableCount);
+			m_Begin = 0;
+			m_End = availableCount;
+
+			m_File.read(m_Buffer.data() + m_End, static_cast<std::streamsize>(m_Buffer.size() - m_End));
+			const auto readCount = static_cast<size_t>(m_File.gcount());
+			m_End += readCount;
+			m_IsEnd = readCount == 0;
+		}
+	}
+
+	/// @brief Get the next line that is neither empty nor a comment.
+	bool NextRecord(std::string_view& line)
+	{
+		while(NextLine(line))
+		{
+			const char* cur = line.data();
+			SkipBlanks(cur, line.data() + line.size());
+			if(cur != line.data() + line.size() && *cur != '#')
+				return true;
+		}
+		return false;
+	}
+
+private:
+	/// @brief File to read.
+	std::ifstream m_File;
+	/// @brief Read buffer.
+	std::vector<char> m_Buffer;
+	/// @brief Offset of the first unread character in the buffer.
+	size_t m_Begin{ 0 };
+	/// @brief Offset past the last character read in the buffer.
+	size_t m_End{ 0 };
+	/// @brief Number of lines read.
+	uint64_t m_LineNumber{ 0 };
+	/// @brief Whether the whole file has been read into the buffer.
+	bool m_IsEnd{ false };
+	/// @brief Whether a line did not fit in the buffer.
+	bool m_HasOverflow{ false };
+};
+
+/// @brief Log the reason why a file can't be read to the end.
+void ReportReadError(const LineReader& reader, const std::filesystem::path& filepath)
+{
+	if(reader.HasOverflow())
+		Error("Line {} exceeds the read buffer size: {}", reader.GetLineNumber() + 1, filepath.string());
+	else
+		Error("Unexpected end of file: {}", filepath.string());
+}
+
+/// @brief Parse an OBJ face corner (v, v/vt, v//vn or v/vt/vn) from a token.
+/// @param token Token to parse.
+/// @param counts Number of records read so far for each channel (position, texture coordinates, normal).
+/// @param corner Parsed corner.
+/// @return True if the corner is valid and only references records already read, false otherwise.
+bool ParseOBJCorner(std::string_view token,
+					const std::array<uint64_t, 3>& counts,
+					Utilitary::Surface::FaceCorner& corner)
+{
+	std::array<int, 3> indices{ -1, -1, -1 };
+
+	const char* cur = token.data();
+	const char* end = cur + token.size();
+	for(size_t iChannel = 0; iChannel < indices.size() && cur != end; ++iChannel)
+	{
+		if(iChannel > 0)
+		{ // Skip '/' character.
+			if(*cur != '/')
+				return false;
+			++cur;
+		}
+
+		// The channel is not referenced (e.g. v//vn).
+		if(cur == end || *cur == '/')
+		{
+			if(iChannel == 0)
+				return false;
+			continue;
+		}
+
+		int64_t index;
+		auto [ptr, errorCode] = std::from_chars(cur, end, index);
+		if(errorCode != std::errc() || index == 0)
+			return false;
+		cur = ptr;
+
+		// OBJ format uses 1-based indexing, and negative indices are relative to the last record read.
+		const int64_t resolvedIndex = index > 0 ? index - 1 : static_cast<int64_t>(counts[iChannel]) + index;
+		if(resolvedIndex < 0 || resolvedIndex >= static_cast<int64_t>(counts[iChannel]))
+			return false;
+		indices[iChannel] = static_cast<int>(resolvedIndex);
+	}
+
+	corner = { .PositionIdx = indices[0], .TexCoordIdx = indices[1], .NormalIdx = indices[2] };
+	return cur == end && corner.PositionIdx != -1;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+bool MeshStreamReader::ReadOFF(const std::filesystem::path& filepath, MeshRecordVisitor& visitor, size_t bufferSize)
+{
+	LineReader reader(filepath, bufferSize);
+
+	// Checking file opening
+	if(!reader.IsOpen())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return false;
+	}
+
+	// Checking file type
+	std::string_view line;
+	if(!reader.NextRecord(line))
+	{
+		ReportReadError(reader, filepath);
+		return false;
+	}
+
+	const char* cur = line.data();
+	const char* end = line.data() + line.size();
+	if(ParseToken(cur, end) != "OFF")
+	{
+		Error("Wrong file format (must be .off) : {}", filepath.string());
+		return false;
+	}
+
+	// The counts may follow the keyword on the same line.
+	SkipBlanks(cur, end);
+	if(cur == end)
+	{
+		if(!reader.NextRecord(line))
+		{
+			ReportReadError(reader, filepath);
+			return false;
+		}
+		cur = line.data();
+		end = line.data() + line.size();
+	}
+
+	uint64_t vertexCount, faceCount;
+	if(!ParseNumber(cur, end, vertexCount) || !ParseNumber(cur, end, faceCount))
+	{
+		Error("Invalid OFF header at line {}: {}", reader.GetLineNumber(), filepath.string());
+		return false;
+	}
+	visitor.OnHeader(vertexCount, faceCount);
+
+	// Read vertices
+	for(uint64_t iVertex = 0; iVertex < vertexCount; ++iVertex)
+	{
+		if(!reader.NextRecord(line))
+		{
+			ReportReadError(reader, filepath);
+			return false;
+		}
+
+		cur = line.data();
+		end = line.data() + line.size();
+		Vec3 position;
+		if(!ParseNumber(cur, end, position.x) || !ParseNumber(cur, end, position.y)
+		   || !ParseNumber(cur, end, position.z))
+		{
+			Error("Invalid OFF vertex at line {}: {}", reader.GetLineNumber(), filepath.string());
+			return false;
+		}
+		visitor.OnVertex(position);
+	}
+
+	// Read faces, the corners are reused from one face to the next.
+	std::vector<FaceCorner> corners;
+	for(uint64_t iFace = 0; iFace < faceCount; ++iFace)
+	{
+		if(!reader.NextRecord(line))
+		{
+			ReportReadError(reader, filepath);
+			return false;
+		}
+
+		cur = line.data();
+		end = line.data() + line.size();
+		uint32_t cornerCount;
+		bool isValid = ParseNumber(cur, end, cornerCount) && cornerCount >= 3;
+
+		corners.clear();
+		for(uint32_t iCorner = 0; isValid && iCorner < cornerCount; ++iCorner)
+		{
+			uint64_t vertexIdx;
+			isValid = ParseNumber(cur, end, vertexIdx) && vertexIdx < vertexCount;
+			corners.push_back({ .PositionIdx = static_cast<int>(vertexIdx) });
+		}
+
+		if(!isValid)
+		{
+			Error("Invalid OFF face at line {}: {}", reader.GetLineNumber(), filepath.string());
+			return false;
+		}
+		visitor.OnFace(corners);
+	}
+
+	return true;
+}
+
+bool MeshStreamReader::ReadOBJ(const std::filesystem::path& filepath, MeshRecordVisitor& visitor, size_t bufferSize)
+{
+	LineReader reader(filepath, bufferSize);
+
+	// Checking file opening
+	if(!reader.IsOpen())
+	{
+		Error("Failed to open file: {}", filepath.string());
+		return false;
+	}
+
+	// Number of positions, texture coordinates and normals read so far.
+	std::array<uint64_t, 3> counts{ 0, 0, 0 };
+	// Corners of the current face, reused from one face to the next.
+	std::vector<FaceCorner> corners;
+
+	std::string_view line;
+	while(reader.NextLine(line))
+	{
+		const char* cur = line.data();
+		const char* end = line.data() + line.size();
+
+		bool isValid = true;
+		const std::string_view type = ParseToken(cur, end);
+		if(type == "v")
+		{ // Vertex position
+			Vec3 position;
+			isValid = ParseNumber(cur, end, position.x) && ParseNumber(cur, end, position.y)
+				&& ParseNumber(cur, end, position.z);
+			if(isValid)
+			{
+				visitor.OnVertex(position);
+				++counts[0];
+			}
+		}
+		else if(type == "vt")
+		{ // Vertex texture coordinate
+			Vec2 texCoords;
+			isValid = ParseNumber(cur, end, texCoords.x) && ParseNumber(cur, end, texCoords.y);
+			if(isValid)
+			{
+				visitor.OnTexCoord(texCoords);
+				++counts[1];
+			}
+		}
+		else if(type == "vn")
+		{ // Normal vector
+			Vec3 normal;
+			isValid = ParseNumber(cur, end, normal.x) && ParseNumber(cur, end, normal.y)
+				&& ParseNumber(cur, end, normal.z);
+			if(isValid)
+			{
+				visitor.OnNormal(normal);
+				++counts[2];
+			}
+		}
+		else if(type == "f")
+		{ // Face
+			corners.clear();
+			for(std::string_view token = ParseToken(cur, end); isValid && !token.empty(); token = ParseToken(cur, end))
+			{
+				if(token.front() == '#')
+					break;
+
+				isValid = ParseOBJCorner(token, counts, corners.emplace_back());
+			}
+
+			isValid &= corners.size() >= 3;
+			if(isValid)
+				visitor.OnFace(corners);
+		}
+
+		if(!isValid)
+		{
+			Error("Invalid OBJ record at line {}: {}", reader.GetLineNumber(), filepath.string());
+			return false;
+		}
+	}
+
+	if(reader.HasOverflow())
+	{
+		ReportReadError(reader, filepath);
+		return false;
+	}
+
+	return true;
+}
+} // namespace Utilitary::Surface
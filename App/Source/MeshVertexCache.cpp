@@ -0,0 +1,288 @@
+#include "Application/MeshVertexCache.h"
+
+#include "Application/MeshReordering.h"
+#include "Core/BitArray.h"
+#include "Core/ParallelHelpers.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+using Core::Container::ChunkedSpan;
+
+namespace
+{
+/// @brief Exponent of the decay of the score of a vertex with its position in the cache.
+constexpr float CacheDecayPower = 1.5f;
+/// @brief Score of the vertices of the last emitted triangle, lower to avoid emitting strips.
+constexpr float LastTriangleScore = 0.75f;
+/// @brief Scale of the bonus given to the vertices with few remaining triangles.
+constexpr float ValenceBoostScale = 2.f;
+/// @brief Exponent of the bonus given to the vertices with few remaining triangles.
+constexpr float ValenceBoostPower = 0.5f;
+
+/// @brief Value of a missing triangle.
+constexpr uint32_t InvalidTriangle = std::numeric_limits<uint32_t>::max();
+
+/// @brief Score of the vertices, from their position in the cache and their number of remaining triangles.
+class VertexScoreTable
+{
+public:
+	/// @brief Construct the tables for a cache size.
+	explicit VertexScoreTable(uint32_t cacheSize)
+		: m_CacheScores(cacheSize)
+		, m_ValenceScores(MaxTabulatedValence + 1, 0.f)
+	{
+		for(uint32_t iPosition = 0; iPosition < cacheSize; ++iPosition)
+		{
+			m_CacheScores[iPosition] =
+				iPosition < 3 ? LastTriangleScore
+							  : std::pow(1.f - static_cast<float>(iPosition - 3) / static_cast<float>(cacheSize - 3),
+										 CacheDecayPower);
+		}
+		for(uint32_t iValence = 1; iValence <= MaxTabulatedValence; ++iValence)
+			m_ValenceScores[iValence] = GetValenceScore(iValence);
+	}
+
+	/// @brief Get the score of a vertex.
+	/// @param cachePosition Position of the vertex in the cache, or -1 if it is not in the cache.
+	/// @param remainingTriangleCount Number of triangles of the vertex not emitted yet.
+	float GetScore(int cachePosition, uint32_t remainingTriangleCount) const
+	{
+		if(remainingTriangleCount == 0)
+			return -1.f;
+		const float valenceScore = remainingTriangleCount <= MaxTabulatedValence
+									   ? m_ValenceScores[remainingTriangleCount]
+									   : GetValenceScore(remainingTriangleCount);
+		return (cachePosition >= 0 ? m_CacheScores[cachePosition] : 0.f) + valenceScore;
+	}
+
+private:
+	/// @brief Largest valence whose score is tabulated.
+	static constexpr uint32_t MaxTabulatedValence = 32;
+
+	/// @brief Compute the bonus of a vertex with remainingTriangleCount triangles left.
+	static float GetValenceScore(uint32_t remainingTriangleCount)
+	{
+		return ValenceBoostScale * std::pow(static_cast<float>(remainingTriangleCount), -ValenceBoostPower);
+	}
+
+private:
+	/// @brief Score of each cache position.
+	std::vector<float> m_CacheScores;
+	/// @brief Score of each number of remaining triangles.
+	std::vector<float> m_ValenceScores;
+};
+
+/// @brief Order a cluster of triangles for the vertex cache.
+/// @param triangles Triangles of the cluster.
+/// @param firstTriangleIdx Index of the first triangle of the cluster in the mesh.
+/// @param scoreTable Score of the vertices.
+/// @param cacheSize Number of vertices of the cache.
+/// @param order Old index of each new triangle of the cluster.
+void OrderCluster(ChunkedSpan<const Triangle> triangles,
+				  TriangleIndex firstTriangleIdx,
+				  const VertexScoreTable& scoreTable,
+				  uint32_t cacheSize,
+				  std::span<TriangleIndex> order)
+{
+	const size_t triangleCount = triangles.size();
+
+	// Local index of the vertices of the cluster.
+	std::vector<int> clusterVertices;
+	clusterVertices.reserve(3 * triangleCount);
+	for(const Triangle& curTriangle : triangles)
+		clusterVertices.insert(clusterVertices.end(), curTriangle.Vertices.begin(), curTriangle.Vertices.end());
+	std::ranges::sort(clusterVertices);
+	clusterVertices.erase(std::unique(clusterVertices.begin(), clusterVertices.end()), clusterVertices.end());
+	const size_t vertexCount = clusterVertices.size();
+
+	std::vector<uint32_t> corners(3 * triangleCount);
+	std::vector<uint32_t> remainingTriangleCounts(vertexCount, 0);
+	for(size_t iCorner = 0; iCorner < corners.size(); ++iCorner)
+	{
+		const int curVertexIdx = triangles[iCorner / 3].Vertices[iCorner % 3];
+		assert(curVertexIdx != -1);
+		const auto localVertexIt = std::ranges::lower_bound(clusterVertices, curVertexIdx);
+		corners[iCorner] = static_cast<uint32_t>(localVertexIt - clusterVertices.begin());
+		++remainingTriangleCounts[corners[iCorner]];
+	}
+
+	// Triangles of each vertex, the remaining ones first.
+	std::vector<uint32_t> triangleOffsets(vertexCount + 1, 0);
+	std::inclusive_scan(remainingTriangleCounts.begin(), remainingTriangleCounts.end(), triangleOffsets.begin() + 1);
+	std::vector<uint32_t> vertexTriangles(corners.size());
+	{
+		std::vector<uint32_t> curOffsets(triangleOffsets.begin(), triangleOffsets.end() - 1);
+		for(size_t iCorner = 0; iCorner < corners.size(); ++iCorner)
+			vertexTriangles[curOffsets[corners[iCorner]]++] = static_cast<uint32_t>(iCorner / 3);
+	}
+
+	std::vector<int> cachePositions(vertexCount, -1);
+	std::vector<float> vertexScores(vertexCount);
+	for(size_t iVertex = 0; iVertex < vertexCount; ++iVertex)
+		vertexScores[iVertex] = scoreTable.GetScore(-1, remainingTriangleCounts[iVertex]);
+
+	auto GetTriangleScore = [&](uint32_t triangleIdx)
+	{
+		return vertexScores[corners[3 * triangleIdx]] + vertexScores[corners[3 * triangleIdx + 1]]
+			+ vertexScores[corners[3 * triangleIdx + 2]];
+	};
+	std::vector<float> triangleScores(triangleCount);
+	uint32_t bestTriangleIdx = InvalidTriangle;
+	for(uint32_t iTriangle = 0; iTriangle < triangleCount; ++iTriangle)
+	{
+		triangleScores[iTriangle] = GetTriangleScore(iTriangle);
+		if(bestTriangleIdx == InvalidTriangle || triangleScores[iTriangle] > triangleScores[bestTriangleIdx])
+			bestTriangleIdx = iTriangle;
+	}
+
+	Core::Container::BitArray isEmitted(triangleCount);
+	std::vector<uint32_t> cache;
+	std::vector<uint32_t> nextCache;
+	cache.reserve(cacheSize + 3);
+	nextCache.reserve(cacheSize + 3);
+	size_t nextUnemittedIdx = 0;
+	for(size_t iOrder = 0; iOrder < triangleCount; ++iOrder)
+	{
+		// No triangle around the cached vertices, take the next one in the current order.
+		if(bestTriangleIdx == InvalidTriangle)
+		{
+			while(isEmitted.Get(nextUnemittedIdx))
+				++nextUnemittedIdx;
+			bestTriangleIdx = static_cast<uint32_t>(nextUnemittedIdx);
+		}
+
+		order[iOrder] = firstTriangleIdx + bestTriangleIdx;
+		isEmitted.Set(bestTriangleIdx);
+
+		// Remove the triangle from its vertices, which move to the front of the cache.
+		nextCache.clear();
+		for(VertexLocalIndex iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			const uint32_t curVertexIdx = corners[3 * bestTriangleIdx + iCorner];
+			if(std::ranges::find(nextCache, curVertexIdx) != nextCache.end())
+				continue; // Degenerate triangle.
+			nextCache.push_back(curVertexIdx);
+
+			const auto remainingBegin = vertexTriangles.begin() + triangleOffsets[curVertexIdx];
+			const auto remainingEnd = remainingBegin + remainingTriangleCounts[curVertexIdx];
+			std::iter_swap(std::find(remainingBegin, remainingEnd, bestTriangleIdx), remainingEnd - 1);
+			--remainingTriangleCounts[curVertexIdx];
+		}
+		const size_t triangleVertexCount = nextCache.size();
+		for(uint32_t curVertexIdx : cache)
+		{
+			const auto triangleVertexEnd = nextCache.begin() + triangleVertexCount;
+			if(std::find(nextCache.begin(), triangleVertexEnd, curVertexIdx) == triangleVertexEnd)
+				nextCache.push_back(curVertexIdx);
+		}
+
+		// Update the scores of the cached vertices and of the vertices leaving the cache, then of their triangles.
+		for(size_t iPosition = 0; iPosition < nextCache.size(); ++iPosition)
+		{
+			const uint32_t curVertexIdx = nextCache[iPosition];
+			cachePositions[curVertexIdx] = iPosition < cacheSize ? static_cast<int>(iPosition) : -1;
+			vertexScores[curVertexIdx] =
+				scoreTable.GetScore(cachePositions[curVertexIdx], remainingTriangleCounts[curVertexIdx]);
+		}
+		bestTriangleIdx = InvalidTriangle;
+		for(uint32_t curVertexIdx : nextCache)
+		{
+			const uint32_t remainingBegin = triangleOffsets[curVertexIdx];
+			const uint32_t remainingEnd = remainingBegin + remainingTriangleCounts[curVertexIdx];
+			for(uint32_t iRemaining = remainingBegin; iRemaining < remainingEnd; ++iRemaining)
+			{
+				const uint32_t curTriangleIdx = vertexTriangles[iRemaining];
+				if(isEmitted.Get(curTriangleIdx))
+					continue; // Listed twice by a degenerate triangle.
+				const float curScore = GetTriangleScore(curTriangleIdx);
+				triangleScores[curTriangleIdx] = curScore;
+				if(bestTriangleIdx == InvalidTriangle || curScore > triangleScores[bestTriangleIdx])
+					bestTriangleIdx = curTriangleIdx;
+			}
+		}
+
+		nextCache.resize(std::min<size_t>(nextCache.size(), cacheSize));
+		std::swap(cache, nextCache);
+	}
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+VertexCacheReport MeshVertexCache::Analyze(size_t vertexCount,
+										   ChunkedSpan<const Triangle> triangles,
+										   uint32_t cacheSize)
+{
+	assert(cacheSize > 0);
+
+	// A vertex is in the FIFO cache if less than cacheSize vertices were inserted after it.
+	std::vector<uint64_t> insertionTimes(vertexCount, 0);
+	uint64_t curTime = uint64_t(cacheSize) + 1;
+	Core::Container::BitArray isUsed(vertexCount);
+
+	VertexCacheReport report;
+	for(const Triangle& curTriangle : triangles)
+	{
+		for(int curVertexIdx : curTriangle.Vertices)
+		{
+			assert(curVertexIdx >= 0 && static_cast<size_t>(curVertexIdx) < vertexCount);
+			isUsed.Set(curVertexIdx);
+			if(curTime - insertionTimes[curVertexIdx] > cacheSize)
+			{
+				insertionTimes[curVertexIdx] = curTime++;
+				++report.CacheMissCount;
+			}
+		}
+	}
+
+	const size_t usedVertexCount = isUsed.Count();
+	const auto missCount = static_cast<float>(report.CacheMissCount);
+	report.ACMR = triangles.empty() ? 0.f : missCount / static_cast<float>(triangles.size());
+	report.ATVR = usedVertexCount == 0 ? 0.f : missCount / static_cast<float>(usedVertexCount);
+	return report;
+}
+
+std::vector<TriangleIndex> MeshVertexCache::ComputeTriangleOrder(ChunkedSpan<const Triangle> triangles,
+																 uint32_t cacheSize,
+																 uint32_t clusterSize,
+																 uint32_t threadCount)
+{
+	assert(cacheSize > 3 && "The cache must be larger than a triangle");
+	assert(clusterSize > 0);
+
+	const VertexScoreTable scoreTable(cacheSize);
+	std::vector<TriangleIndex> order(triangles.size());
+	const size_t clusterCount = (triangles.size() + clusterSize - 1) / clusterSize;
+	Core::Parallel::For(
+		clusterCount,
+		[&](size_t iCluster)
+		{
+			const size_t begin = iCluster * clusterSize;
+			const size_t size = std::min<size_t>(clusterSize, triangles.size() - begin);
+			OrderCluster(triangles.subspan(begin, size),
+						 static_cast<TriangleIndex>(begin),
+						 scoreTable,
+						 cacheSize,
+						 std::span<TriangleIndex>(order).subspan(begin, size));
+		},
+		1,
+		threadCount);
+	return order;
+}
+
+void MeshVertexCache::Optimize(Data::Surface::Mesh& mesh, uint32_t cacheSize, uint32_t threadCount)
+{
+	const std::vector<TriangleIndex> triangleOrder =
+		ComputeTriangleOrder(mesh.GetTriangles(), cacheSize, DefaultClusterSize, threadCount);
+	std::vector<VertexIndex> vertexOrder(mesh.GetVertexCount());
+	std::iota(vertexOrder.begin(), vertexOrder.end(), 0);
+	MeshReordering::Permute(mesh, vertexOrder, triangleOrder, threadCount);
+}
+} // namespace Utilitary::Surface
@@ -0,0 +1,119 @@
+#include "Application/OneRingAdjacency.h"
+
+#include "Core/ParallelHelpers.h"
+
+#include <cassert>
+#include <numeric>
+
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Minimal number of vertices processed by a thread.
+constexpr size_t AdjacencyGrainSize = 4096;
+
+/// @brief Count the elements of a circulator range.
+template<typename Range>
+uint32_t GetRangeSize(const Range& range)
+{
+	uint32_t size = 0;
+	for(auto it = range.begin(); it != range.end(); ++it)
+		++size;
+	return size;
+}
+} // namespace
+
+namespace Data::Surface
+{
+OneRingAdjacency OneRingAdjacency::Build(const Mesh& mesh, uint32_t threadCount)
+{
+	const size_t vertexCount = mesh.GetVertexCount();
+	OneRingAdjacency adjacency;
+	adjacency.m_VertexOffsets.assign(vertexCount + 1, 0);
+	adjacency.m_TriangleOffsets.assign(vertexCount + 1, 0);
+
+	// Count the neighbors of each vertex, shifted by one to get the offsets from an inclusive scan.
+	Core::Parallel::For(
+		vertexCount,
+		[&](size_t iVertex)
+		{
+			const VertexIndex curVertexIdx = static_cast<VertexIndex>(iVertex);
+			if(mesh.GetVertexData(curVertexIdx).IncidentTriangleIdx == -1)
+				return;
+			adjacency.m_VertexOffsets[iVertex + 1] = GetRangeSize(mesh.GetVerticesAroundVertex(curVertexIdx));
+			adjacency.m_TriangleOffsets[iVertex + 1] = GetRangeSize(mesh.GetTrianglesAroundVertex(curVertexIdx));
+		},
+		AdjacencyGrainSize,
+		threadCount);
+
+	std::inclusive_scan(
+		adjacency.m_VertexOffsets.begin(), adjacency.m_VertexOffsets.end(), adjacency.m_VertexOffsets.begin());
+	std::inclusive_scan(
+		adjacency.m_TriangleOffsets.begin(), adjacency.m_TriangleOffsets.end(), adjacency.m_TriangleOffsets.begin());
+	adjacency.m_Vertices.resize(adjacency.m_VertexOffsets.back());
+	adjacency.m_Triangles.resize(adjacency.m_TriangleOffsets.back());
+
+	// Store the neighbors of each vertex at its offset.
+	Core::Parallel::For(
+		vertexCount,
+		[&](size_t iVertex)
+		{
+			const VertexIndex curVertexIdx = static_cast<VertexIndex>(iVertex);
+			if(mesh.GetVertexData(curVertexIdx).IncidentTriangleIdx == -1)
+				return;
+
+			uint32_t curVertexOffset = adjacency.m_VertexOffsets[iVertex];
+			for(VertexIndex curNeighborIdx : mesh.GetVerticesAroundVertex(curVertexIdx))
+				adjacency.m_Vertices[curVertexOffset++] = curNeighborIdx;
+			assert(curVertexOffset == adjacency.m_VertexOffsets[iVertex + 1]);
+
+			uint32_t curTriangleOffset = adjacency.m_TriangleOffsets[iVertex];
+			for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertex(curVertexIdx))
+				adjacency.m_Triangles[curTriangleOffset++] = curTriangleIdx;
+			assert(curTriangleOffset == adjacency.m_TriangleOffsets[iVertex + 1]);
+		},
+		AdjacencyGrainSize,
+		threadCount);
+
+	return adjacency;
+}
+
+size_t OneRingAdjacency::GetVertexCount() const
+{
+	return m_VertexOffsets.size() - 1;
+}
+
+std::span<const VertexIndex> OneRingAdjacency::GetVerticesAroundVertex(VertexIndex index) const
+{
+	assert(index < GetVertexCount() && "Index out of bound");
+	return std::span<const VertexIndex>(m_Vertices)
+		.subspan(m_VertexOffsets[index], m_VertexOffsets[index + 1] - m_VertexOffsets[index]);
+}
+
+std::span<const TriangleIndex> OneRingAdjacency::GetTrianglesAroundVertex(VertexIndex index) const
+{
+	assert(index < GetVertexCount() && "Index out of bound");
+	return std::span<const TriangleIndex>(m_Triangles)
+		.subspan(m_TriangleOffsets[index], m_TriangleOffsets[index + 1] - m_TriangleOffsets[index]);
+}
+
+std::span<const uint32_t> OneRingAdjacency::GetVertexOffsets() const
+{
+	return m_VertexOffsets;
+}
+
+std::span<const VertexIndex> OneRingAdjacency::GetVertices() const
+{
+	return m_Vertices;
+}
+
+std::span<const uint32_t> OneRingAdjacency::GetTriangleOffsets() const
+{
+	return m_TriangleOffsets;
+}
+
+std::span<const TriangleIndex> OneRingAdjacency::GetTriangles() const
+{
+	return m_Triangles;
+}
+} // namespace Data::Surface
@@ -0,0 +1,202 @@
+#include "Application/PLYFormat.h"
+
+#include "Core/ParseHelpers.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+using namespace Core::Parse;
+
+namespace
+{
+using Utilitary::Surface::PLYFormat::ScalarType;
+
+/// @brief Names of each scalar type, the first one being the one written by the exporter.
+constexpr std::array<std::pair<std::string_view, ScalarType>, 16> ScalarNames{ {
+	{ "char", ScalarType::Int8 },
+	{ "uchar", ScalarType::UInt8 },
+	{ "short", ScalarType::Int16 },
+	{ "ushort", ScalarType::UInt16 },
+	{ "int", ScalarType::Int32 },
+	{ "uint", ScalarType::UInt32 },
+	{ "float", ScalarType::Float32 },
+	{ "double", ScalarType::Float64 },
+	{ "int8", ScalarType::Int8 },
+	{ "uint8", ScalarType::UInt8 },
+	{ "int16", ScalarType::Int16 },
+	{ "uint16", ScalarType::UInt16 },
+	{ "int32", ScalarType::Int32 },
+	{ "uint32", ScalarType::UInt32 },
+	{ "float32", ScalarType::Float32 },
+	{ "float64", ScalarType::Float64 },
+} };
+
+/// @brief Parse a scalar type name.
+/// @return True if the name is a known scalar type, false otherwise.
+bool ParseScalarType(std::string_view name, ScalarType& type)
+{
+	auto it = std::ranges::find(ScalarNames, name, &std::pair<std::string_view, ScalarType>::first);
+	if(it == ScalarNames.end())
+		return false;
+
+	type = it->second;
+	return true;
+}
+} // namespace
+
+namespace Utilitary::Surface::PLYFormat
+{
+int Element::FindProperty(std::string_view name) const
+{
+	for(size_t iProperty = 0; iProperty < Properties.size(); ++iProperty)
+	{
+		if(Properties[iProperty].Name == name)
+			return static_cast<int>(iProperty);
+	}
+	return -1;
+}
+
+uint32_t Element::GetFixedStride() const
+{
+	uint32_t stride = 0;
+	for(const Property& curProperty : Properties)
+	{
+		if(curProperty.IsList)
+			return 0;
+		stride += GetScalarSize(curProperty.Type);
+	}
+	return stride;
+}
+
+uint32_t Element::GetMinRecordSize(Encoding format) const
+{
+	if(format == Encoding::Ascii)
+		return 2 * static_cast<uint32_t>(Properties.size());
+
+	uint32_t size = 0;
+	for(const Property& curProperty : Properties)
+		size += GetScalarSize(curProperty.IsList ? curProperty.CountType : curProperty.Type);
+	return size;
+}
+
+uint32_t Element::GetPropertyOffset(int propertyIdx) const
+{
+	uint32_t offset = 0;
+	for(int iProperty = 0; iProperty < propertyIdx; ++iProperty)
+		offset += GetScalarSize(Properties[iProperty].Type);
+	return offset;
+}
+
+int Header::FindElement(std::string_view name) const
+{
+	for(size_t iElement = 0; iElement < Elements.size(); ++iElement)
+	{
+		if(Elements[iElement].Name == name)
+			return static_cast<int>(iElement);
+	}
+	return -1;
+}
+
+uint32_t GetScalarSize(ScalarType type)
+{
+	switch(type)
+	{
+		case ScalarType::Int8:
+		case ScalarType::UInt8:
+			return 1;
+		case ScalarType::Int16:
+		case ScalarType::UInt16:
+			return 2;
+		case ScalarType::Int32:
+		case ScalarType::UInt32:
+		case ScalarType::Float32:
+			return 4;
+		case ScalarType::Float64:
+			return 8;
+	}
+	return 0;
+}
+
+std::string_view GetScalarName(ScalarType type)
+{
+	auto it = std::ranges::find(ScalarNames, type, &std::pair<std::string_view, ScalarType>::second);
+	return it->first;
+}
+
+bool ParseHeader(std::string_view data, Header& header)
+{
+	header = {};
+
+	const char* cur = data.data();
+	const char* end = data.data() + data.size();
+
+	// Checking the magic line
+	if(ParseToken(cur, end) != "ply")
+		return false;
+	SkipLine(cur, end);
+
+	bool hasFormat = false;
+	while(cur != end)
+	{
+		const std::string_view keyword = ParseToken(cur, end);
+		if(keyword == "format")
+		{
+			const std::string_view encoding = ParseToken(cur, end);
+			if(encoding == "ascii")
+				header.Format = Encoding::Ascii;
+			else if(encoding == "binary_little_endian")
+				header.Format = Encoding::BinaryLittleEndian;
+			else if(encoding == "binary_big_endian")
+				header.Format = Encoding::BinaryBigEndian;
+			else
+				return false;
+
+			if(ParseToken(cur, end) != "1.0")
+				return false;
+			hasFormat = true;
+		}
+		else if(keyword == "element")
+		{
+			Element& curElement = header.Elements.emplace_back();
+			curElement.Name = ParseToken(cur, end);
+			if(curElement.Name.empty() || !ParseNumber(cur, end, curElement.Count))
+				return false;
+		}
+		else if(keyword == "property")
+		{
+			if(header.Elements.empty())
+				return false;
+
+			Property& curProperty = header.Elements.back().Properties.emplace_back();
+			std::string_view typeName = ParseToken(cur, end);
+			if(typeName == "list")
+			{
+				curProperty.IsList = true;
+				if(!ParseScalarType(ParseToken(cur, end), curProperty.CountType))
+					return false;
+				typeName = ParseToken(cur, end);
+			}
+
+			curProperty.Name = ParseToken(cur, end);
+			if(!ParseScalarType(typeName, curProperty.Type) || curProperty.Name.empty())
+				return false;
+		}
+		else if(keyword == "end_header")
+		{
+			SkipLine(cur, end);
+			header.DataOffset = static_cast<size_t>(cur - data.data());
+			return hasFormat;
+		}
+		else if(keyword != "comment" && keyword != "obj_info" && !keyword.empty())
+		{
+			return false;
+		}
+
+		SkipLine(cur, end);
+	}
+
+	// Missing end_header.
+	return false;
+}
+} // namespace Utilitary::Surface::PLYFormat
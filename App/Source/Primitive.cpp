@@ -1,5 +1,7 @@
 #include "Application/Primitive.h"
 
+#include <cassert>
+
 using namespace Data::Primitive;
 using namespace Core::BaseType;
 
@@ -44,4 +46,14 @@ int GetVertexLocalIndex(const Triangle& triangle, const VertexIndex index)
 
 	return -1;
 }
+
+EdgeIndex GetVertexLocalIndexInNeighbor(
+	const EdgeIndex edgeIdx, const EdgeIndex neighborEdgeIdx, const EdgeIndex vertexLocalIdx)
+{
+	assert(edgeIdx < 3 && neighborEdgeIdx < 3 && vertexLocalIdx != edgeIdx);
+
+	// The edge goes from Next[edgeIdx] to Previous[edgeIdx] in the triangle, and the other way in the neighbor.
+	return vertexLocalIdx == IndexHelpers::Next[edgeIdx] ? IndexHelpers::Previous[neighborEdgeIdx]
+														: IndexHelpers::Next[neighborEdgeIdx];
+}
 } // namespace Utilitary::Primitive
@@ -17,14 +17,14 @@ TriangleIndex TriangleProxy::GetIndex() const
 	return m_Index;
 }
 
-Triangle& TriangleProxy::GetTriangle()
+const Triangle& TriangleProxy::GetTriangle() const
 {
 	return m_Mesh->m_Triangles[m_Index];
 }
 
-const Triangle& TriangleProxy::GetTriangle() const
+void TriangleProxy::SetTriangle(const Triangle& triangle) const
 {
-	return m_Mesh->m_Triangles[m_Index];
+	m_Mesh->SetTriangleData(m_Index, triangle);
 }
 
 VertexIndex TriangleProxy::GetVertex(const EdgeIndex index) const
@@ -63,7 +63,7 @@ VertexIndex VertexProxy::GetIndex() const
 
 Vertex& VertexProxy::GetVertex()
 {
-	return m_Mesh->m_Vertices[m_Index];
+	return m_Mesh->m_Vertices.Write(m_Index);
 }
 
 const Vertex& VertexProxy::GetVertex() const
@@ -81,6 +81,11 @@ const Vec3& VertexProxy::GetPosition() const
 	return GetVertex().Position;
 }
 
+void VertexProxy::SetPosition(const Vec3& position) const
+{
+	m_Mesh->SetVertexPosition(m_Index, position);
+}
+
 int VertexProxy::GetIncidentTriangle() const
 {
 	return GetVertex().IncidentTriangleIdx;
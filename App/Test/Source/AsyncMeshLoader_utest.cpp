@@ -0,0 +1,100 @@
+#include "Application/AsyncMeshLoader.h"
+
+#include "Application/MeshBinaryFormat.h"
+#include "Application/MeshExporter.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <future>
+#include <vector>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+TEST(AsyncMeshLoaderTest, LoadAsync_ValidFiles_ShouldDeliverMesh)
+{
+	Mesh gridMesh = TestHelpers::CreateGridMesh(4, 3);
+	const std::filesystem::path binaryFilepath =
+		std::filesystem::path("TestFiles/asyncGrid").replace_extension(BinaryFormat::FileExtension);
+	MeshExporter::ExportBinary(gridMesh, binaryFilepath);
+
+	const std::vector<std::filesystem::path> filepaths{ "TestFiles/Off/cube.off",
+														"TestFiles/Obj/cube_vtvn.obj",
+														binaryFilepath };
+
+	// Start all the loadings before waiting for any of them.
+	std::vector<MeshLoadHandle> handles;
+	for(const std::filesystem::path& curFilepath : filepaths)
+		handles.emplace_back(AsyncMeshLoader::LoadAsync(curFilepath));
+
+	for(size_t iFile = 0; iFile < filepaths.size(); ++iFile)
+	{
+		MeshLoadHandle& curHandle = handles[iFile];
+		ASSERT_TRUE(curHandle.IsValid());
+
+		std::unique_ptr<Mesh> mesh = curHandle.Get();
+		ASSERT_NE(mesh, nullptr);
+		EXPECT_FALSE(curHandle.IsValid());
+		EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+
+		const LoadProgress& curProgress = curHandle.GetProgress();
+		EXPECT_EQ(curProgress.GetPhase(), LoadPhase::Done);
+		EXPECT_EQ(curProgress.GetTotalByteCount(), std::filesystem::file_size(filepaths[iFile]));
+		EXPECT_EQ(curProgress.GetByteCount(), curProgress.GetTotalByteCount());
+		EXPECT_DOUBLE_EQ(curProgress.GetRatio(), 1.);
+	}
+}
+
+TEST(AsyncMeshLoaderTest, LoadAsync_InvalidFile_ShouldFail)
+{
+	for(const char* curFilepath : { "TestFiles/Off/notAFile.off", "TestFiles/Off/cube.txt" })
+	{
+		MeshLoadHandle handle = AsyncMeshLoader::LoadAsync(curFilepath);
+		EXPECT_EQ(handle.Get(), nullptr);
+		EXPECT_EQ(handle.GetProgress().GetPhase(), LoadPhase::Failed);
+	}
+}
+
+TEST(AsyncMeshLoaderTest, LoadAsync_CancelledBeforeStart_ShouldNotLoad)
+{
+	Core::Parallel::ThreadPool pool(1);
+
+	// Keep the only worker busy until the loading has been cancelled.
+	std::promise<void> release;
+	std::future<void> blocker = pool.Submit(
+		[releaseFuture = release.get_future()]()
+		{
+			releaseFuture.wait();
+		});
+
+	MeshLoadHandle handle = AsyncMeshLoader::LoadAsync("TestFiles/Off/cube.off", pool);
+	EXPECT_FALSE(handle.IsReady());
+	EXPECT_EQ(handle.GetProgress().GetPhase(), LoadPhase::Pending);
+
+	handle.Cancel();
+	release.set_value();
+
+	EXPECT_EQ(handle.Get(), nullptr);
+	EXPECT_EQ(handle.GetProgress().GetPhase(), LoadPhase::Cancelled);
+	EXPECT_EQ(handle.GetProgress().GetByteCount(), 0);
+}
+
+TEST(AsyncMeshLoaderTest, Loaders_CancelRequested_ShouldStopLoading)
+{
+	{
+		LoadProgress progress;
+		progress.RequestCancel();
+		EXPECT_EQ(MeshLoader::LoadOFFMapped("TestFiles/Off/cube.off", nullptr, &progress), nullptr);
+		EXPECT_EQ(progress.GetPhase(), LoadPhase::Cancelled);
+	}
+
+	{
+		LoadProgress progress;
+		progress.RequestCancel();
+		EXPECT_EQ(MeshLoader::LoadOBJParallel("TestFiles/Obj/cube.obj", 2, nullptr, &progress), nullptr);
+		EXPECT_EQ(progress.GetPhase(), LoadPhase::Cancelled);
+	}
+}
@@ -0,0 +1,149 @@
+#include "Application/AttributeChannel.h"
+
+#include "Application/Mesh.h"
+#include "Application/PrimitiveProxy.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Data::Attribute;
+using namespace Core::BaseType;
+
+TEST(AttributeChannelTest, AddVertexAttribute_ShouldCreateChannelOfVertexCount)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	AttributeChannel<Vec3>& normals = mesh.AddVertexAttribute<Vec3>("normal", { 0.f, 0.f, 1.f });
+	ASSERT_EQ(normals.GetSize(), mesh.GetVertexCount());
+	for(const Vec3& curNormal : normals.GetValues())
+		EXPECT_EQ(curNormal, Vec3(0.f, 0.f, 1.f));
+
+	// Adding the same attribute again returns the existing channel.
+	EXPECT_EQ(&mesh.AddVertexAttribute<Vec3>("normal"), &normals);
+	EXPECT_EQ(mesh.GetVertexAttribute<Vec3>("normal"), &normals);
+	EXPECT_TRUE(mesh.HasVertexAttribute("normal"));
+
+	// Unknown name or other type.
+	EXPECT_EQ(mesh.GetVertexAttribute<Vec3>("color"), nullptr);
+	EXPECT_EQ(mesh.GetVertexAttribute<float>("normal"), nullptr);
+	EXPECT_FALSE(mesh.HasTriangleAttribute("normal"));
+}
+
+TEST(AttributeChannelTest, AddVertex_AddTriangle_ShouldGrowChannelsWithDefaultValue)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(1, 1);
+	mesh.AddVertexAttribute<float>("quality", 2.f);
+	mesh.AddTriangleAttribute<int>("material", -1);
+	mesh.GetVertexAttribute<float>("quality")->Fill(5.f);
+
+	const VertexIndex newVertex = mesh.AddVertex({ Vec3(2.f, 0.f, 0.f), 0 });
+	const TriangleIndex newTriangle = mesh.AddTriangle({ { 1, 4, 3 }, { -1, -1, -1 } });
+
+	const AttributeChannel<float>& qualities = *mesh.GetVertexAttribute<float>("quality");
+	const AttributeChannel<int>& materials = *mesh.GetTriangleAttribute<int>("material");
+	ASSERT_EQ(qualities.GetSize(), mesh.GetVertexCount());
+	ASSERT_EQ(materials.GetSize(), mesh.GetTriangleCount());
+	EXPECT_EQ(qualities[0], 5.f);
+	EXPECT_EQ(qualities[newVertex], 2.f);
+	EXPECT_EQ(materials[newTriangle], -1);
+}
+
+TEST(AttributeChannelTest, ProxyAttributes_ShouldReadAndWriteChannels)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(1, 2);
+	mesh.AddVertexAttribute<Vec3>("normal");
+	mesh.AddTriangleAttribute<uint8_t>("selected");
+
+	const VertexProxy vertex = mesh.GetVertex(3);
+	vertex.SetAttribute("normal", Vec3(1.f, 0.f, 0.f));
+	EXPECT_EQ(vertex.GetAttribute<Vec3>("normal"), Vec3(1.f, 0.f, 0.f));
+	EXPECT_EQ((*mesh.GetVertexAttribute<Vec3>("normal"))[3], Vec3(1.f, 0.f, 0.f));
+
+	const TriangleProxy triangle = mesh.GetTriangle(2);
+	triangle.GetAttribute<uint8_t>("selected") = 1;
+	EXPECT_EQ((*mesh.GetTriangleAttribute<uint8_t>("selected"))[2], 1);
+	EXPECT_EQ((*mesh.GetTriangleAttribute<uint8_t>("selected"))[1], 0);
+}
+
+TEST(AttributeChannelTest, MeshCopy_ShouldDeepCopyChannels)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(1, 1);
+	mesh.AddVertexAttribute<float>("quality", 1.f);
+
+	Mesh copy(mesh);
+	(*copy.GetVertexAttribute<float>("quality"))[0] = 3.f;
+	EXPECT_EQ((*mesh.GetVertexAttribute<float>("quality"))[0], 1.f);
+	EXPECT_NE(copy.GetVertexAttribute<float>("quality"), mesh.GetVertexAttribute<float>("quality"));
+
+	AttributeChannelSet channels;
+	channels.Add<int>("a", 2, 7);
+	AttributeChannelSet channelsCopy;
+	channelsCopy = channels;
+	channels.Get<int>("a")->Fill(0);
+	EXPECT_EQ((*channelsCopy.Get<int>("a"))[1], 7);
+}
+
+TEST(AttributeChannelTest, Copy_ShouldShareChannelsUntilModified)
+{
+	AttributeChannelSet channels;
+	channels.Add<int>("a", 2, 7);
+	channels.Add<float>("b", 2, 1.f);
+	const AttributeChannelSet channelsCopy = channels;
+	EXPECT_EQ(channelsCopy.Get<int>("a"), std::as_const(channels).Get<int>("a"));
+
+	// Only the modified channel is copied.
+	(*channels.Get<int>("a"))[0] = 3;
+	EXPECT_NE(channelsCopy.Get<int>("a"), std::as_const(channels).Get<int>("a"));
+	EXPECT_EQ(channelsCopy.Get<float>("b"), std::as_const(channels).Get<float>("b"));
+	EXPECT_EQ((*channelsCopy.Get<int>("a"))[0], 7);
+
+	// Resizing copies the shared channels.
+	channels.Resize(3);
+	EXPECT_EQ(channelsCopy.Get<float>("b")->GetSize(), 2);
+	EXPECT_EQ(channels.Get<float>("b")->GetSize(), 3);
+}
+
+TEST(AttributeChannelTest, Remove_ShouldKeepCreationOrder)
+{
+	AttributeChannelSet channels;
+	channels.Add<float>("a", 3);
+	channels.Add<Vec2>("b", 3);
+	channels.Add<int>("c", 3);
+
+	EXPECT_TRUE(channels.Remove("b"));
+	EXPECT_FALSE(channels.Remove("b"));
+	EXPECT_EQ(channels.GetCount(), 2);
+	EXPECT_EQ(channels.GetNames(), (std::vector<std::string>{ "a", "c" }));
+
+	channels.Resize(5);
+	EXPECT_EQ(channels.Get<int>("c")->GetSize(), 5);
+
+	channels.Clear();
+	EXPECT_EQ(channels.GetCount(), 0);
+}
+
+TEST(AttributeChannelTest, Remap_ShouldTakeOldValuesOrDefault)
+{
+	AttributeChannelSet channels;
+	AttributeChannel<int>& values = channels.Add<int>("a", 3, -1);
+	values[0] = 10;
+	values[1] = 11;
+	values[2] = 12;
+	const AttributeChannelSet channelsCopy = channels;
+
+	// New value i is the old value oldIndices[i], the new elements get the default value.
+	const std::vector<int> oldIndices = { 2, -1, 0, -1 };
+	channels.Remap(oldIndices);
+	const AttributeChannel<int>* remappedValues = std::as_const(channels).Get<int>("a");
+	ASSERT_EQ(remappedValues->GetSize(), 4);
+	EXPECT_EQ((*remappedValues)[0], 12);
+	EXPECT_EQ((*remappedValues)[1], -1);
+	EXPECT_EQ((*remappedValues)[2], 10);
+	EXPECT_EQ((*remappedValues)[3], -1);
+
+	// The copy sharing the channel is not modified.
+	EXPECT_EQ(channelsCopy.Get<int>("a")->GetSize(), 3);
+	EXPECT_EQ((*channelsCopy.Get<int>("a"))[1], 11);
+}
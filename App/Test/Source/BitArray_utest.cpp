@@ -0,0 +1,78 @@
+#include "Core/BitArray.h"
+
+#include "Core/ParallelHelpers.h"
+
+#include <gtest/gtest.h>
+
+using namespace Core::Container;
+
+TEST(BitArrayTest, SetGetReset_ShouldUpdateSingleBits)
+{
+	BitArray bits(130);
+	EXPECT_EQ(bits.GetSize(), 130);
+	EXPECT_EQ(bits.GetWords().size(), 3);
+	EXPECT_EQ(bits.Count(), 0);
+
+	bits.Set(0);
+	bits.Set(64);
+	bits.Set(129);
+	EXPECT_TRUE(bits.Get(0));
+	EXPECT_FALSE(bits.Get(1));
+	EXPECT_TRUE(bits.Get(64));
+	EXPECT_TRUE(bits.Get(129));
+	EXPECT_EQ(bits.Count(), 3);
+
+	bits.Reset(64);
+	EXPECT_FALSE(bits.Get(64));
+	EXPECT_EQ(bits.Count(), 2);
+}
+
+TEST(BitArrayTest, FindNext_ShouldSkipEmptyWords)
+{
+	BitArray bits(300);
+	bits.Set(3);
+	bits.Set(200);
+	bits.Set(299);
+
+	EXPECT_EQ(bits.FindNext(0), 3);
+	EXPECT_EQ(bits.FindNext(3), 3);
+	EXPECT_EQ(bits.FindNext(4), 200);
+	EXPECT_EQ(bits.FindNext(201), 299);
+	EXPECT_EQ(bits.FindNext(300), 300);
+
+	bits.Reset(299);
+	EXPECT_EQ(bits.FindNext(201), 300);
+}
+
+TEST(BitArrayTest, FillAndResize_ShouldKeepTrailingBitsToZero)
+{
+	BitArray bits(70);
+	bits.Fill(true);
+	EXPECT_EQ(bits.Count(), 70);
+	EXPECT_EQ(bits.GetWords()[1], 0x3F);
+
+	bits.Resize(66);
+	EXPECT_EQ(bits.Count(), 66);
+	bits.Resize(200);
+	EXPECT_EQ(bits.Count(), 66);
+	EXPECT_FALSE(bits.Get(66));
+	EXPECT_EQ(bits.FindNext(66), 200);
+
+	bits.Fill(false);
+	EXPECT_EQ(bits.Count(), 0);
+}
+
+TEST(BitArrayTest, SetAtomic_ConcurrentWriters_ShouldSetEveryBit)
+{
+	// Each task sets one bit out of four, so every word is shared by all the tasks.
+	constexpr uint32_t TaskCount = 4;
+	BitArray bits(4096);
+	Core::Parallel::ForEachTask(
+		TaskCount,
+		[&bits](uint32_t iTask)
+		{
+			for(size_t index = iTask; index < bits.GetSize(); index += TaskCount)
+				bits.SetAtomic(index);
+		});
+	EXPECT_EQ(bits.Count(), bits.GetSize());
+}
@@ -0,0 +1,236 @@
+#include "Core/ChunkedCowVector.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+using namespace Core::Container;
+
+static_assert(std::random_access_iterator<ChunkedSpan<const int>::Iterator>);
+static_assert(std::random_access_iterator<ChunkedWriteSpan<int>::Iterator>);
+
+namespace
+{
+constexpr size_t ChunkSize = ChunkedCowVector<int>::ChunkSize;
+
+/// @brief Create a vector of the given number of increasing values, starting at 0.
+ChunkedCowVector<int> CreateValues(size_t count)
+{
+	std::vector<int> values(count);
+	std::iota(values.begin(), values.end(), 0);
+	return ChunkedCowVector<int>(std::move(values));
+}
+
+/// @brief Value counting its copies, to check which values a vector copies.
+struct CountedValue
+{
+	static inline size_t CopyCount = 0;
+
+	CountedValue(int value)
+		: Value(value)
+	{}
+	CountedValue(const CountedValue& other)
+		: Value(other.Value)
+	{
+		++CopyCount;
+	}
+	CountedValue(CountedValue&& other) noexcept = default;
+	CountedValue& operator=(const CountedValue& other)
+	{
+		Value = other.Value;
+		++CopyCount;
+		return *this;
+	}
+	CountedValue& operator=(CountedValue&& other) noexcept = default;
+
+	int Value{ 0 };
+};
+} // namespace
+
+TEST(ChunkedCowVectorTest, Construct_ShouldAdoptValuesWithoutCopy)
+{
+	std::vector<int> values(2 * ChunkSize + 5, 3);
+	const int* data = values.data();
+
+	ChunkedCowVector<int> chunkedValues(std::move(values));
+	EXPECT_EQ(chunkedValues.size(), 2 * ChunkSize + 5);
+	EXPECT_EQ(chunkedValues.GetChunkCount(), 3);
+	EXPECT_EQ(&chunkedValues[0], data);
+	EXPECT_EQ(&chunkedValues[ChunkSize + 1], data + ChunkSize + 1);
+	EXPECT_TRUE(chunkedValues.Read().IsContiguous());
+	EXPECT_FALSE(chunkedValues.IsShared());
+
+	// Writing the whole values keeps them in place.
+	EXPECT_EQ(&chunkedValues.Write()[0], data);
+
+	// Extracting them does not copy them either.
+	const std::vector<int> extractedValues = chunkedValues.Extract();
+	EXPECT_EQ(extractedValues.data(), data);
+	EXPECT_TRUE(chunkedValues.empty());
+	EXPECT_EQ(chunkedValues.GetChunkCount(), 0);
+}
+
+TEST(ChunkedCowVectorTest, WriteIndex_ShouldCopyTheChunkOfTheValueOnly)
+{
+	ChunkedCowVector<int> values = CreateValues(3 * ChunkSize);
+	const ChunkedCowVector<int> copy = values;
+	for(size_t iChunk = 0; iChunk < values.GetChunkCount(); ++iChunk)
+		EXPECT_TRUE(values.IsChunkShared(iChunk));
+
+	values.Write(ChunkSize + 2) = -1;
+	EXPECT_TRUE(values.IsChunkShared(0));
+	EXPECT_FALSE(values.IsChunkShared(1));
+	EXPECT_TRUE(values.IsChunkShared(2));
+	EXPECT_FALSE(copy.IsChunkShared(1));
+	EXPECT_EQ(&values[0], &copy[0]);
+	EXPECT_NE(&values[ChunkSize], &copy[ChunkSize]);
+	EXPECT_EQ(&values[2 * ChunkSize], &copy[2 * ChunkSize]);
+
+	// The copy keeps its values, the written chunk has the values of the copy except the written one.
+	EXPECT_EQ(copy[ChunkSize + 2], static_cast<int>(ChunkSize + 2));
+	EXPECT_EQ(values[ChunkSize + 2], -1);
+	EXPECT_EQ(values[ChunkSize + 3], static_cast<int>(ChunkSize + 3));
+	EXPECT_FALSE(values.Read().IsContiguous());
+
+	// Writing again the chunk, which is not shared anymore, does not copy it.
+	const int* chunkData = &values[ChunkSize];
+	values.Write(ChunkSize) = -2;
+	EXPECT_EQ(&values[ChunkSize], chunkData);
+}
+
+TEST(ChunkedCowVectorTest, Write_ShouldCopyTheSharedChunksOnly)
+{
+	ChunkedCowVector<int> values = CreateValues(2 * ChunkSize + 1);
+	const ChunkedCowVector<int> copy = values;
+	values.Write(0) = -1;
+	const int* chunkData = &values[0];
+
+	const ChunkedSpan<int> writtenValues = values.Write();
+	EXPECT_FALSE(values.IsShared());
+	EXPECT_FALSE(writtenValues.IsContiguous());
+	EXPECT_EQ(&writtenValues[0], chunkData);
+	ASSERT_EQ(writtenValues.size(), 2 * ChunkSize + 1);
+	EXPECT_EQ(writtenValues[0], -1);
+	EXPECT_EQ(writtenValues[2 * ChunkSize], static_cast<int>(2 * ChunkSize));
+	EXPECT_EQ(copy[0], 0);
+
+	// Values not shared are written in place.
+	ChunkedCowVector<int> ownedValues = CreateValues(ChunkSize + 1);
+	const int* data = &ownedValues[0];
+	EXPECT_TRUE(ownedValues.Write().IsContiguous());
+	EXPECT_EQ(&ownedValues.Write()[0], data);
+}
+
+TEST(ChunkedCowVectorTest, EmplaceBack_ShouldAddChunks)
+{
+	ChunkedCowVector<int> values;
+	EXPECT_TRUE(values.empty());
+	EXPECT_EQ(values.begin(), values.end());
+
+	values.reserve(2 * ChunkSize + 1);
+	for(size_t iValue = 0; iValue < 2 * ChunkSize + 1; ++iValue)
+		EXPECT_EQ(values.emplace_back(static_cast<int>(iValue)), static_cast<int>(iValue));
+	EXPECT_EQ(values.size(), 2 * ChunkSize + 1);
+	EXPECT_EQ(values.GetChunkCount(), 3);
+	EXPECT_TRUE(std::ranges::equal(values, CreateValues(2 * ChunkSize + 1)));
+
+	// Adding to a shared chunk copies it first.
+	const ChunkedCowVector<int> copy = values;
+	values.emplace_back(-1);
+	EXPECT_EQ(copy.size(), 2 * ChunkSize + 1);
+	EXPECT_TRUE(values.IsChunkShared(0));
+	EXPECT_FALSE(values.IsChunkShared(2));
+	EXPECT_EQ(values[2 * ChunkSize + 1], -1);
+
+	// The values are copied out of the chunks.
+	const std::vector<int> extractedValues = values.Extract();
+	ASSERT_EQ(extractedValues.size(), 2 * ChunkSize + 2);
+	EXPECT_EQ(extractedValues[ChunkSize], static_cast<int>(ChunkSize));
+	EXPECT_EQ(extractedValues.back(), -1);
+}
+
+TEST(ChunkedCowVectorTest, EmplaceBack_ShouldKeepOwnedValuesContiguous)
+{
+	ChunkedCowVector<CountedValue> values;
+	CountedValue::CopyCount = 0;
+	for(size_t iValue = 0; iValue < 3 * ChunkSize + 1; ++iValue)
+		values.emplace_back(static_cast<int>(iValue));
+	EXPECT_EQ(values.GetChunkCount(), 4);
+	EXPECT_TRUE(values.Read().IsContiguous());
+	EXPECT_EQ(values[2 * ChunkSize].Value, static_cast<int>(2 * ChunkSize));
+	EXPECT_EQ(CountedValue::CopyCount, 0);
+
+	// The added values are extracted without copy.
+	const CountedValue* data = &values[0];
+	const std::vector<CountedValue> extractedValues = values.Extract();
+	EXPECT_EQ(extractedValues.data(), data);
+	EXPECT_EQ(CountedValue::CopyCount, 0);
+}
+
+TEST(ChunkedCowVectorTest, ChunkedWriteSpan_ShouldCopyTheWrittenChunksOnly)
+{
+	ChunkedCowVector<CountedValue> values;
+	const ChunkedWriteSpan<CountedValue> writtenValues(values);
+	CountedValue::CopyCount = 0;
+
+	// Adding and writing values does not copy them.
+	for(size_t iValue = 0; iValue < 3 * ChunkSize; ++iValue)
+	{
+		values.emplace_back(0);
+		writtenValues[iValue].Value = static_cast<int>(iValue);
+	}
+	EXPECT_EQ(writtenValues.size(), 3 * ChunkSize);
+	EXPECT_EQ(CountedValue::CopyCount, 0);
+
+	// Writing a value of a copy copies its chunk only.
+	const ChunkedCowVector<CountedValue> copy = values;
+	writtenValues[ChunkSize + 1].Value = -1;
+	EXPECT_EQ(CountedValue::CopyCount, ChunkSize);
+	EXPECT_TRUE(values.IsChunkShared(0));
+	EXPECT_FALSE(values.IsChunkShared(1));
+	EXPECT_EQ(copy[ChunkSize + 1].Value, static_cast<int>(ChunkSize + 1));
+
+	// Iterating over the values of this chunk does not copy them again.
+	const auto chunkBegin = writtenValues.begin() + ChunkSize;
+	for(CountedValue& curValue : std::ranges::subrange(chunkBegin, chunkBegin + ChunkSize))
+		curValue.Value = 0;
+	EXPECT_EQ(CountedValue::CopyCount, ChunkSize);
+	EXPECT_EQ(copy[ChunkSize].Value, static_cast<int>(ChunkSize));
+
+	// Reading through the view does not copy the values.
+	const ChunkedSpan<const CountedValue> readValues = writtenValues;
+	EXPECT_EQ(readValues[2 * ChunkSize].Value, static_cast<int>(2 * ChunkSize));
+	EXPECT_EQ(CountedValue::CopyCount, ChunkSize);
+	EXPECT_TRUE(values.IsChunkShared(2));
+}
+
+TEST(ChunkedCowVectorTest, ChunkedSpan_ShouldReadChunkedValues)
+{
+	ChunkedCowVector<int> values = CreateValues(3 * ChunkSize);
+	const ChunkedCowVector<int> copy = values;
+	values.Write(ChunkSize) = -1;
+
+	const ChunkedSpan<const int> view = values;
+	EXPECT_FALSE(view.IsContiguous());
+	EXPECT_EQ(view[ChunkSize], -1);
+	EXPECT_EQ(view[ChunkSize + 1], static_cast<int>(ChunkSize + 1));
+	EXPECT_EQ(view.end() - view.begin(), static_cast<std::ptrdiff_t>(3 * ChunkSize));
+
+	// A subspan across the chunks.
+	const ChunkedSpan<const int> subView = view.subspan(ChunkSize - 1, 3);
+	const std::vector<int> expectedValues{ static_cast<int>(ChunkSize - 1), -1, static_cast<int>(ChunkSize + 1) };
+	EXPECT_TRUE(std::ranges::equal(subView, expectedValues));
+
+	// The contiguous values stop at the end of their chunk.
+	EXPECT_EQ(view.GetContiguousValues(ChunkSize - 1).size(), 1);
+	EXPECT_EQ(view.GetContiguousValues(2 * ChunkSize).size(), ChunkSize);
+
+	// Contiguous values are viewed directly.
+	const std::vector<int> vectorValues{ 1, 2, 3 };
+	const ChunkedSpan<const int> vectorView = vectorValues;
+	EXPECT_TRUE(vectorView.IsContiguous());
+	EXPECT_EQ(&vectorView[1], &vectorValues[1]);
+	EXPECT_EQ(vectorView.GetContiguousValues(0).size(), 3);
+}
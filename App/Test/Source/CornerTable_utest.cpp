@@ -0,0 +1,171 @@
+#include "Application/CornerTable.h"
+
+#include "Application/MeshIntegrity.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Create a 4x4 grid without the two triangles of one of its interior quads.
+Mesh CreateGridMeshWithHole()
+{
+	Mesh mesh;
+	const Mesh gridMesh = TestHelpers::CreateGridMesh(4, 4);
+	for(const Vertex& curVertex : gridMesh.GetVertices())
+		mesh.AddVertex({ .Position = curVertex.Position });
+	for(TriangleIndex iTriangle = 0; iTriangle < gridMesh.GetTriangleCount(); ++iTriangle)
+	{
+		if(iTriangle != 12 && iTriangle != 13)
+			mesh.AddTriangle({ .Vertices = gridMesh.GetTriangleData(iTriangle).Vertices });
+	}
+	mesh.UpdateMeshConnectivity();
+	return mesh;
+}
+
+/// @brief Check that the circulators of the corner table match the circulators of the mesh.
+void ExpectSameAsCirculators(const Mesh& mesh, const CornerTable& table)
+{
+	ASSERT_EQ(table.GetVertexCount(), mesh.GetVertexCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		std::vector<VertexIndex> vertices;
+		std::vector<VertexIndex> expectedVertices;
+		for(VertexIndex curVertexIdx : table.GetVerticesAroundVertex(iVertex))
+			vertices.push_back(curVertexIdx);
+		for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+			expectedVertices.push_back(curVertexIdx);
+		EXPECT_EQ(vertices, expectedVertices);
+
+		std::vector<TriangleIndex> triangles;
+		std::vector<TriangleIndex> expectedTriangles;
+		for(TriangleIndex curTriangleIdx : table.GetTrianglesAroundVertex(iVertex))
+			triangles.push_back(curTriangleIdx);
+		for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertex(iVertex))
+			expectedTriangles.push_back(curTriangleIdx);
+		EXPECT_EQ(triangles, expectedTriangles);
+	}
+}
+} // namespace
+
+TEST(CornerTableTest, FromMesh_ShouldLinkOppositeCorners)
+{
+	const Mesh mesh = TestHelpers::CreateGridMesh(3, 2);
+	const CornerTable table = CornerTable::FromMesh(mesh);
+	ASSERT_EQ(table.GetCornerCount(), 3 * mesh.GetTriangleCount());
+
+	size_t boundaryCornerCount = 0;
+	for(CornerTable::CornerIndex iCorner = 0; iCorner < static_cast<int>(table.GetCornerCount()); ++iCorner)
+	{
+		const Triangle& curTriangle = mesh.GetTriangleData(CornerTable::GetTriangle(iCorner));
+		EXPECT_EQ(table.GetVertex(iCorner), static_cast<VertexIndex>(curTriangle.Vertices[iCorner % 3]));
+		EXPECT_EQ(CornerTable::GetNext(CornerTable::GetPrevious(iCorner)), iCorner);
+		EXPECT_EQ(CornerTable::GetTriangle(CornerTable::GetNext(iCorner)), CornerTable::GetTriangle(iCorner));
+
+		const CornerTable::CornerIndex opposite = table.GetOpposite(iCorner);
+		if(opposite == CornerTable::InvalidCorner)
+		{
+			++boundaryCornerCount;
+			continue;
+		}
+
+		// The edge facing the corner is shared in the opposite direction.
+		EXPECT_EQ(table.GetOpposite(opposite), iCorner);
+		EXPECT_EQ(table.GetVertex(CornerTable::GetNext(opposite)), table.GetVertex(CornerTable::GetPrevious(iCorner)));
+		EXPECT_EQ(table.GetVertex(CornerTable::GetPrevious(opposite)), table.GetVertex(CornerTable::GetNext(iCorner)));
+	}
+
+	// A 3x2 grid has 2 * (3 + 2) boundary edges.
+	EXPECT_EQ(boundaryCornerCount, 10);
+}
+
+TEST(CornerTableTest, Circulators_ShouldMatchMeshCirculators)
+{
+	const Mesh gridMesh = CreateGridMeshWithHole();
+	ExpectSameAsCirculators(gridMesh, CornerTable::FromMesh(gridMesh));
+
+	const Mesh sphereMesh = TestHelpers::CreateIcosphereMesh(2);
+	ExpectSameAsCirculators(sphereMesh, CornerTable::FromMesh(sphereMesh));
+
+	// Without neighbor edge slots, the shared edges are searched.
+	Mesh searchMesh = gridMesh;
+	searchMesh.EditTriangles();
+	ASSERT_FALSE(searchMesh.HasNeighborEdgeSlots());
+	const CornerTable searchTable = CornerTable::FromMesh(searchMesh);
+	const CornerTable table = CornerTable::FromMesh(gridMesh);
+	EXPECT_TRUE(std::ranges::equal(searchTable.GetOppositeCorners(), table.GetOppositeCorners()));
+}
+
+TEST(CornerTableTest, Circulators_IsolatedVertex_ShouldBeEmpty)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(1, 1);
+	mesh.AddVertex({ .Position = { 5.f, 5.f, 0.f } });
+	const CornerTable table = CornerTable::FromMesh(mesh);
+
+	const VertexIndex isolatedVertexIdx = mesh.GetVertexCount() - 1;
+	EXPECT_EQ(table.GetVertexCorner(isolatedVertexIdx), CornerTable::InvalidCorner);
+	const CornerTable::VerticesAroundVertexRange vertexRange = table.GetVerticesAroundVertex(isolatedVertexIdx);
+	const CornerTable::TrianglesAroundVertexRange triangleRange = table.GetTrianglesAroundVertex(isolatedVertexIdx);
+	EXPECT_TRUE(vertexRange.begin() == vertexRange.end());
+	EXPECT_TRUE(triangleRange.begin() == triangleRange.end());
+}
+
+TEST(CornerTableTest, ToMesh_ShouldRoundTrip)
+{
+	Mesh mesh = CreateGridMeshWithHole();
+	Data::Attribute::AttributeChannel<float>& weights = mesh.AddVertexAttribute<float>("Weight");
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		weights[iVertex] = static_cast<float>(iVertex);
+	mesh.AddTriangleAttribute<int>("Label", 7);
+
+	CornerTable table = CornerTable::FromMesh(mesh, 3);
+
+	// The channels are shared with the mesh until they are written.
+	EXPECT_EQ(std::as_const(table).GetVertexAttribute<float>("Weight"),
+			  std::as_const(mesh).GetVertexAttribute<float>("Weight"));
+	EXPECT_EQ(std::as_const(table).GetTriangleAttribute<int>("Label"),
+			  std::as_const(mesh).GetTriangleAttribute<int>("Label"));
+	ASSERT_NE(table.GetVertexAttribute<float>("Weight"), nullptr);
+	EXPECT_EQ((*table.GetVertexAttribute<float>("Weight"))[4], 4.f);
+
+	// Edit the corner table, then convert it back.
+	table.GetPositions()[0] = { -1.f, -1.f, 0.f };
+	(*table.GetTriangleAttribute<int>("Label"))[1] = 3;
+	const Mesh convertedMesh = table.ToMesh(3);
+	EXPECT_EQ((*std::as_const(mesh).GetTriangleAttribute<int>("Label"))[1], 7);
+	EXPECT_EQ(convertedMesh.GetTriangleAttribute<int>("Label"),
+			  std::as_const(table).GetTriangleAttribute<int>("Label"));
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(convertedMesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_TRUE(convertedMesh.HasNeighborEdgeSlots());
+	ASSERT_EQ(convertedMesh.GetVertexCount(), mesh.GetVertexCount());
+	ASSERT_EQ(convertedMesh.GetTriangleCount(), mesh.GetTriangleCount());
+	EXPECT_EQ(convertedMesh.GetVertexData(0).Position, Vec3(-1.f, -1.f, 0.f));
+	for(VertexIndex iVertex = 1; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const Vertex& curVertex = convertedMesh.GetVertexData(iVertex);
+		EXPECT_EQ(curVertex.Position, mesh.GetVertexData(iVertex).Position);
+		EXPECT_EQ(curVertex.IncidentTriangleIdx, mesh.GetVertexData(iVertex).IncidentTriangleIdx);
+	}
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const Triangle& curTriangle = convertedMesh.GetTriangleData(iTriangle);
+		EXPECT_EQ(curTriangle.Vertices, mesh.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(curTriangle.Neighbors, mesh.GetTriangleData(iTriangle).Neighbors);
+		const NeighborEdgeSlots& curSlots = convertedMesh.GetNeighborEdgeSlots()[iTriangle];
+		EXPECT_EQ(curSlots.Packed, mesh.GetNeighborEdgeSlots()[iTriangle].Packed);
+	}
+
+	const auto* labels = convertedMesh.GetTriangleAttribute<int>("Label");
+	ASSERT_NE(labels, nullptr);
+	EXPECT_EQ((*labels)[0], 7);
+	EXPECT_EQ((*labels)[1], 3);
+	EXPECT_EQ((*convertedMesh.GetVertexAttribute<float>("Weight"))[4], 4.f);
+}
@@ -0,0 +1,69 @@
+#include "Core/CowVector.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thread>
+
+using namespace Core::Container;
+
+TEST(CowVectorTest, Copy_ShouldShareValuesUntilWrite)
+{
+	CowVector<int> values(std::vector<int>{ 1, 2, 3 });
+	EXPECT_FALSE(values.IsShared());
+
+	CowVector<int> copy = values;
+	EXPECT_TRUE(values.IsShared());
+	EXPECT_TRUE(copy.IsShared());
+	EXPECT_EQ(copy.data(), values.data());
+
+	// Writing to the copy detaches it, the original keeps its values.
+	copy.Write()[0] = 7;
+	EXPECT_FALSE(values.IsShared());
+	EXPECT_FALSE(copy.IsShared());
+	EXPECT_NE(copy.data(), values.data());
+	EXPECT_EQ(values[0], 1);
+	EXPECT_EQ(copy[0], 7);
+	EXPECT_EQ(copy[2], 3);
+
+	// Writing to a vector which is not shared does not copy it.
+	const int* data = values.data();
+	values.Write()[1] = 5;
+	EXPECT_EQ(values.data(), data);
+	EXPECT_EQ(values.Read(), std::vector<int>({ 1, 5, 3 }));
+}
+
+TEST(CowVectorTest, Empty_ShouldReadWithoutAllocation)
+{
+	CowVector<int> values;
+	EXPECT_TRUE(values.empty());
+	EXPECT_EQ(values.size(), 0);
+	EXPECT_EQ(values.begin(), values.end());
+	EXPECT_FALSE(values.IsShared());
+
+	values.Write().push_back(4);
+	const std::vector<int>& readValues = values;
+	EXPECT_EQ(readValues, std::vector<int>({ 4 }));
+}
+
+TEST(CowVectorTest, Write_ShouldNotModifyCopyReadByAnotherThread)
+{
+	std::vector<int> initialValues(1 << 16);
+	std::iota(initialValues.begin(), initialValues.end(), 0);
+	CowVector<int> values{ std::vector<int>(initialValues) };
+
+	const CowVector<int> snapshot = values;
+	long long sum = 0;
+	std::thread reader(
+		[&sum, &snapshot]()
+		{
+			for(int curValue : snapshot)
+				sum += curValue;
+		});
+	std::vector<int>& writtenValues = values.Write();
+	std::ranges::fill(writtenValues, 0);
+	reader.join();
+
+	EXPECT_EQ(sum, std::accumulate(initialValues.begin(), initialValues.end(), 0LL));
+	EXPECT_EQ(snapshot.Read(), initialValues);
+}
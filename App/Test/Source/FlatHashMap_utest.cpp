@@ -0,0 +1,108 @@
+#include "Core/FlatHashMap.h"
+
+#include "Core/BaseType.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+using namespace Core::Container;
+using namespace Core::BaseType;
+
+TEST(FlatHashMapTest, TryEmplaceFind_ShouldStoreValuesWhileGrowing)
+{
+	// Packed edge keys only differ by their high bits, the identity hash of integers is mixed by the table.
+	FlatHashMap<uint64_t, int> map;
+	EXPECT_TRUE(map.IsEmpty());
+	EXPECT_EQ(map.Find(0), nullptr);
+	for(int iKey = 0; iKey < 10000; ++iKey)
+	{
+		const auto [value, isInserted] = map.TryEmplace(static_cast<uint64_t>(iKey) << 32, iKey);
+		EXPECT_TRUE(isInserted);
+		EXPECT_EQ(value, iKey);
+	}
+	EXPECT_EQ(map.GetSize(), 10000);
+	EXPECT_GE(map.GetCapacity() * 7, map.GetSize() * 8);
+
+	const auto [value, isInserted] = map.TryEmplace(uint64_t(5) << 32, -1);
+	EXPECT_FALSE(isInserted);
+	EXPECT_EQ(value, 5);
+	map[uint64_t(5) << 32] = 50;
+	EXPECT_EQ(map[uint64_t(6)], 0);
+
+	const FlatHashMap<uint64_t, int>& constMap = map;
+	ASSERT_NE(constMap.Find(uint64_t(5) << 32), nullptr);
+	EXPECT_EQ(*constMap.Find(uint64_t(5) << 32), 50);
+	EXPECT_EQ(*constMap.Find(uint64_t(9999) << 32), 9999);
+	EXPECT_EQ(constMap.Find(uint64_t(10000) << 32), nullptr);
+	EXPECT_EQ(constMap.GetSize(), 10001);
+
+	map.Clear();
+	EXPECT_TRUE(map.IsEmpty());
+	EXPECT_FALSE(map.Contains(0));
+}
+
+TEST(FlatHashMapTest, Erase_ShouldKeepOtherKeysReachable)
+{
+	FlatHashMap<uint32_t, uint32_t> map(1000);
+	const size_t capacity = map.GetCapacity();
+	for(uint32_t iKey = 0; iKey < 1000; ++iKey)
+		map[iKey] = 2 * iKey;
+	EXPECT_EQ(map.GetCapacity(), capacity);
+
+	for(uint32_t iKey = 0; iKey < 1000; iKey += 2)
+		EXPECT_TRUE(map.Erase(iKey));
+	EXPECT_FALSE(map.Erase(0));
+	EXPECT_EQ(map.GetSize(), 500);
+
+	for(uint32_t iKey = 0; iKey < 1000; ++iKey)
+	{
+		const uint32_t* value = map.Find(iKey);
+		if(iKey % 2 == 0)
+			EXPECT_EQ(value, nullptr);
+		else
+			EXPECT_TRUE(value != nullptr && *value == 2 * iKey);
+	}
+
+	size_t keyCount = 0;
+	map.ForEach(
+		[&keyCount](uint32_t key, uint32_t value)
+		{
+			EXPECT_EQ(key % 2, 1);
+			EXPECT_EQ(value, 2 * key);
+			++keyCount;
+		});
+	EXPECT_EQ(keyCount, 500);
+}
+
+TEST(FlatHashMapTest, FlatHashSet_ShouldHashExactFloatBits)
+{
+	FlatHashSet<Vec3> set;
+	EXPECT_TRUE(set.Insert({ 0.f, 1.f, 2.f }));
+	EXPECT_FALSE(set.Insert({ 0.f, 1.f, 2.f }));
+	// -0 and +0 compare equal, so they must be the same key.
+	EXPECT_FALSE(set.Insert({ -0.f, 1.f, 2.f }));
+	EXPECT_TRUE(set.Insert({ 2.f, 1.f, 0.f }));
+	EXPECT_TRUE(set.Contains({ 2.f, 1.f, 0.f }));
+	EXPECT_EQ(set.GetSize(), 2);
+
+	// Symmetric and integer coordinates must not collide.
+	EXPECT_NE(std::hash<Vec3>{}({ 0.f, 1.f, 2.f }), std::hash<Vec3>{}({ 2.f, 1.f, 0.f }));
+	EXPECT_NE(std::hash<Vec2>{}({ 0.25f, 0.f }), std::hash<Vec2>{}({ 0.75f, 0.f }));
+	std::set<size_t> hashes;
+	for(int x = -8; x < 8; ++x)
+	{
+		for(int y = -8; y < 8; ++y)
+		{
+			for(int z = -8; z < 8; ++z)
+			{
+				const Vec3 position(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+				hashes.insert(std::hash<Vec3>{}(position));
+			}
+		}
+	}
+	EXPECT_EQ(hashes.size(), 16 * 16 * 16);
+
+	EXPECT_EQ(Core::Hash::HashEdge(3, 7), Core::Hash::HashEdge(7, 3));
+	EXPECT_NE(Core::Hash::HashEdge(3, 7), Core::Hash::HashEdge(2, 6));
+}
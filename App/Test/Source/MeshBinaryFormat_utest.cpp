@@ -0,0 +1,207 @@
+#include "Application/MeshBinaryFormat.h"
+
+#include "Application/ExtraDataType.h"
+#include "Application/MeshExporter.h"
+#include "Application/MeshLoader.h"
+#include "Application/PrimitiveProxy.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Data::ExtraData;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Check that two meshes have the same vertices and triangles.
+void ExpectSameConnectivity(const Mesh& lhs, const Mesh& rhs)
+{
+	ASSERT_EQ(lhs.GetVertexCount(), rhs.GetVertexCount());
+	ASSERT_EQ(lhs.GetTriangleCount(), rhs.GetTriangleCount());
+
+	for(VertexIndex iVertex = 0; iVertex < lhs.GetVertexCount(); ++iVertex)
+	{
+		EXPECT_EQ(lhs.GetVertexData(iVertex).Position, rhs.GetVertexData(iVertex).Position);
+		EXPECT_EQ(lhs.GetVertexData(iVertex).IncidentTriangleIdx, rhs.GetVertexData(iVertex).IncidentTriangleIdx);
+	}
+
+	for(TriangleIndex iTriangle = 0; iTriangle < lhs.GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(lhs.GetTriangleData(iTriangle).Vertices, rhs.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(lhs.GetTriangleData(iTriangle).Neighbors, rhs.GetTriangleData(iTriangle).Neighbors);
+	}
+}
+} // namespace
+
+TEST(MeshBinaryFormatTest, ExportBinary_LoadBinary_ShouldRoundTrip)
+{
+	Mesh mesh = TestHelpers::CreateValidMeshWithED();
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/validMeshWithED.mtbmesh");
+	MeshExporter::ExportBinary(mesh, filepath);
+
+	std::unique_ptr<Mesh> loadedMesh = MeshLoader::LoadBinary(filepath);
+	ASSERT_NE(loadedMesh, nullptr);
+	ExpectSameConnectivity(mesh, *loadedMesh);
+	ASSERT_TRUE(loadedMesh->HasNeighborEdgeSlots());
+	EXPECT_EQ(loadedMesh->GetNeighborEdgeSlots()[0].Get(1), 2);
+	EXPECT_EQ(loadedMesh->GetNeighborEdgeSlots()[1].Get(2), 1);
+
+	// The edge table is not stored, it is built with the connectivity (two triangles sharing an edge).
+	EXPECT_FALSE(loadedMesh->HasEdges());
+	loadedMesh->UpdateMeshConnectivity();
+	ASSERT_TRUE(loadedMesh->HasEdges());
+	EXPECT_EQ(loadedMesh->GetEdgeCount(), 5u);
+
+	// Triangle extra data should be restored.
+	ASSERT_TRUE(loadedMesh->HasTrianglesExtraDataContainer());
+	EXPECT_FALSE(loadedMesh->HasVerticesExtraDataContainer());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const TriangleProxy expectedTriangle = mesh.GetTriangle(iTriangle);
+		const TriangleProxy loadedTriangle = loadedMesh->GetTriangle(iTriangle);
+
+		const auto* normal = loadedTriangle.GetExtraData<TriangleNormalExtraData>();
+		const auto* texCoords = loadedTriangle.GetExtraData<VerticesTexCoordsExtraData>();
+		ASSERT_NE(normal, nullptr);
+		ASSERT_NE(texCoords, nullptr);
+		EXPECT_EQ(normal->GetData(), expectedTriangle.GetExtraData<TriangleNormalExtraData>()->GetData());
+		EXPECT_EQ(texCoords->GetData(), expectedTriangle.GetExtraData<VerticesTexCoordsExtraData>()->GetData());
+	}
+}
+
+TEST(MeshBinaryFormatTest, ExportBinary_LoadBinary_LoadedMeshShouldRoundTrip)
+{
+	std::unique_ptr<Mesh> mesh = MeshLoader::LoadOFF(std::filesystem::relative("TestFiles/Off/cube.off"));
+	ASSERT_NE(mesh, nullptr);
+	mesh->ComputeSmoothVertexNormals(true);
+
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/cube.mtbmesh");
+	MeshExporter::ExportBinary(*mesh, filepath);
+
+	LoadStatistics statistics;
+	std::unique_ptr<Mesh> loadedMesh = MeshLoader::LoadBinary(filepath, &statistics);
+	ASSERT_NE(loadedMesh, nullptr);
+	ExpectSameConnectivity(*mesh, *loadedMesh);
+	EXPECT_EQ(statistics.ByteCount, std::filesystem::file_size(filepath));
+
+	// Smooth vertex normals should be restored.
+	ASSERT_TRUE(loadedMesh->HasVerticesExtraDataContainer());
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+	{
+		const auto* normal = loadedMesh->GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>();
+		ASSERT_NE(normal, nullptr);
+		EXPECT_EQ(normal->GetData(), mesh->GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData());
+	}
+}
+
+TEST(MeshBinaryFormatTest, BinaryMeshView_ShouldExposeArraysInPlace)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(3, 2);
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/gridMesh.mtbmesh");
+	MeshExporter::ExportBinary(mesh, filepath);
+
+	std::unique_ptr<BinaryMeshView> view = BinaryMeshView::Open(filepath);
+	ASSERT_NE(view, nullptr);
+	EXPECT_EQ(view->GetVertexCount(), mesh.GetVertexCount());
+	EXPECT_EQ(view->GetTriangleCount(), mesh.GetTriangleCount());
+	EXPECT_EQ(view->GetFileSize(), std::filesystem::file_size(filepath));
+
+	// Arrays should be aligned for direct use.
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(view->GetVertices().data()) % BinaryFormat::ChunkAlignment, 0);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(view->GetTriangles().data()) % BinaryFormat::ChunkAlignment, 0);
+
+	ASSERT_EQ(view->GetVertices().size(), mesh.GetVertexCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		EXPECT_EQ(view->GetVertices()[iVertex].Position, mesh.GetVertexData(iVertex).Position);
+		EXPECT_EQ(view->GetVertices()[iVertex].IncidentTriangleIdx, mesh.GetVertexData(iVertex).IncidentTriangleIdx);
+	}
+
+	ASSERT_EQ(view->GetTriangles().size(), mesh.GetTriangleCount());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(view->GetTriangles()[iTriangle].Vertices, mesh.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(view->GetTriangles()[iTriangle].Neighbors, mesh.GetTriangleData(iTriangle).Neighbors);
+	}
+
+	// No extra data has been exported.
+	EXPECT_TRUE(view->GetTriangleNormals().empty());
+	EXPECT_TRUE(view->GetTriangleTexCoords().empty());
+	EXPECT_TRUE(view->GetSmoothVertexNormals().empty());
+}
+
+TEST(MeshBinaryFormatTest, LoadBinary_InvalidFile_ShouldReturnNullptr)
+{
+	// Missing file.
+	EXPECT_EQ(MeshLoader::LoadBinary(std::filesystem::relative("TestFiles/missing.mtbmesh")), nullptr);
+
+	// Text file.
+	EXPECT_EQ(MeshLoader::LoadBinary(std::filesystem::relative("TestFiles/Off/cube.off")), nullptr);
+
+	// Truncated file.
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/truncated.mtbmesh");
+	MeshExporter::ExportBinary(mesh, filepath);
+	std::filesystem::resize_file(filepath, std::filesystem::file_size(filepath) - 1);
+	EXPECT_EQ(MeshLoader::LoadBinary(filepath), nullptr);
+	EXPECT_EQ(BinaryMeshView::Open(filepath), nullptr);
+}
+
+TEST(MeshBinaryFormatTest, LoadBinary_OutOfRangeIndex_ShouldReturnNullptr)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/corrupted.mtbmesh");
+
+	// Corrupt one index of the triangle chunk in place.
+	auto CorruptTriangle = [&](auto&& corrupt)
+	{
+		MeshExporter::ExportBinary(mesh, filepath);
+		std::fstream file(filepath, std::ios::binary | std::ios::in | std::ios::out);
+		BinaryFormat::FileHeader header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		for(uint32_t iChunk = 0; iChunk < header.ChunkCount; ++iChunk)
+		{
+			BinaryFormat::ChunkEntry chunk;
+			file.seekg(static_cast<std::streamoff>(header.ChunkTableOffset + iChunk * sizeof(chunk)));
+			file.read(reinterpret_cast<char*>(&chunk), sizeof(chunk));
+			if(chunk.Type != BinaryFormat::ChunkType::Triangles)
+				continue;
+
+			Triangle triangle;
+			file.seekg(static_cast<std::streamoff>(chunk.Offset));
+			file.read(reinterpret_cast<char*>(&triangle), sizeof(triangle));
+			corrupt(triangle);
+			file.seekp(static_cast<std::streamoff>(chunk.Offset));
+			file.write(reinterpret_cast<const char*>(&triangle), sizeof(triangle));
+		}
+	};
+
+	CorruptTriangle(
+		[&mesh](Triangle& triangle)
+		{
+			triangle.Vertices[1] = static_cast<int>(mesh.GetVertexCount());
+		});
+	EXPECT_EQ(BinaryMeshView::Open(filepath), nullptr);
+	CorruptTriangle(
+		[](Triangle& triangle)
+		{
+			triangle.Vertices[2] = -1;
+		});
+	EXPECT_EQ(MeshLoader::LoadBinary(filepath), nullptr);
+	CorruptTriangle(
+		[&mesh](Triangle& triangle)
+		{
+			triangle.Neighbors[0] = static_cast<int>(mesh.GetTriangleCount());
+		});
+	EXPECT_EQ(MeshLoader::LoadBinary(filepath), nullptr);
+
+	// A valid file is still loaded.
+	CorruptTriangle([](Triangle&) {});
+	EXPECT_NE(MeshLoader::LoadBinary(filepath), nullptr);
+}
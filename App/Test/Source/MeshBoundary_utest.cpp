@@ -0,0 +1,113 @@
+#include "Application/MeshBoundary.h"
+
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Copy a mesh without some of its triangles, and rebuild its connectivity.
+Mesh RemoveTriangles(const Mesh& mesh, const std::vector<TriangleIndex>& removedTriangles)
+{
+	Mesh result;
+	for(const Vertex& curVertex : mesh.GetVertices())
+		result.AddVertex({ .Position = curVertex.Position });
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		if(std::ranges::find(removedTriangles, iTriangle) == removedTriangles.end())
+			result.AddTriangle({ .Vertices = mesh.GetTriangleData(iTriangle).Vertices });
+	}
+	result.UpdateMeshConnectivity();
+	return result;
+}
+
+/// @brief Get the vertices of a loop, sorted.
+std::vector<VertexIndex> GetSortedLoop(const BoundaryReport& report, size_t loopIdx)
+{
+	std::vector<VertexIndex> loop(report.GetLoop(loopIdx).begin(), report.GetLoop(loopIdx).end());
+	std::ranges::sort(loop);
+	return loop;
+}
+} // namespace
+
+TEST(MeshBoundaryTest, Analyze_GridMesh_ShouldExtractOrderedOuterLoop)
+{
+	const Mesh mesh = TestHelpers::CreateGridMesh(3, 2);
+	const BoundaryReport report = MeshBoundary::Analyze(mesh);
+
+	// A 3x2 grid has 2 * (3 + 2) boundary edges, and only the vertices 4 and 7 are interior.
+	EXPECT_EQ(report.BoundaryEdges.Count(), 10);
+	EXPECT_EQ(report.BoundaryVertices.Count(), 10);
+	EXPECT_FALSE(report.IsBoundaryVertex(4));
+	EXPECT_FALSE(report.IsBoundaryVertex(7));
+	EXPECT_TRUE(report.IsBoundaryEdge(0, 2));
+	EXPECT_FALSE(report.IsBoundaryEdge(0, 1));
+
+	// The loop follows the orientation of the triangles (counter-clockwise), from the first boundary edge.
+	ASSERT_EQ(report.GetLoopCount(), 1);
+	const std::vector<VertexIndex> expectedLoop{ 0, 1, 2, 5, 8, 11, 10, 9, 6, 3 };
+	EXPECT_TRUE(std::ranges::equal(report.GetLoop(0), expectedLoop));
+}
+
+TEST(MeshBoundaryTest, Analyze_MeshWithHole_ShouldExtractEachLoop)
+{
+	// Remove the two triangles of the center quad of a 3x3 grid (vertices 5, 6, 9 and 10).
+	const Mesh mesh = RemoveTriangles(TestHelpers::CreateGridMesh(3, 3), { 8, 9 });
+	const BoundaryReport report = MeshBoundary::Analyze(mesh);
+
+	EXPECT_EQ(report.BoundaryEdges.Count(), 12 + 4);
+	EXPECT_EQ(report.BoundaryVertices.Count(), mesh.GetVertexCount());
+	ASSERT_EQ(report.GetLoopCount(), 2);
+	EXPECT_EQ(report.GetLoop(0).size(), 12);
+	EXPECT_EQ(GetSortedLoop(report, 1), (std::vector<VertexIndex>{ 5, 6, 9, 10 }));
+	EXPECT_EQ(report.LoopOffsets, (std::vector<uint32_t>{ 0, 12, 16 }));
+}
+
+TEST(MeshBoundaryTest, Analyze_TrianglesSharingVertex_ShouldExtractOneLoopPerFan)
+{
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 1.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 0.f, 1.f, 0.f } });
+	mesh.AddVertex({ .Position = { -1.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 0.f, -1.f, 0.f } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 0, 3, 4 } });
+	mesh.UpdateMeshConnectivity();
+
+	const BoundaryReport report = MeshBoundary::Analyze(mesh);
+	ASSERT_EQ(report.GetLoopCount(), 2);
+	EXPECT_EQ(GetSortedLoop(report, 0), (std::vector<VertexIndex>{ 0, 1, 2 }));
+	EXPECT_EQ(GetSortedLoop(report, 1), (std::vector<VertexIndex>{ 0, 3, 4 }));
+}
+
+TEST(MeshBoundaryTest, Analyze_ClosedMesh_ShouldHaveNoBoundary)
+{
+	const Mesh mesh = TestHelpers::CreateIcosphereMesh(2);
+	const BoundaryReport report = MeshBoundary::Analyze(mesh);
+	EXPECT_EQ(report.BoundaryEdges.Count(), 0);
+	EXPECT_EQ(report.BoundaryVertices.Count(), 0);
+	EXPECT_EQ(report.GetLoopCount(), 0);
+}
+
+TEST(MeshBoundaryTest, Analyze_ShouldNotDependOnThreadCount)
+{
+	const Mesh mesh = TestHelpers::CreateGridMesh(100, 80);
+	const BoundaryReport sequentialReport = MeshBoundary::Analyze(mesh, true, 1);
+	const BoundaryReport parallelReport = MeshBoundary::Analyze(mesh, true, 4);
+
+	EXPECT_TRUE(std::ranges::equal(sequentialReport.BoundaryEdges.GetWords(), parallelReport.BoundaryEdges.GetWords()));
+	EXPECT_TRUE(
+		std::ranges::equal(sequentialReport.BoundaryVertices.GetWords(), parallelReport.BoundaryVertices.GetWords()));
+	EXPECT_EQ(sequentialReport.LoopVertices, parallelReport.LoopVertices);
+	EXPECT_EQ(parallelReport.BoundaryEdges.Count(), 2 * (100 + 80));
+	ASSERT_EQ(parallelReport.GetLoopCount(), 1);
+	EXPECT_EQ(parallelReport.GetLoop(0).size(), 2 * (100 + 80));
+}
@@ -129,3 +129,43 @@ TEST(MeshCirculatorTest, GetFacesAroundVertex_CirculatorWithClosedRing_ShouldIte
 	std::vector<TriangleIndex> expectedFaces = { 0, 3, 6, 7, 4, 1 };
 	EXPECT_EQ(collectedFaces, expectedFaces);
 }
+
+TEST(MeshCirculatorTest, Circulators_WithNeighborEdgeSlots_ShouldMatchVertexSearch)
+{
+	// A grid with a hole, so that some one-rings are opened inside the mesh.
+	Mesh mesh;
+	const Mesh gridMesh = TestHelpers::CreateGridMesh(4, 4);
+	for(const Vertex& curVertex : gridMesh.GetVertices())
+		mesh.AddVertex({ .Position = curVertex.Position });
+	for(TriangleIndex iTriangle = 0; iTriangle < gridMesh.GetTriangleCount(); ++iTriangle)
+	{
+		if(iTriangle != 12 && iTriangle != 13)
+			mesh.AddTriangle({ .Vertices = gridMesh.GetTriangleData(iTriangle).Vertices });
+	}
+	mesh.UpdateMeshConnectivity();
+	ASSERT_TRUE(mesh.HasNeighborEdgeSlots());
+
+	// Dropping the slots makes the circulators search the central vertex in each triangle.
+	Mesh searchMesh = mesh;
+	searchMesh.EditTriangles();
+	ASSERT_FALSE(searchMesh.HasNeighborEdgeSlots());
+
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		std::vector<VertexIndex> vertices;
+		std::vector<VertexIndex> expectedVertices;
+		for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+			vertices.push_back(curVertexIdx);
+		for(VertexIndex curVertexIdx : searchMesh.GetVerticesAroundVertex(iVertex))
+			expectedVertices.push_back(curVertexIdx);
+		EXPECT_EQ(vertices, expectedVertices);
+
+		std::vector<TriangleIndex> triangles;
+		std::vector<TriangleIndex> expectedTriangles;
+		for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertex(iVertex))
+			triangles.push_back(curTriangleIdx);
+		for(TriangleIndex curTriangleIdx : searchMesh.GetTrianglesAroundVertex(iVertex))
+			expectedTriangles.push_back(curTriangleIdx);
+		EXPECT_EQ(triangles, expectedTriangles);
+	}
+}
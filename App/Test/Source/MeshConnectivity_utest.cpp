@@ -0,0 +1,252 @@
+#include "Application/MeshConnectivity.h"
+
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshLoader.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+
+TEST(MeshConnectivityTest, Build_GridMesh_ShouldSetNeighborsAndIncidentTriangles)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(3, 2);
+
+	// Reset the connectivity computed by the helper.
+	for(Triangle& curTriangle : mesh.EditTriangles())
+		curTriangle.Neighbors = { -1, -1, -1 };
+	for(Vertex& curVertex : mesh.GetVertices())
+		curVertex.IncidentTriangleIdx = -1;
+
+	const ConnectivityReport report = MeshConnectivity::Build(mesh);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_TRUE(report.IsManifold());
+
+	// A 3x2 grid has 2 * (3 + 2) boundary edges, and V - E + F = 1.
+	EXPECT_EQ(report.BoundaryEdgeCount, 10);
+	EXPECT_EQ(report.InteriorEdgeCount + report.BoundaryEdgeCount, mesh.GetVertexCount() + mesh.GetTriangleCount() - 1);
+
+	// The incident triangle is the first triangle using the vertex.
+	EXPECT_EQ(mesh.GetVertexData(0).IncidentTriangleIdx, 0);
+	EXPECT_EQ(mesh.GetVertexData(4).IncidentTriangleIdx, 0);
+	EXPECT_EQ(mesh.GetVertexData(3).IncidentTriangleIdx, 1);
+}
+
+TEST(MeshConnectivityTest, Build_ClosedMesh_ShouldHaveNoBoundary)
+{
+	std::unique_ptr<Mesh> mesh = MeshLoader::LoadOFF("TestFiles/Off/cube.off");
+	ASSERT_NE(mesh, nullptr);
+
+	const ConnectivityReport report = MeshConnectivity::Build(*mesh);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_TRUE(report.IsManifold());
+	EXPECT_EQ(report.BoundaryEdgeCount, 0);
+	EXPECT_EQ(report.InteriorEdgeCount, 18);
+
+	for(const Triangle& curTriangle : mesh->GetTriangles())
+	{
+		for(int curNeighborIdx : curTriangle.Neighbors)
+			EXPECT_NE(curNeighborIdx, -1);
+	}
+}
+
+TEST(MeshConnectivityTest, Build_NonManifoldEdge_ShouldBeReported)
+{
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 0., 0. } });
+	mesh.AddVertex({ .Position = { 0., 1., 0. } });
+	mesh.AddVertex({ .Position = { 0., -1., 0. } });
+	mesh.AddVertex({ .Position = { 0., 0., 1. } });
+
+	// Three triangles sharing the edge 0-1.
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 1, 0, 3 } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 4 } });
+
+	const ConnectivityReport report = MeshConnectivity::Build(mesh);
+	EXPECT_FALSE(report.IsManifold());
+	ASSERT_EQ(report.NonManifoldEdges.size(), 1);
+	EXPECT_EQ(report.NonManifoldEdges[0], VertexPair(0, 1));
+	EXPECT_EQ(report.BoundaryEdgeCount, 6);
+	EXPECT_EQ(report.InteriorEdgeCount, 0);
+
+	// No triangle is connected across the non-manifold edge.
+	for(const Triangle& curTriangle : mesh.GetTriangles())
+		EXPECT_EQ(curTriangle.Neighbors, (std::array<int, 3>{ -1, -1, -1 }));
+}
+
+TEST(MeshConnectivityTest, Build_SeveralThreads_ShouldMatchSingleThread)
+{
+	Mesh expectedMesh = TestHelpers::CreateGridMesh(100, 120);
+	const ConnectivityReport expectedReport = MeshConnectivity::Build(expectedMesh, 1);
+
+	for(uint32_t threadCount : { 2u, 3u, 8u })
+	{
+		Mesh mesh = expectedMesh;
+		for(Triangle& curTriangle : mesh.EditTriangles())
+			curTriangle.Neighbors = { -1, -1, -1 };
+
+		const ConnectivityReport report = MeshConnectivity::Build(mesh, threadCount);
+		EXPECT_EQ(report.InteriorEdgeCount, expectedReport.InteriorEdgeCount);
+		EXPECT_EQ(report.BoundaryEdgeCount, expectedReport.BoundaryEdgeCount);
+
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+			ASSERT_EQ(mesh.GetVertexData(iVertex).IncidentTriangleIdx,
+					  expectedMesh.GetVertexData(iVertex).IncidentTriangleIdx);
+		for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+			ASSERT_EQ(mesh.GetTriangleData(iTriangle).Neighbors, expectedMesh.GetTriangleData(iTriangle).Neighbors);
+	}
+}
+
+TEST(MeshConnectivityTest, Build_ShouldSetNeighborEdgeSlots)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(4, 3);
+	mesh.UpdateMeshConnectivity();
+	ASSERT_TRUE(mesh.HasNeighborEdgeSlots());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const Triangle& curTriangle = mesh.GetTriangleData(iTriangle);
+		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+		{
+			const EdgeIndex neighborEdgeIdx = mesh.GetNeighborEdgeSlots()[iTriangle].Get(iEdge);
+			if(curTriangle.Neighbors[iEdge] == -1)
+			{
+				EXPECT_EQ(neighborEdgeIdx, NeighborEdgeSlots::NoEdge);
+				continue;
+			}
+
+			// The slot is the edge found by searching the shared vertices in the neighbor.
+			const Triangle& neighbor = mesh.GetTriangleData(curTriangle.Neighbors[iEdge]);
+			const VertexIndex firstVertexIdx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
+			const VertexIndex secondVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+			const int expectedEdgeIdx = Utilitary::Primitive::GetEdgeIndex(neighbor, firstVertexIdx, secondVertexIdx);
+			EXPECT_EQ(neighborEdgeIdx, expectedEdgeIdx);
+			EXPECT_EQ(neighbor.Neighbors[neighborEdgeIdx], static_cast<int>(iTriangle));
+		}
+	}
+
+	// Editing the triangles drops the slots, reading them keeps them.
+	Mesh editedMesh = mesh;
+	EXPECT_TRUE(editedMesh.HasNeighborEdgeSlots());
+	editedMesh.EditTriangles();
+	EXPECT_FALSE(editedMesh.HasNeighborEdgeSlots());
+	Mesh otherEditedMesh = mesh;
+	otherEditedMesh.GetTriangles();
+	otherEditedMesh.GetTriangleData(0);
+	otherEditedMesh.GetTriangle(0).GetTriangle();
+	EXPECT_TRUE(otherEditedMesh.HasNeighborEdgeSlots());
+	otherEditedMesh.SetTriangleData(0, otherEditedMesh.GetTriangleData(0));
+	EXPECT_FALSE(otherEditedMesh.HasNeighborEdgeSlots());
+	Mesh proxyEditedMesh = mesh;
+	proxyEditedMesh.GetTriangle(0).SetTriangle(proxyEditedMesh.GetTriangleData(0));
+	EXPECT_FALSE(proxyEditedMesh.HasNeighborEdgeSlots());
+	mesh.AddTriangle({ .Vertices = { 0, 5, 1 } });
+	EXPECT_FALSE(mesh.HasNeighborEdgeSlots());
+}
+
+TEST(MeshConnectivityTest, BuildNeighborEdgeSlots_ShouldMatchBuild)
+{
+	Mesh mesh = TestHelpers::CreateIcosphereMesh(2);
+	mesh.UpdateMeshConnectivity();
+
+	std::vector<NeighborEdgeSlots> neighborEdgeSlots(mesh.GetTriangleCount());
+	MeshConnectivity::BuildNeighborEdgeSlots(mesh.GetTriangles(), neighborEdgeSlots, 3);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		ASSERT_EQ(neighborEdgeSlots[iTriangle].Packed, mesh.GetNeighborEdgeSlots()[iTriangle].Packed);
+}
+
+TEST(MeshConnectivityTest, Build_InconsistentOrientation_ShouldNotSetNeighborEdgeSlot)
+{
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 0., 0. } });
+	mesh.AddVertex({ .Position = { 0., 1., 0. } });
+	mesh.AddVertex({ .Position = { 0., -1., 0. } });
+
+	// Both triangles use the edge 0-1 in the same direction.
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 3 } });
+	mesh.UpdateMeshConnectivity();
+
+	// The triangles are still neighbors, but their shared edge must be searched.
+	EXPECT_EQ(mesh.GetTriangleData(0).Neighbors[2], 1);
+	EXPECT_EQ(mesh.GetTriangleData(1).Neighbors[2], 0);
+	EXPECT_EQ(mesh.GetNeighborEdgeSlots()[0].Get(2), NeighborEdgeSlots::NoEdge);
+	EXPECT_EQ(mesh.GetNeighborEdgeSlots()[1].Get(2), NeighborEdgeSlots::NoEdge);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshConnectivityTest, Build_ShouldNumberEdgesOfEachTriangle)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(3, 2);
+	ASSERT_TRUE(mesh.HasEdges());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	// V - E + F = 1 for a grid, and the edges are sorted by vertex indices.
+	const std::vector<Edge>& edges = mesh.GetEdges();
+	EXPECT_EQ(mesh.GetEdgeCount(), mesh.GetVertexCount() + mesh.GetTriangleCount() - 1);
+	EXPECT_TRUE(std::ranges::is_sorted(edges, {}, &Edge::Vertices));
+
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const Triangle& curTriangle = mesh.GetTriangleData(iTriangle);
+		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+		{
+			const Edge& curEdge = edges[mesh.GetTriangleEdges()[iTriangle][iEdge]];
+			const int firstVertexIdx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
+			const int secondVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+			const auto [minVertexIdx, maxVertexIdx] = std::minmax(firstVertexIdx, secondVertexIdx);
+			EXPECT_EQ(curEdge.Vertices, (std::array<int, 2>{ minVertexIdx, maxVertexIdx }));
+
+			// The triangle of an edge is the first one containing it.
+			EXPECT_LE(curEdge.TriangleIdx, static_cast<int>(iTriangle));
+		}
+	}
+	for(size_t iEdge = 0; iEdge < edges.size(); ++iEdge)
+		EXPECT_EQ(mesh.GetTriangleEdges()[edges[iEdge].TriangleIdx][edges[iEdge].EdgeIdx], static_cast<int>(iEdge));
+
+	// The table does not depend on the thread count.
+	Mesh largeMesh = TestHelpers::CreateGridMesh(100, 120);
+	Mesh otherMesh = largeMesh;
+	MeshConnectivity::Build(largeMesh, 1);
+	MeshConnectivity::Build(otherMesh, 8);
+	EXPECT_EQ(largeMesh.GetTriangleEdges(), otherMesh.GetTriangleEdges());
+	ASSERT_EQ(largeMesh.GetEdgeCount(), otherMesh.GetEdgeCount());
+	for(uint32_t iEdge = 0; iEdge < largeMesh.GetEdgeCount(); ++iEdge)
+	{
+		EXPECT_EQ(largeMesh.GetEdges()[iEdge].Vertices, otherMesh.GetEdges()[iEdge].Vertices);
+		EXPECT_EQ(largeMesh.GetEdges()[iEdge].TriangleIdx, otherMesh.GetEdges()[iEdge].TriangleIdx);
+		EXPECT_EQ(largeMesh.GetEdges()[iEdge].EdgeIdx, otherMesh.GetEdges()[iEdge].EdgeIdx);
+	}
+}
+
+TEST(MeshConnectivityTest, Build_NonManifoldEdge_ShouldBeSingleEdge)
+{
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 0., 0. } });
+	mesh.AddVertex({ .Position = { 0., 1., 0. } });
+	mesh.AddVertex({ .Position = { 0., -1., 0. } });
+	mesh.AddVertex({ .Position = { 0., 0., 1. } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 1, 0, 3 } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 4 } });
+	MeshConnectivity::Build(mesh);
+
+	// The edge 0-1 (opposite to the last corner) is shared by the three triangles.
+	EXPECT_EQ(mesh.GetEdgeCount(), 7);
+	const int sharedEdgeIdx = mesh.GetTriangleEdges()[0][2];
+	EXPECT_EQ(mesh.GetTriangleEdges()[1][2], sharedEdgeIdx);
+	EXPECT_EQ(mesh.GetTriangleEdges()[2][2], sharedEdgeIdx);
+	EXPECT_EQ(mesh.GetEdges()[sharedEdgeIdx].Vertices, (std::array<int, 2>{ 0, 1 }));
+	EXPECT_EQ(mesh.GetEdges()[sharedEdgeIdx].TriangleIdx, 0);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
@@ -1,5 +1,6 @@
 #include "Application/ExtraDataType.h"
 #include "Application/MeshExporter.h"
+#include "Application/MeshLoader.h"
 #include "Application/PrimitiveProxy.h"
 #include "Application/TestHelpers.h"
 #include "Core/MathHelpers.h"
@@ -7,10 +8,14 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <sstream>
+#include <string>
 #include <string_view>
+#include <vector>
 
 using namespace Core::Math;
 using namespace Utilitary::Surface;
@@ -57,7 +62,7 @@ TEST(MeshExporterTest, ValidMesh_ExportOFFShouldSucceed)
 		{
 			int vertexIdx;
 			file >> vertexIdx;
-			EXPECT_EQ(curVertexIdx + 1, vertexIdx);
+			EXPECT_EQ(curVertexIdx, vertexIdx);
 		}
 	}
 
@@ -113,9 +118,10 @@ TEST(MeshExporterTest, ValidMesh_ExportOBJWithEDShouldSucceed)
 	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/Obj/validMeshWithED.obj");
 	MeshExporter::ExportOBJ(mesh, filepath);
 
+	// Texture coordinates and normals are written in order of first appearance.
 	std::string expectedFileContent =
-		"v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 1\nvt 1 0\nvt 1 1\nvt 0 0\nvn 1 0 0\nf 1/4/1 2/2/1 3/3/1\nf 1/4/1 "
-		"3/3/1 4/1/1\n";
+		"v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\nvn 1 0 0\nf 1/1/1 2/2/1 3/3/1\nf 1/1/1 "
+		"3/3/1 4/4/1\n";
 
 	std::ifstream t(filepath);
 	std::stringstream buffer;
@@ -123,3 +129,109 @@ TEST(MeshExporterTest, ValidMesh_ExportOBJWithEDShouldSucceed)
 
 	EXPECT_EQ(buffer.str(), expectedFileContent);
 }
+
+TEST(MeshExporterTest, GridMesh_ExportOBJShouldWriteSharedTexCoordsOnce)
+{
+	// Each corner gets the texture coordinates of its vertex, shared by up to 6 triangles.
+	Mesh mesh = TestHelpers::CreateGridMesh(20, 30);
+	mesh.AddTrianglesExtraDataContainer();
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		TriangleProxy triangle = mesh.GetTriangle(iTriangle);
+		auto& texCoords = triangle.GetOrCreateExtraData<VerticesTexCoordsExtraData>();
+		for(VertexLocalIndex iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			const Vec3& position = mesh.GetVertexData(mesh.GetTriangleData(iTriangle).Vertices[iCorner]).Position;
+			texCoords.SetVertexTexCoords(Vec2{ position.x, position.y }, iCorner);
+		}
+		triangle.GetOrCreateExtraData<TriangleNormalExtraData>().GetData() = Vec3{ 0., 0., 1. };
+	}
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/Obj/gridMeshWithED.obj");
+	MeshExporter::ExportOBJ(mesh, filepath);
+
+	std::ifstream file(filepath);
+	std::vector<Vec3> positions;
+	std::vector<Vec2> texCoords;
+	int normalCount = 0;
+	int triangleCount = 0;
+	std::string line;
+	while(std::getline(file, line))
+	{
+		std::istringstream lineStream(line);
+		std::string keyword;
+		lineStream >> keyword;
+		if(keyword == "v")
+			lineStream >> positions.emplace_back().x >> positions.back().y >> positions.back().z;
+		else if(keyword == "vt")
+			lineStream >> texCoords.emplace_back().x >> texCoords.back().y;
+		else if(keyword == "vn")
+			++normalCount;
+		else if(keyword == "f")
+		{
+			// The texture coordinates of each corner are the ones of its vertex.
+			for(int iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				int vertexIdx = 0;
+				int texCoordsIdx = 0;
+				int normalIdx = 0;
+				char separator;
+				lineStream >> vertexIdx >> separator >> texCoordsIdx >> separator >> normalIdx;
+				ASSERT_TRUE(texCoordsIdx >= 1 && texCoordsIdx <= static_cast<int>(texCoords.size()));
+				EXPECT_EQ(texCoords[texCoordsIdx - 1].x, positions[vertexIdx - 1].x);
+				EXPECT_EQ(texCoords[texCoordsIdx - 1].y, positions[vertexIdx - 1].y);
+				EXPECT_EQ(normalIdx, 1);
+			}
+			++triangleCount;
+		}
+	}
+
+	EXPECT_EQ(texCoords.size(), mesh.GetVertexCount());
+	EXPECT_EQ(normalCount, 1);
+	EXPECT_EQ(triangleCount, static_cast<int>(mesh.GetTriangleCount()));
+}
+
+TEST(MeshExporterTest, ExportOFFAndOBJ_ShouldNotDependOnThreadCount)
+{
+	// Several blocks of records per thread, with coordinates needing all their digits.
+	Mesh mesh = TestHelpers::CreateGridMesh(150, 150);
+	for(Vertex& curVertex : mesh.GetVertices())
+	{
+		const Vec3 position = curVertex.Position;
+		curVertex.Position = { position.x / 3.f, position.y * 0.1f, -std::sqrt(position.x) };
+	}
+
+	auto ReadFile = [](const std::filesystem::path& filepath)
+	{
+		std::ifstream file(filepath);
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		return buffer.str();
+	};
+	const std::filesystem::path offFilepath = std::filesystem::relative("TestFiles/Off/gridMesh.off");
+	const std::filesystem::path objFilepath = std::filesystem::relative("TestFiles/Obj/gridMesh.obj");
+	MeshExporter::ExportOFF(mesh, offFilepath, 1);
+	MeshExporter::ExportOBJ(mesh, objFilepath, 1);
+	const std::string expectedOFF = ReadFile(offFilepath);
+	const std::string expectedOBJ = ReadFile(objFilepath);
+	for(uint32_t threadCount : { 2u, 8u })
+	{
+		MeshExporter::ExportOFF(mesh, offFilepath, threadCount);
+		MeshExporter::ExportOBJ(mesh, objFilepath, threadCount);
+		EXPECT_EQ(ReadFile(offFilepath), expectedOFF);
+		EXPECT_EQ(ReadFile(objFilepath), expectedOBJ);
+	}
+
+	// The positions and triangles read back are the exported ones.
+	auto ExpectExportedMesh = [&mesh](const std::unique_ptr<Mesh>& loadedMesh)
+	{
+		ASSERT_NE(loadedMesh, nullptr);
+		ASSERT_EQ(loadedMesh->GetVertexCount(), mesh.GetVertexCount());
+		ASSERT_EQ(loadedMesh->GetTriangleCount(), mesh.GetTriangleCount());
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+			ASSERT_EQ(loadedMesh->GetVertexData(iVertex).Position, mesh.GetVertexData(iVertex).Position);
+		for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+			ASSERT_EQ(loadedMesh->GetTriangleData(iTriangle).Vertices, mesh.GetTriangleData(iTriangle).Vertices);
+	};
+	ExpectExportedMesh(MeshLoader::LoadOFF(offFilepath));
+	ExpectExportedMesh(MeshLoader::LoadOBJ(objFilepath));
+}
@@ -34,7 +34,9 @@ TEST(MeshIntegrityTest, InvalidMesh_ShouldReturnVertexNotInFace)
 	Mesh mesh = TestHelpers::CreateValidMesh();
 
 	// Invalidate the first vertex by setting its incident triangle to a triangle that doesn't contain it.
-	mesh.GetTriangleData(0).Vertices[0] = 3;
+	Data::Primitive::Triangle invalidTriangle = mesh.GetTriangleData(0);
+	invalidTriangle.Vertices[0] = 3;
+	mesh.SetTriangleData(0, invalidTriangle);
 
 	EXPECT_EQ(mesh.GetVertexCount(), 4);
 	EXPECT_EQ(mesh.GetTriangleCount(), 2);
@@ -60,7 +62,9 @@ TEST(MeshIntegrityTest, InvalidMesh_ShouldReturnTriangleNeighborNotReciprocal)
 	Mesh mesh = TestHelpers::CreateValidMesh();
 
 	// Invalidate the neighbor relationship between the two triangles.
-	mesh.GetTriangleData(0).Neighbors[1] = -1;
+	Data::Primitive::Triangle invalidTriangle = mesh.GetTriangleData(0);
+	invalidTriangle.Neighbors[1] = -1;
+	mesh.SetTriangleData(0, invalidTriangle);
 
 	EXPECT_EQ(mesh.GetVertexCount(), 4);
 	EXPECT_EQ(mesh.GetTriangleCount(), 2);
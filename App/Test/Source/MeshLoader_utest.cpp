@@ -2,10 +2,16 @@
 #include "Application/MeshIntegrity.h"
 #include "Application/MeshLoader.h"
 #include "Application/PrimitiveProxy.h"
+#include "Application/TestHelpers.h"
 #include "Core/MathHelpers.h"
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
 using namespace Utilitary::Surface;
 using namespace Data::ExtraData;
 using namespace Data::Primitive;
@@ -13,6 +19,50 @@ using namespace Data::Surface;
 using namespace Core::Math::Compare;
 using namespace Core::BaseType;
 
+namespace
+{
+/// @brief Write the triangles of a mesh as a binary STL file (triangle soup with zero normals).
+/// @param header Content of the 80-byte header.
+void WriteBinarySTL(const Mesh& mesh, const std::filesystem::path& filepath, const std::string& header)
+{
+	std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+
+	std::string headerBytes = header;
+	headerBytes.resize(80, ' ');
+	file.write(headerBytes.data(), 80);
+
+	const auto facetCount = static_cast<uint32_t>(mesh.GetTriangleCount());
+	file.write(reinterpret_cast<const char*>(&facetCount), sizeof(uint32_t));
+
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		std::array<float, 12> facet{};
+		for(int iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			const Vec3& position = mesh.GetVertexData(mesh.GetTriangleData(iTriangle).Vertices[iCorner]).Position;
+			std::memcpy(&facet[3 + 3 * iCorner], &position, sizeof(Vec3));
+		}
+		const uint16_t attributeByteCount = 0;
+		file.write(reinterpret_cast<const char*>(facet.data()), sizeof(facet));
+		file.write(reinterpret_cast<const char*>(&attributeByteCount), sizeof(uint16_t));
+	}
+}
+
+/// @brief Check that the triangles of two meshes have the same corner positions.
+void ExpectSameTrianglePositions(const Mesh& lhs, const Mesh& rhs)
+{
+	ASSERT_EQ(lhs.GetTriangleCount(), rhs.GetTriangleCount());
+	for(TriangleIndex iTriangle = 0; iTriangle < lhs.GetTriangleCount(); ++iTriangle)
+	{
+		for(int iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			EXPECT_EQ(lhs.GetVertexData(lhs.GetTriangleData(iTriangle).Vertices[iCorner]).Position,
+					  rhs.GetVertexData(rhs.GetTriangleData(iTriangle).Vertices[iCorner]).Position);
+		}
+	}
+}
+} // namespace
+
 TEST(MeshLoaderTest, LoadOFF_ValidFile_ShouldLoadMesh)
 {
 	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFF("TestFiles/Off/cube.off");
@@ -37,6 +87,97 @@ TEST(MeshLoaderTest, LoadOFF_InvalidFile_ShouldReturnNullptr)
 	}
 }
 
+TEST(MeshLoaderTest, LoadOFFMapped_ValidFile_ShouldLoadMesh)
+{
+	LoadStatistics statistics;
+	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFFMapped("TestFiles/Off/cube.off", &statistics);
+	ASSERT_NE(mesh, nullptr);
+
+	EXPECT_EQ(mesh->GetVertexCount(), 8);
+	EXPECT_EQ(mesh->GetTriangleCount(), 12);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	// The whole file has been read.
+	EXPECT_EQ(statistics.ByteCount, std::filesystem::file_size("TestFiles/Off/cube.off"));
+	EXPECT_GE(statistics.GetThroughput(), 0.);
+
+	// The smallest records, without a final newline, fit the counts of the header.
+	const std::filesystem::path filepath = "TestFiles/Off/minimal.off";
+	std::ofstream file(filepath, std::ios::trunc);
+	file << "OFF\n3 1 0\n0 0 0\n1 0 0\n0 1 0\n3 0 1 2";
+	file.close();
+	std::unique_ptr<Data::Surface::Mesh> minimalMesh = MeshLoader::LoadOFFMapped(filepath);
+	ASSERT_NE(minimalMesh, nullptr);
+	EXPECT_EQ(minimalMesh->GetTriangleCount(), 1);
+}
+
+TEST(MeshLoaderTest, LoadOFFMapped_ValidFile_ShouldMatchLoadOFF)
+{
+	std::unique_ptr<Data::Surface::Mesh> expectedMesh = MeshLoader::LoadOFF("TestFiles/Off/cube.off");
+	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFFMapped("TestFiles/Off/cube.off");
+	ASSERT_NE(expectedMesh, nullptr);
+	ASSERT_NE(mesh, nullptr);
+
+	ASSERT_EQ(mesh->GetVertexCount(), expectedMesh->GetVertexCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+	{
+		EXPECT_EQ(mesh->GetVertexData(iVertex).Position, expectedMesh->GetVertexData(iVertex).Position);
+		EXPECT_EQ(
+			mesh->GetVertexData(iVertex).IncidentTriangleIdx, expectedMesh->GetVertexData(iVertex).IncidentTriangleIdx);
+	}
+
+	ASSERT_EQ(mesh->GetTriangleCount(), expectedMesh->GetTriangleCount());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(mesh->GetTriangleData(iTriangle).Vertices, expectedMesh->GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(mesh->GetTriangleData(iTriangle).Neighbors, expectedMesh->GetTriangleData(iTriangle).Neighbors);
+	}
+}
+
+TEST(MeshLoaderTest, LoadOFFMapped_InvalidFile_ShouldReturnNullptr)
+{
+	{ // Wrong file extension.
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFFMapped("TestFiles/Obj/cube.obj");
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Can't open file.
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFFMapped("TestFiles/Off/notAFile.off");
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Non triangular face.
+		const std::filesystem::path filepath = "TestFiles/Off/quad.off";
+		std::ofstream file(filepath, std::ios::trunc);
+		file << "OFF\n4 1 0\n0 0 0\n1 0 0\n1 1 0\n0 1 0\n4 0 1 2 3\n";
+		file.close();
+
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFFMapped(filepath);
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Vertex index out of bound.
+		const std::filesystem::path filepath = "TestFiles/Off/outOfBound.off";
+		std::ofstream file(filepath, std::ios::trunc);
+		file << "OFF\n3 1 0\n0 0 0\n1 0 0\n1 1 0\n3 0 1 3\n";
+		file.close();
+
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFFMapped(filepath);
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Counts too large for the file, rejected before allocating the arrays.
+		const std::filesystem::path filepath = "TestFiles/Off/hugeCounts.off";
+		std::ofstream file(filepath, std::ios::trunc);
+		file << "OFF\n2000000000 2000000000 0\n0 0 0\n";
+		file.close();
+
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOFFMapped(filepath);
+		EXPECT_EQ(mesh, nullptr);
+	}
+}
+
 TEST(MeshLoaderTest, LoadOBJ_ValidFile_ShouldLoadMesh)
 {
 	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJ("TestFiles/Obj/cube.obj");
@@ -58,6 +199,129 @@ TEST(MeshLoaderTest, LoadOBJ_InvalidFile_ShouldReturnNullptr)
 	}
 }
 
+TEST(MeshLoaderTest, LoadOBJ_PositionOnlyFaces_ShouldBeLoaded)
+{
+	const std::filesystem::path filepath = "TestFiles/Obj/positionOnly.obj";
+	std::ofstream file(filepath, std::ios::trunc);
+	file << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nf 1 2 3\nf 1 3 4\n";
+	file.close();
+
+	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJ(filepath);
+	ASSERT_NE(mesh, nullptr);
+	EXPECT_EQ(mesh->GetVertexCount(), 4);
+	ASSERT_EQ(mesh->GetTriangleCount(), 2);
+	EXPECT_EQ(mesh->GetTriangleData(0).Vertices, (std::array<int, 3>{ 0, 1, 2 }));
+	EXPECT_EQ(mesh->GetTriangleData(1).Vertices, (std::array<int, 3>{ 0, 2, 3 }));
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshLoaderTest, LoadOBJParallel_ValidFiles_ShouldMatchLoadOBJ)
+{
+	const std::vector<std::filesystem::path> filepaths = { "TestFiles/Obj/cube.obj",
+														   "TestFiles/Obj/cube_vt.obj",
+														   "TestFiles/Obj/cube_vn.obj",
+														   "TestFiles/Obj/cube_vtvn.obj" };
+
+	for(auto&& filepath : filepaths)
+	{
+		std::unique_ptr<Mesh> expectedMesh = MeshLoader::LoadOBJ(filepath);
+		ASSERT_NE(expectedMesh, nullptr);
+
+		// Use more chunks than lines in some sections to exercise the chunk boundaries.
+		for(uint32_t threadCount : { 0u, 1u, 2u, 3u, 8u, 64u })
+		{
+			std::unique_ptr<Mesh> mesh = MeshLoader::LoadOBJParallel(filepath, threadCount);
+			ASSERT_NE(mesh, nullptr);
+			EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+
+			ASSERT_EQ(mesh->GetVertexCount(), expectedMesh->GetVertexCount());
+			for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+				EXPECT_EQ(mesh->GetVertexData(iVertex).Position, expectedMesh->GetVertexData(iVertex).Position);
+
+			ASSERT_EQ(mesh->GetTriangleCount(), expectedMesh->GetTriangleCount());
+			for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+			{
+				const TriangleProxy& triangle = mesh->GetTriangle(iTriangle);
+				const TriangleProxy& expectedTriangle = expectedMesh->GetTriangle(iTriangle);
+				EXPECT_EQ(triangle.GetVertices(), expectedTriangle.GetVertices());
+				EXPECT_EQ(triangle.GetNeighbors(), expectedTriangle.GetNeighbors());
+
+				auto verticesTexCoords = triangle.GetExtraData<VerticesTexCoordsExtraData>();
+				auto expectedVerticesTexCoords = expectedTriangle.GetExtraData<VerticesTexCoordsExtraData>();
+				ASSERT_EQ(verticesTexCoords == nullptr, expectedVerticesTexCoords == nullptr);
+				if(verticesTexCoords != nullptr)
+				{
+					EXPECT_EQ(verticesTexCoords->GetData(), expectedVerticesTexCoords->GetData());
+				}
+
+				auto triangleNormal = triangle.GetExtraData<TriangleNormalExtraData>();
+				auto expectedTriangleNormal = expectedTriangle.GetExtraData<TriangleNormalExtraData>();
+				ASSERT_EQ(triangleNormal == nullptr, expectedTriangleNormal == nullptr);
+				if(triangleNormal != nullptr)
+				{
+					EXPECT_EQ(triangleNormal->GetData(), expectedTriangleNormal->GetData());
+				}
+			}
+		}
+	}
+}
+
+TEST(MeshLoaderTest, LoadOBJParallel_RelativeIndicesAndPolygons_ShouldBeResolved)
+{
+	// A quad using relative indices, followed by a triangle using absolute indices. Each record is followed by a
+	// comment of 1 MiB (the minimal chunk size), so that the records are split across the chunks.
+	const std::filesystem::path filepath = "TestFiles/Obj/relativeQuad.obj";
+	const std::vector<std::string> records = { "v 0 0 0", "v 1 0 0", "v 1 1 0", "v 0 1 0", "vt 0 0", "vt 1 0",
+											   "vt 1 1", "vt 0 1", "f -4/-4 -3/-3 -2/-2 -1/-1", "v 2 0 0",
+											   "f 2/2 5/2 3/3" };
+	const std::string comment = "#" + std::string(size_t(1) << 20, 'x');
+	std::ofstream file(filepath, std::ios::trunc);
+	for(const std::string& curRecord : records)
+		file << curRecord << '\n' << comment << '\n';
+	file.close();
+
+	for(uint32_t threadCount : { 1u, 2u, 4u, 16u })
+	{
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadOBJParallel(filepath, threadCount);
+		ASSERT_NE(mesh, nullptr);
+		ASSERT_EQ(mesh->GetVertexCount(), 5);
+		ASSERT_EQ(mesh->GetTriangleCount(), 3);
+		EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+
+		// The quad is triangulated as a fan.
+		EXPECT_EQ(mesh->GetTriangleData(0).Vertices, (std::array<int, 3>{ 0, 1, 2 }));
+		EXPECT_EQ(mesh->GetTriangleData(1).Vertices, (std::array<int, 3>{ 0, 2, 3 }));
+		EXPECT_EQ(mesh->GetTriangleData(2).Vertices, (std::array<int, 3>{ 1, 4, 2 }));
+
+		auto verticesTexCoords = mesh->GetTriangle(1).GetExtraData<VerticesTexCoordsExtraData>();
+		ASSERT_NE(verticesTexCoords, nullptr);
+		EXPECT_EQ(verticesTexCoords->GetVertexTexCoords(2), (Vec2{ 0., 1. }));
+	}
+}
+
+TEST(MeshLoaderTest, LoadOBJParallel_InvalidFile_ShouldReturnNullptr)
+{
+	{ // Wrong file extension.
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJParallel("TestFiles/Off/cube.off");
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Can't open file.
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJParallel("TestFiles/Obj/notAFile.obj");
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Vertex index out of bound.
+		const std::filesystem::path filepath = "TestFiles/Obj/outOfBound.obj";
+		std::ofstream file(filepath, std::ios::trunc);
+		file << "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 4\n";
+		file.close();
+
+		std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJParallel(filepath, 2);
+		EXPECT_EQ(mesh, nullptr);
+	}
+}
+
 TEST(MeshLoaderTest, LoadOBJ_OBJWithVtAndVn_ShouldBeCorrect)
 {
 	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJ("TestFiles/Obj/cube_vtvn.obj");
@@ -353,3 +617,96 @@ TEST(MeshLoaderTest, LoadOBJ_OBJWithoutVt_ShouldBeLoaded)
 		EXPECT_TRUE(EqualNear(triangleNormal->GetData(), Vec3{ -1.0, 0.0, 0.0 }));
 	}
 }
+
+TEST(MeshLoaderTest, LoadSTL_AsciiFile_ShouldWeldVertices)
+{
+	LoadStatistics statistics;
+	std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL("TestFiles/Stl/cube.stl", &statistics);
+	ASSERT_NE(mesh, nullptr);
+	EXPECT_EQ(mesh->GetVertexCount(), 8);
+	EXPECT_EQ(mesh->GetTriangleCount(), 12);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_EQ(statistics.ByteCount, std::filesystem::file_size("TestFiles/Stl/cube.stl"));
+
+	// Facets are listed in the same order as the faces of the OFF cube.
+	std::unique_ptr<Mesh> offMesh = MeshLoader::LoadOFF("TestFiles/Off/cube.off");
+	ASSERT_NE(offMesh, nullptr);
+	ExpectSameTrianglePositions(*mesh, *offMesh);
+}
+
+TEST(MeshLoaderTest, LoadSTL_BinaryFile_ShouldWeldVertices)
+{
+	{ // Binary header starting with "solid", as written by some exporters.
+		std::unique_ptr<Mesh> offMesh = MeshLoader::LoadOFF("TestFiles/Off/cube.off");
+		ASSERT_NE(offMesh, nullptr);
+		const std::filesystem::path filepath = "TestFiles/Stl/cubeBinary.stl";
+		WriteBinarySTL(*offMesh, filepath, "solid cube");
+
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL(filepath);
+		ASSERT_NE(mesh, nullptr);
+		EXPECT_EQ(mesh->GetVertexCount(), 8);
+		EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+		ExpectSameTrianglePositions(*mesh, *offMesh);
+	}
+
+	{ // Large enough soup to be welded by several threads.
+		Mesh gridMesh = TestHelpers::CreateGridMesh(60, 40);
+		const std::filesystem::path filepath = "TestFiles/Stl/gridBinary.stl";
+		WriteBinarySTL(gridMesh, filepath, "grid");
+
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL(filepath);
+		ASSERT_NE(mesh, nullptr);
+		EXPECT_EQ(mesh->GetVertexCount(), gridMesh.GetVertexCount());
+		EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+		ExpectSameTrianglePositions(*mesh, gridMesh);
+	}
+}
+
+TEST(MeshLoaderTest, LoadSTL_DegeneratedFacet_ShouldBeRemoved)
+{
+	const std::filesystem::path filepath = "TestFiles/Stl/degenerated.stl";
+	std::ofstream file(filepath, std::ios::trunc);
+	file << "solid degenerated\n"
+			"facet normal 0 0 1\nouter loop\nvertex 0 0 0\nvertex 1 0 0\nvertex 0 1 0\nendloop\nendfacet\n"
+			"facet normal 0 0 1\nouter loop\nvertex 0 0 0\nvertex -0 0 0\nvertex 0 1 0\nendloop\nendfacet\n"
+			"endsolid degenerated\n";
+	file.close();
+
+	// -0 and 0 are welded, which makes the second facet degenerated.
+	std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL(filepath);
+	ASSERT_NE(mesh, nullptr);
+	EXPECT_EQ(mesh->GetVertexCount(), 3);
+	EXPECT_EQ(mesh->GetTriangleCount(), 1);
+}
+
+TEST(MeshLoaderTest, LoadSTL_InvalidFile_ShouldReturnNullptr)
+{
+	{ // Can't open file.
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL("TestFiles/Stl/notAFile.stl");
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Wrong file format.
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL("TestFiles/Off/cube.off");
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Incomplete facet.
+		const std::filesystem::path filepath = "TestFiles/Stl/incomplete.stl";
+		std::ofstream file(filepath, std::ios::trunc);
+		file << "solid incomplete\nfacet normal 0 0 1\nouter loop\nvertex 0 0 0\nvertex 1 0 0\nendloop\nendfacet\n";
+		file.close();
+
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL(filepath);
+		EXPECT_EQ(mesh, nullptr);
+	}
+
+	{ // Truncated binary file.
+		const std::filesystem::path filepath = "TestFiles/Stl/truncated.stl";
+		WriteBinarySTL(TestHelpers::CreateGridMesh(2, 2), filepath, "truncated");
+		std::filesystem::resize_file(filepath, std::filesystem::file_size(filepath) - 1);
+
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadSTL(filepath);
+		EXPECT_EQ(mesh, nullptr);
+	}
+}
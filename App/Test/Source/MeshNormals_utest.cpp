@@ -0,0 +1,175 @@
+#include "Application/MeshNormals.h"
+
+#include "Application/TestHelpers.h"
+#include "Core/MathHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+using namespace Core::Math::Compare;
+
+namespace
+{
+/// @brief Create two right triangles sharing the edge (0, 1), one in the XY plane and one in the XZ plane.
+Mesh CreateFoldedMesh()
+{
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 2.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 0.f, 2.f, 0.f } });
+	mesh.AddVertex({ .Position = { 0.f, 0.f, 1.f } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } }); // Normal +Z, area 2
+	mesh.AddTriangle({ .Vertices = { 0, 3, 1 } }); // Normal +Y, area 1
+	mesh.UpdateMeshConnectivity();
+	return mesh;
+}
+
+/// @brief Create two fans of two triangles sharing the vertex 0 only (bowtie vertex), the first one in the XY plane.
+Mesh CreateBowtieMesh()
+{
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 1.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 1.f, 1.f, 0.f } });
+	mesh.AddVertex({ .Position = { 0.f, 1.f, 0.f } });
+	mesh.AddVertex({ .Position = { -1.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { -1.f, -1.f, 1.f } });
+	mesh.AddVertex({ .Position = { 0.f, -1.f, 1.f } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 0, 2, 3 } });
+	mesh.AddTriangle({ .Vertices = { 0, 4, 5 } });
+	mesh.AddTriangle({ .Vertices = { 0, 5, 6 } });
+	mesh.UpdateMeshConnectivity();
+	return mesh;
+}
+} // namespace
+
+TEST(MeshNormalsTest, ComputeTriangleNormals_ShouldHaveTwiceTheAreaAsLength)
+{
+	const Mesh mesh = CreateFoldedMesh();
+
+	std::vector<Vec3> normals(mesh.GetTriangleCount());
+	MeshNormals::ComputeTriangleNormals(mesh.GetVertices(), mesh.GetTriangles(), normals, false);
+	EXPECT_EQ(normals[0], Vec3(0.f, 0.f, 4.f));
+	EXPECT_EQ(normals[1], Vec3(0.f, 2.f, 0.f));
+
+	MeshNormals::ComputeTriangleNormals(mesh.GetVertices(), mesh.GetTriangles(), normals, true);
+	EXPECT_EQ(normals[0], Vec3(0.f, 0.f, 1.f));
+	EXPECT_EQ(normals[1], Vec3(0.f, 1.f, 0.f));
+}
+
+TEST(MeshNormalsTest, ComputeVertexNormals_ShouldApplyWeighting)
+{
+	const Mesh mesh = CreateFoldedMesh();
+	constexpr float epsilon = 1e-5f;
+
+	// Both triangles have a right angle at vertex 0, and angles of pi/4 and atan(1/2) at vertex 1.
+	const std::vector<Vec3> uniformNormals = MeshNormals::ComputeVertexNormals(mesh, NormalWeighting::Uniform);
+	EXPECT_TRUE(EqualNear(uniformNormals[0], glm::normalize(Vec3(0.f, 1.f, 1.f)), epsilon));
+	EXPECT_TRUE(EqualNear(uniformNormals[1], glm::normalize(Vec3(0.f, 1.f, 1.f)), epsilon));
+
+	const std::vector<Vec3> areaNormals = MeshNormals::ComputeVertexNormals(mesh, NormalWeighting::Area, false);
+	EXPECT_TRUE(EqualNear(areaNormals[0], Vec3(0.f, 1.f, 2.f), epsilon));
+	EXPECT_TRUE(EqualNear(areaNormals[1], Vec3(0.f, 1.f, 2.f), epsilon));
+
+	const std::vector<Vec3> angleNormals = MeshNormals::ComputeVertexNormals(mesh, NormalWeighting::Angle, false);
+	const float rightAngle = std::numbers::pi_v<float> / 2.f;
+	EXPECT_TRUE(EqualNear(angleNormals[0], Vec3(0.f, rightAngle, rightAngle), epsilon));
+	EXPECT_TRUE(EqualNear(angleNormals[1], Vec3(0.f, std::atan(0.5f), std::numbers::pi_v<float> / 4.f), epsilon));
+
+	// Vertices of a single triangle get its normal.
+	EXPECT_TRUE(EqualNear(angleNormals[2], Vec3(0.f, 0.f, std::numbers::pi_v<float> / 4.f), epsilon));
+	EXPECT_TRUE(EqualNear(uniformNormals[3], Vec3(0.f, 1.f, 0.f), epsilon));
+}
+
+TEST(MeshNormalsTest, ComputeVertexNormals_ShouldUseGivenTriangleNormals)
+{
+	const Mesh mesh = CreateFoldedMesh();
+	const std::vector<Vec3> triangleNormals{ { 0.f, 0.f, 3.f }, { 0.f, 0.f, 1.f } };
+
+	// Both triangles get the normal +Z, with the angle weights of the positions.
+	std::vector<Vec3> normals(mesh.GetVertexCount());
+	MeshNormals::ComputeVertexNormals(
+		mesh.GetVertices(), mesh.GetTriangles(), normals, NormalWeighting::Angle, false, 1, triangleNormals);
+	EXPECT_TRUE(EqualNear(normals[0], Vec3(0.f, 0.f, std::numbers::pi_v<float>), 1e-5f));
+	EXPECT_TRUE(EqualNear(normals[3], Vec3(0.f, 0.f, std::atan(2.f)), 1e-5f));
+
+	// The normals of some vertices match the ones of the whole mesh.
+	const std::vector<VertexIndex> vertexIndices{ 3, 0 };
+	std::vector<Vec3> someNormals(vertexIndices.size());
+	MeshNormals::ComputeVertexNormals(
+		mesh, vertexIndices, someNormals, NormalWeighting::Angle, false, 1, triangleNormals);
+	EXPECT_EQ(someNormals[0], normals[3]);
+	EXPECT_EQ(someNormals[1], normals[0]);
+}
+
+TEST(MeshNormalsTest, ComputeVertexNormals_ShouldNotDependOnThreadCount)
+{
+	const Mesh mesh = TestHelpers::CreateIcosphereMesh(5);
+
+	const std::vector<Vec3> sequentialNormals =
+		MeshNormals::ComputeVertexNormals(mesh, NormalWeighting::Angle, true, 1);
+	const std::vector<Vec3> parallelNormals = MeshNormals::ComputeVertexNormals(mesh, NormalWeighting::Angle, true, 4);
+	EXPECT_EQ(sequentialNormals, parallelNormals);
+
+	// The normals of a unit sphere are its positions.
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		EXPECT_TRUE(EqualNear(parallelNormals[iVertex], mesh.GetVertexData(iVertex).Position, 1e-2f));
+}
+
+TEST(MeshNormalsTest, UpdateVertexNormals_ShouldOnlyUpdateOneRingOfMovedVertices)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(4, 4);
+	std::vector<Vec3> normals = MeshNormals::ComputeVertexNormals(mesh, NormalWeighting::Area);
+
+	// Lift the center of the grid (vertex 12), its one-ring is the vertices 6, 7, 11, 13, 17 and 18.
+	const std::vector<VertexIndex> movedVertices{ 12 };
+	mesh.GetVertices()[12].Position.z = 1.f;
+	EXPECT_EQ(MeshNormals::GetTrianglesAroundVertices(mesh, movedVertices).size(), 6);
+	EXPECT_EQ(MeshNormals::GetVerticesAroundVertices(mesh, movedVertices),
+			  (std::vector<VertexIndex>{ 6, 7, 11, 12, 13, 17, 18 }));
+
+	const std::vector<Vec3> previousNormals = normals;
+	MeshNormals::UpdateVertexNormals(mesh, movedVertices, normals, NormalWeighting::Area);
+	EXPECT_EQ(normals, MeshNormals::ComputeVertexNormals(mesh, NormalWeighting::Area));
+	EXPECT_NE(normals[6], previousNormals[6]);
+	EXPECT_EQ(normals[0], previousNormals[0]);
+}
+
+TEST(MeshNormalsTest, UpdateVertexNormals_BowtieVertex_ShouldSumBothFans)
+{
+	Mesh mesh = CreateBowtieMesh();
+	std::vector<Vec3> normals = MeshNormals::ComputeVertexNormals(mesh);
+	EXPECT_GT(normals[0].y, 0.f);
+
+	// The circulators see a single fan around the bowtie vertex, the incremental update must see both.
+	const std::vector<VertexIndex> movedVertices{ 0 };
+	mesh.SetVertexPosition(0, { 0.f, 0.f, 0.5f });
+	EXPECT_EQ(MeshNormals::GetTrianglesAroundVertices(mesh, movedVertices), (std::vector<TriangleIndex>{ 0, 1, 2, 3 }));
+	EXPECT_EQ(MeshNormals::GetVerticesAroundVertices(mesh, movedVertices).size(), mesh.GetVertexCount());
+
+	MeshNormals::UpdateVertexNormals(mesh, movedVertices, normals);
+	EXPECT_EQ(normals, MeshNormals::ComputeVertexNormals(mesh));
+}
+
+TEST(MeshNormalsTest, ComputeVertexNormals_DegenerateTriangles_ShouldGiveNullNormals)
+{
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 1.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 2.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 5.f, 5.f, 5.f } }); // Isolated vertex
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+
+	for(NormalWeighting curWeighting : { NormalWeighting::Uniform, NormalWeighting::Area, NormalWeighting::Angle })
+	{
+		for(const Vec3& curNormal : MeshNormals::ComputeVertexNormals(mesh, curWeighting))
+			EXPECT_EQ(curNormal, Vec3(0.f, 0.f, 0.f));
+	}
+}
@@ -0,0 +1,202 @@
+#include "Application/MeshReordering.h"
+
+#include "Application/ExtraDataType.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/PrimitiveProxy.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Data::ExtraData;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Get a random permutation of [0, count).
+std::vector<uint32_t> GetShuffledOrder(size_t count, uint32_t seed)
+{
+	std::vector<uint32_t> order(count);
+	std::iota(order.begin(), order.end(), 0);
+	std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+	return order;
+}
+
+/// @brief Check that a mesh is a reordering of another one, with the new element i being the old element order[i].
+void ExpectPermutedMesh(const Mesh& mesh,
+						const Mesh& originalMesh,
+						std::span<const VertexIndex> vertexOrder,
+						std::span<const TriangleIndex> triangleOrder)
+{
+	ASSERT_EQ(mesh.GetVertexCount(), originalMesh.GetVertexCount());
+	ASSERT_EQ(mesh.GetTriangleCount(), originalMesh.GetTriangleCount());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		EXPECT_EQ(mesh.GetVertexData(iVertex).Position, originalMesh.GetVertexData(vertexOrder[iVertex]).Position);
+
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const Triangle& curTriangle = mesh.GetTriangleData(iTriangle);
+		const Triangle& originalTriangle = originalMesh.GetTriangleData(triangleOrder[iTriangle]);
+		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+		{
+			EXPECT_EQ(static_cast<int>(vertexOrder[curTriangle.Vertices[iEdge]]), originalTriangle.Vertices[iEdge]);
+			if(originalTriangle.Neighbors[iEdge] == -1)
+				EXPECT_EQ(curTriangle.Neighbors[iEdge], -1);
+			else
+				EXPECT_EQ(static_cast<int>(triangleOrder[curTriangle.Neighbors[iEdge]]),
+						  originalTriangle.Neighbors[iEdge]);
+		}
+	}
+}
+} // namespace
+
+TEST(MeshReorderingTest, ComputeMortonVertexOrder_ShouldFollowZOrderCurve)
+{
+	// Corners of a cube, given in reverse Morton order.
+	std::vector<Vertex> vertices;
+	for(int iCorner = 7; iCorner >= 0; --iCorner)
+		vertices.push_back({ .Position = Vec3(iCorner & 1, (iCorner >> 1) & 1, (iCorner >> 2) & 1) });
+
+	const std::vector<VertexIndex> order = MeshReordering::ComputeMortonVertexOrder(vertices);
+	EXPECT_EQ(order, std::vector<VertexIndex>({ 7, 6, 5, 4, 3, 2, 1, 0 }));
+
+	// Vertices at the same position keep their relative order, a flat axis does not matter.
+	const std::vector<Vertex> flatVertices = { { .Position = { 1.f, 0.f, 2.f } },
+											   { .Position = { 0.f, 0.f, 2.f } },
+											   { .Position = { 1.f, 0.f, 2.f } },
+											   { .Position = { 0.f, 1.f, 2.f } } };
+	EXPECT_EQ(MeshReordering::ComputeMortonVertexOrder(flatVertices), std::vector<VertexIndex>({ 1, 0, 2, 3 }));
+	EXPECT_TRUE(MeshReordering::ComputeMortonVertexOrder({}).empty());
+}
+
+TEST(MeshReorderingTest, ComputeBreadthFirstTriangleOrder_ShouldVisitNeighborsFirst)
+{
+	const Mesh mesh = TestHelpers::CreateGridMesh(3, 3);
+	const std::vector<TriangleIndex> order = MeshReordering::ComputeBreadthFirstTriangleOrder(mesh.GetTriangles());
+	std::vector<TriangleIndex> sortedOrder = order;
+	std::ranges::sort(sortedOrder);
+	std::vector<TriangleIndex> expectedSortedOrder(mesh.GetTriangleCount());
+	std::iota(expectedSortedOrder.begin(), expectedSortedOrder.end(), 0);
+	EXPECT_EQ(sortedOrder, expectedSortedOrder);
+
+	// The seed is followed by its neighbors.
+	std::vector<TriangleIndex> expectedFirstTriangles = { 0 };
+	for(int curNeighborIdx : mesh.GetTriangleData(0).Neighbors)
+	{
+		if(curNeighborIdx != -1)
+			expectedFirstTriangles.push_back(static_cast<TriangleIndex>(curNeighborIdx));
+	}
+	ASSERT_GT(expectedFirstTriangles.size(), 1);
+	std::vector<TriangleIndex> firstTriangles(order.begin(), order.begin() + expectedFirstTriangles.size());
+	std::ranges::sort(firstTriangles);
+	std::ranges::sort(expectedFirstTriangles);
+	EXPECT_EQ(firstTriangles, expectedFirstTriangles);
+}
+
+TEST(MeshReorderingTest, ComputeVertexOrder_ShouldPlaceIsolatedVerticesLast)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(1, 1);
+	mesh.AddVertex({ .Position = { 5.f, 5.f, 5.f } });
+
+	// Vertices of the second triangle first.
+	const std::vector<TriangleIndex> triangleOrder = { 1, 0 };
+	const std::vector<VertexIndex> order =
+		MeshReordering::ComputeVertexOrder(mesh.GetVertexCount(), mesh.GetTriangles(), triangleOrder);
+	ASSERT_EQ(order.size(), mesh.GetVertexCount());
+	const Triangle& firstTriangle = mesh.GetTriangleData(1);
+	for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+		EXPECT_EQ(static_cast<int>(order[iCorner]), firstTriangle.Vertices[iCorner]);
+	EXPECT_EQ(order.back(), mesh.GetVertexCount() - 1);
+}
+
+TEST(MeshReorderingTest, Permute_ShouldRemapConnectivityAndData)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(4, 3);
+	mesh.ComputeTriangleNormals(true);
+	mesh.ComputeSmoothVertexNormals(true);
+	Data::Attribute::AttributeChannel<uint32_t>& vertexIds = mesh.AddVertexAttribute<uint32_t>("Id");
+	std::iota(vertexIds.GetValues().begin(), vertexIds.GetValues().end(), 0);
+	Data::Attribute::AttributeChannel<uint32_t>& triangleIds = mesh.AddTriangleAttribute<uint32_t>("Id");
+	std::iota(triangleIds.GetValues().begin(), triangleIds.GetValues().end(), 0);
+	mesh.SetVertexPosition(5, mesh.GetVertexData(5).Position);
+	mesh.SetVertexPosition(2, mesh.GetVertexData(2).Position);
+	mesh.BuildOneRingAdjacency();
+	Mesh originalMesh = mesh;
+
+	const std::vector<VertexIndex> vertexOrder = GetShuffledOrder(mesh.GetVertexCount(), 1);
+	const std::vector<TriangleIndex> triangleOrder = GetShuffledOrder(mesh.GetTriangleCount(), 2);
+	MeshReordering::Permute(mesh, vertexOrder, triangleOrder, 3);
+
+	ExpectPermutedMesh(mesh, originalMesh, vertexOrder, triangleOrder);
+	EXPECT_TRUE(mesh.HasNeighborEdgeSlots());
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+
+	// Extra data and attributes move with their primitive.
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const VertexProxy originalVertex = originalMesh.GetVertex(vertexOrder[iVertex]);
+		const auto* curNormal = mesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>();
+		const auto* originalNormal = originalVertex.GetExtraData<SmoothVertexNormalExtraData>();
+		ASSERT_NE(curNormal, nullptr);
+		ASSERT_NE(originalNormal, nullptr);
+		EXPECT_EQ(curNormal->GetData(), originalNormal->GetData());
+		EXPECT_EQ((*mesh.GetVertexAttribute<uint32_t>("Id"))[iVertex], vertexOrder[iVertex]);
+	}
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const TriangleProxy originalTriangle = originalMesh.GetTriangle(triangleOrder[iTriangle]);
+		const auto* curNormal = mesh.GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>();
+		const auto* originalNormal = originalTriangle.GetExtraData<TriangleNormalExtraData>();
+		ASSERT_NE(curNormal, nullptr);
+		ASSERT_NE(originalNormal, nullptr);
+		EXPECT_EQ(curNormal->GetData(), originalNormal->GetData());
+		EXPECT_EQ((*mesh.GetTriangleAttribute<uint32_t>("Id"))[iTriangle], triangleOrder[iTriangle]);
+	}
+
+	// The dirty vertices follow their vertex, in marking order.
+	ASSERT_EQ(mesh.GetDirtyVertices().size(), 2);
+	EXPECT_EQ(vertexOrder[mesh.GetDirtyVertices()[0]], 5);
+	EXPECT_EQ(vertexOrder[mesh.GetDirtyVertices()[1]], 2);
+	mesh.MarkVertexDirty(mesh.GetDirtyVertices()[0]);
+	EXPECT_EQ(mesh.GetDirtyVertices().size(), 2);
+}
+
+TEST(MeshReorderingTest, Reorder_ShouldKeepMeshValid)
+{
+	for(ReorderingMethod curMethod : { ReorderingMethod::Morton, ReorderingMethod::BreadthFirst })
+	{
+		Mesh mesh = TestHelpers::CreateIcosphereMesh(3);
+		const Mesh originalMesh = mesh;
+		MeshReordering::Reorder(mesh, curMethod, 2);
+
+		EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+		ASSERT_EQ(mesh.GetVertexCount(), originalMesh.GetVertexCount());
+		ASSERT_EQ(mesh.GetTriangleCount(), originalMesh.GetTriangleCount());
+
+		// Same triangles, as positions.
+		auto GetTrianglePositions = [](const Mesh& curMesh)
+		{
+			std::vector<std::array<float, 9>> positions;
+			for(const Triangle& curTriangle : curMesh.GetTriangles())
+			{
+				std::array<float, 9>& curPositions = positions.emplace_back();
+				for(int iCorner = 0; iCorner < 3; ++iCorner)
+				{
+					const Vec3& curPosition = curMesh.GetVertexData(curTriangle.Vertices[iCorner]).Position;
+					std::copy_n(&curPosition.x, 3, curPositions.begin() + 3 * iCorner);
+				}
+			}
+			std::ranges::sort(positions);
+			return positions;
+		};
+		EXPECT_EQ(GetTrianglePositions(mesh), GetTrianglePositions(originalMesh));
+	}
+}
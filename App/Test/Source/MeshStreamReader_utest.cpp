@@ -0,0 +1,180 @@
+#include "Application/MeshStreamReader.h"
+
+#include "Application/MeshLoader.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Visitor counting the records and computing the bounding box of the vertices.
+class CountingVisitor : public MeshRecordVisitor
+{
+public:
+	void OnHeader(uint64_t vertexCount, uint64_t faceCount) override
+	{
+		HeaderVertexCount = vertexCount;
+		HeaderFaceCount = faceCount;
+	}
+
+	void OnVertex(const Vec3& position) override
+	{
+		++VertexCount;
+		for(int iAxis = 0; iAxis < 3; ++iAxis)
+		{
+			Min[iAxis] = std::min(Min[iAxis], position[iAxis]);
+			Max[iAxis] = std::max(Max[iAxis], position[iAxis]);
+		}
+	}
+
+	void OnTexCoord(const Vec2&) override { ++TexCoordCount; }
+
+	void OnNormal(const Vec3&) override { ++NormalCount; }
+
+	void OnFace(std::span<const FaceCorner> corners) override
+	{
+		Faces.emplace_back(corners.begin(), corners.end());
+	}
+
+public:
+	uint64_t HeaderVertexCount{ 0 };
+	uint64_t HeaderFaceCount{ 0 };
+	uint64_t VertexCount{ 0 };
+	uint64_t TexCoordCount{ 0 };
+	uint64_t NormalCount{ 0 };
+	std::vector<std::vector<FaceCorner>> Faces;
+	Vec3 Min{ std::numeric_limits<float>::max() };
+	Vec3 Max{ std::numeric_limits<float>::lowest() };
+};
+} // namespace
+
+TEST(MeshStreamReaderTest, ReadOFF_ValidFile_ShouldVisitRecords)
+{
+	CountingVisitor visitor;
+	ASSERT_TRUE(MeshStreamReader::ReadOFF("TestFiles/Off/cube.off", visitor));
+
+	EXPECT_EQ(visitor.HeaderVertexCount, 8);
+	EXPECT_EQ(visitor.HeaderFaceCount, 12);
+	EXPECT_EQ(visitor.VertexCount, 8);
+	EXPECT_EQ(visitor.Faces.size(), 12);
+	EXPECT_EQ(visitor.Min, Vec3(-1.f));
+	EXPECT_EQ(visitor.Max, Vec3(1.f));
+
+	// Faces should match the loaded mesh.
+	std::unique_ptr<Mesh> mesh = MeshLoader::LoadOFF("TestFiles/Off/cube.off");
+	ASSERT_NE(mesh, nullptr);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		ASSERT_EQ(visitor.Faces[iTriangle].size(), 3);
+		for(int iCorner = 0; iCorner < 3; ++iCorner)
+			EXPECT_EQ(visitor.Faces[iTriangle][iCorner].PositionIdx,
+					  mesh->GetTriangleData(iTriangle).Vertices[iCorner]);
+	}
+}
+
+TEST(MeshStreamReaderTest, ReadOBJ_ValidFiles_ShouldVisitRecords)
+{
+	const std::vector<std::filesystem::path> filepaths{ "TestFiles/Obj/cube.obj",
+														"TestFiles/Obj/cube_vn.obj",
+														"TestFiles/Obj/cube_vt.obj",
+														"TestFiles/Obj/cube_vtvn.obj" };
+	for(const std::filesystem::path& curFilepath : filepaths)
+	{
+		std::unique_ptr<Mesh> mesh = MeshLoader::LoadOBJ(curFilepath);
+		ASSERT_NE(mesh, nullptr);
+
+		CountingVisitor visitor;
+		ASSERT_TRUE(MeshStreamReader::ReadOBJ(curFilepath, visitor));
+		EXPECT_EQ(visitor.VertexCount, mesh->GetVertexCount());
+		EXPECT_EQ(visitor.Min, Vec3(0.f));
+		EXPECT_EQ(visitor.Max, Vec3(1.f));
+
+		ASSERT_EQ(visitor.Faces.size(), mesh->GetTriangleCount());
+		for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+		{
+			for(int iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				const FaceCorner& curCorner = visitor.Faces[iTriangle][iCorner];
+				EXPECT_EQ(curCorner.PositionIdx, mesh->GetTriangleData(iTriangle).Vertices[iCorner]);
+				EXPECT_EQ(curCorner.TexCoordIdx == -1, visitor.TexCoordCount == 0);
+				EXPECT_EQ(curCorner.NormalIdx == -1, visitor.NormalCount == 0);
+			}
+		}
+	}
+}
+
+TEST(MeshStreamReaderTest, ReadOBJ_SmallBuffer_ShouldMatchDefaultBuffer)
+{
+	CountingVisitor expectedVisitor;
+	ASSERT_TRUE(MeshStreamReader::ReadOBJ("TestFiles/Obj/cube_vtvn.obj", expectedVisitor));
+
+	// The longest line of the file fits in the buffer, records are split across refills.
+	CountingVisitor visitor;
+	ASSERT_TRUE(MeshStreamReader::ReadOBJ("TestFiles/Obj/cube_vtvn.obj", visitor, 128));
+	EXPECT_EQ(visitor.VertexCount, expectedVisitor.VertexCount);
+	EXPECT_EQ(visitor.TexCoordCount, expectedVisitor.TexCoordCount);
+	EXPECT_EQ(visitor.NormalCount, expectedVisitor.NormalCount);
+	ASSERT_EQ(visitor.Faces.size(), expectedVisitor.Faces.size());
+	for(size_t iFace = 0; iFace < visitor.Faces.size(); ++iFace)
+	{
+		ASSERT_EQ(visitor.Faces[iFace].size(), expectedVisitor.Faces[iFace].size());
+		for(size_t iCorner = 0; iCorner < visitor.Faces[iFace].size(); ++iCorner)
+		{
+			EXPECT_EQ(visitor.Faces[iFace][iCorner].PositionIdx, expectedVisitor.Faces[iFace][iCorner].PositionIdx);
+			EXPECT_EQ(visitor.Faces[iFace][iCorner].TexCoordIdx, expectedVisitor.Faces[iFace][iCorner].TexCoordIdx);
+			EXPECT_EQ(visitor.Faces[iFace][iCorner].NormalIdx, expectedVisitor.Faces[iFace][iCorner].NormalIdx);
+		}
+	}
+}
+
+TEST(MeshStreamReaderTest, ReadOBJ_RelativeIndicesAndPolygons_ShouldBeResolved)
+{
+	const std::filesystem::path filepath = "TestFiles/Obj/streamQuad.obj";
+	{
+		std::ofstream file(filepath);
+		file << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvn 0 0 1\nf -4//-1 -3//-1 -2//-1 -1//-1";
+	}
+
+	CountingVisitor visitor;
+	ASSERT_TRUE(MeshStreamReader::ReadOBJ(filepath, visitor));
+	ASSERT_EQ(visitor.Faces.size(), 1);
+	ASSERT_EQ(visitor.Faces[0].size(), 4);
+	for(int iCorner = 0; iCorner < 4; ++iCorner)
+	{
+		EXPECT_EQ(visitor.Faces[0][iCorner].PositionIdx, iCorner);
+		EXPECT_EQ(visitor.Faces[0][iCorner].TexCoordIdx, -1);
+		EXPECT_EQ(visitor.Faces[0][iCorner].NormalIdx, 0);
+	}
+}
+
+TEST(MeshStreamReaderTest, Read_InvalidFile_ShouldReturnFalse)
+{
+	CountingVisitor visitor;
+
+	// Can't open file.
+	EXPECT_FALSE(MeshStreamReader::ReadOFF("TestFiles/Off/notAFile.off", visitor));
+	EXPECT_FALSE(MeshStreamReader::ReadOBJ("TestFiles/Obj/notAFile.obj", visitor));
+
+	// Wrong file format.
+	EXPECT_FALSE(MeshStreamReader::ReadOFF("TestFiles/Obj/cube.obj", visitor));
+
+	// Line longer than the buffer.
+	EXPECT_FALSE(MeshStreamReader::ReadOBJ("TestFiles/Obj/cube_vtvn.obj", visitor, 8));
+
+	// Index referencing a record not read yet.
+	const std::filesystem::path filepath = "TestFiles/Obj/streamForwardIndex.obj";
+	{
+		std::ofstream file(filepath);
+		file << "v 0 0 0\nv 1 0 0\nf 1 2 3\nv 1 1 0\n";
+	}
+	EXPECT_FALSE(MeshStreamReader::ReadOBJ(filepath, visitor));
+}
@@ -0,0 +1,115 @@
+#include "Application/MeshVertexCache.h"
+
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshReordering.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Create a grid with its triangles shuffled.
+Mesh CreateShuffledGridMesh(int rowCount)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(rowCount, rowCount);
+	std::vector<VertexIndex> vertexOrder(mesh.GetVertexCount());
+	std::iota(vertexOrder.begin(), vertexOrder.end(), 0);
+	std::vector<TriangleIndex> triangleOrder(mesh.GetTriangleCount());
+	std::iota(triangleOrder.begin(), triangleOrder.end(), 0);
+	std::shuffle(triangleOrder.begin(), triangleOrder.end(), std::mt19937(7));
+	MeshReordering::Permute(mesh, vertexOrder, triangleOrder);
+	return mesh;
+}
+} // namespace
+
+TEST(MeshVertexCacheTest, Analyze_ShouldCountFIFOCacheMisses)
+{
+	// Two triangles sharing an edge: each vertex is transformed once.
+	const std::vector<Triangle> quad = { { .Vertices = { 0, 1, 2 } }, { .Vertices = { 0, 2, 3 } } };
+	const VertexCacheReport quadReport = MeshVertexCache::Analyze(4, quad);
+	EXPECT_EQ(quadReport.CacheMissCount, 4);
+	EXPECT_FLOAT_EQ(quadReport.ACMR, 2.f);
+	EXPECT_FLOAT_EQ(quadReport.ATVR, 1.f);
+
+	// With 3 vertices in the cache, the vertices of the first triangle are evicted before being used again.
+	const std::vector<Triangle> triangles = { { .Vertices = { 0, 1, 2 } },
+											  { .Vertices = { 3, 4, 5 } },
+											  { .Vertices = { 0, 1, 2 } },
+											  { .Vertices = { 0, 1, 2 } } };
+	const VertexCacheReport report = MeshVertexCache::Analyze(7, triangles, 3);
+	EXPECT_EQ(report.CacheMissCount, 9);
+	EXPECT_FLOAT_EQ(report.ACMR, 9.f / 4.f);
+	EXPECT_FLOAT_EQ(report.ATVR, 9.f / 6.f);
+
+	const VertexCacheReport emptyReport = MeshVertexCache::Analyze(0, {});
+	EXPECT_EQ(emptyReport.CacheMissCount, 0);
+	EXPECT_EQ(emptyReport.ACMR, 0.f);
+}
+
+TEST(MeshVertexCacheTest, ComputeTriangleOrder_ShouldReduceCacheMisses)
+{
+	const Mesh mesh = CreateShuffledGridMesh(40);
+	const std::vector<TriangleIndex> order = MeshVertexCache::ComputeTriangleOrder(mesh.GetTriangles());
+
+	std::vector<TriangleIndex> sortedOrder = order;
+	std::ranges::sort(sortedOrder);
+	std::vector<TriangleIndex> expectedSortedOrder(mesh.GetTriangleCount());
+	std::iota(expectedSortedOrder.begin(), expectedSortedOrder.end(), 0);
+	ASSERT_EQ(sortedOrder, expectedSortedOrder);
+
+	std::vector<Triangle> orderedTriangles;
+	for(TriangleIndex curTriangleIdx : order)
+		orderedTriangles.push_back(mesh.GetTriangleData(curTriangleIdx));
+	const VertexCacheReport shuffledReport = MeshVertexCache::Analyze(mesh.GetVertexCount(), mesh.GetTriangles());
+	const VertexCacheReport orderedReport = MeshVertexCache::Analyze(mesh.GetVertexCount(), orderedTriangles);
+	EXPECT_GT(shuffledReport.ACMR, 2.f);
+	EXPECT_LT(orderedReport.ACMR, 0.9f);
+	EXPECT_LT(orderedReport.ATVR, 1.7f);
+}
+
+TEST(MeshVertexCacheTest, ComputeTriangleOrder_Clusters_ShouldNotDependOnThreadCount)
+{
+	const Mesh mesh = CreateShuffledGridMesh(20);
+	constexpr uint32_t ClusterSize = 100;
+	const std::vector<TriangleIndex> order =
+		MeshVertexCache::ComputeTriangleOrder(mesh.GetTriangles(), MeshVertexCache::DefaultCacheSize, ClusterSize, 1);
+	EXPECT_EQ(
+		MeshVertexCache::ComputeTriangleOrder(mesh.GetTriangles(), MeshVertexCache::DefaultCacheSize, ClusterSize, 4),
+		order);
+
+	// Each cluster is reordered in place.
+	for(size_t iOrder = 0; iOrder < order.size(); ++iOrder)
+		EXPECT_EQ(order[iOrder] / ClusterSize, iOrder / ClusterSize);
+}
+
+TEST(MeshVertexCacheTest, Optimize_ShouldKeepMeshValid)
+{
+	Mesh mesh = CreateShuffledGridMesh(10);
+	Data::Attribute::AttributeChannel<TriangleIndex>& ids = mesh.AddTriangleAttribute<TriangleIndex>("Id");
+	std::iota(ids.GetValues().begin(), ids.GetValues().end(), 0);
+	const Mesh originalMesh = mesh;
+
+	MeshVertexCache::Optimize(mesh);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_LT(MeshVertexCache::Analyze(mesh.GetVertexCount(), mesh.GetTriangles()).ACMR,
+			  MeshVertexCache::Analyze(originalMesh.GetVertexCount(), originalMesh.GetTriangles()).ACMR);
+
+	// Vertices keep their order, the triangles and their attributes are moved.
+	ASSERT_EQ(mesh.GetTriangleCount(), originalMesh.GetTriangleCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		EXPECT_EQ(mesh.GetVertexData(iVertex).Position, originalMesh.GetVertexData(iVertex).Position);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const TriangleIndex originalTriangleIdx = (*mesh.GetTriangleAttribute<TriangleIndex>("Id"))[iTriangle];
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Vertices, originalMesh.GetTriangleData(originalTriangleIdx).Vertices);
+	}
+}
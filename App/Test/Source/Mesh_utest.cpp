@@ -2,17 +2,22 @@
 #include "Application/Mesh.h"
 #include "Application/MeshIntegrity.h"
 #include "Application/MeshLoader.h"
+#include "Application/MeshReordering.h"
 #include "Application/PrimitiveProxy.h"
 #include "Application/TestHelpers.h"
 #include "Core/MathHelpers.h"
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+#include <utility>
+
 using namespace Core::BaseType;
 using namespace Utilitary::Surface;
 using namespace Data::Surface;
 using namespace Data::ExtraData;
 using namespace Data::Primitive;
+using namespace Data::Attribute;
 using namespace Core::Math::Compare;
 
 TEST(MeshTest, CopyConstructor_ShouldDeepCopyMesh)
@@ -30,10 +35,357 @@ TEST(MeshTest, CopyConstructor_ShouldDeepCopyMesh)
 	originalMesh.GetVertexData(0).Position = { 2., 2., 2. };
 	EXPECT_NE(copiedMesh.GetVertexData(0).Position, originalMesh.GetVertexData(0).Position);
 
-	originalMesh.GetTriangleData(0).Vertices[0] = 3;
+	Triangle editedTriangle = originalMesh.GetTriangleData(0);
+	editedTriangle.Vertices[0] = 3;
+	originalMesh.SetTriangleData(0, editedTriangle);
 	EXPECT_NE(copiedMesh.GetTriangleData(0).Vertices[0], originalMesh.GetTriangleData(0).Vertices[0]);
 }
 
+TEST(MeshTest, CopyAssignment_ShouldReplaceMeshData)
+{
+	const Mesh originalMesh = TestHelpers::CreateGridMesh(3, 2);
+	Mesh assignedMesh = TestHelpers::CreateValidMesh();
+	assignedMesh.AddVertexAttribute<float>("Weight", 1.f);
+	assignedMesh.DeleteTriangle(0);
+
+	assignedMesh = originalMesh;
+	EXPECT_EQ(assignedMesh.GetVertexCount(), originalMesh.GetVertexCount());
+	EXPECT_EQ(assignedMesh.GetTriangleCount(), originalMesh.GetTriangleCount());
+	EXPECT_EQ(&std::as_const(assignedMesh).GetVertices()[0], &originalMesh.GetVertices()[0]);
+	EXPECT_FALSE(assignedMesh.HasVertexAttribute("Weight"));
+	EXPECT_FALSE(assignedMesh.IsTriangleDeleted(0));
+	EXPECT_TRUE(assignedMesh.HasNeighborEdgeSlots());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(assignedMesh), MeshIntegrity::ExitCode::MeshOK);
+
+	// The arrays are shared until one of the meshes is modified.
+	assignedMesh.GetVertexData(0).Position = { 2., 2., 2. };
+	EXPECT_NE(originalMesh.GetVertexData(0).Position, assignedMesh.GetVertexData(0).Position);
+
+	// Editing a triangle drops the shared neighbor edge slots without touching the ones of the other mesh.
+	const NeighborEdgeSlots* originalSlots = originalMesh.GetNeighborEdgeSlots().data();
+	assignedMesh.SetTriangleData(0, originalMesh.GetTriangleData(0));
+	EXPECT_FALSE(assignedMesh.HasNeighborEdgeSlots());
+	EXPECT_TRUE(originalMesh.HasNeighborEdgeSlots());
+	EXPECT_EQ(originalMesh.GetNeighborEdgeSlots().data(), originalSlots);
+
+	// Self assignment keeps the mesh.
+	const Mesh& sameMesh = assignedMesh;
+	assignedMesh = sameMesh;
+	EXPECT_EQ(assignedMesh.GetVertexData(0).Position, Vec3(2., 2., 2.));
+	EXPECT_EQ(assignedMesh.GetTriangleCount(), originalMesh.GetTriangleCount());
+}
+
+TEST(MeshTest, SpanConstructor_ShouldMatchAddedMesh)
+{
+	const Mesh expectedMesh = TestHelpers::CreateGridMesh(3, 2);
+	std::vector<Vec3> positions;
+	for(const Vertex& curVertex : expectedMesh.GetVertices())
+		positions.push_back(curVertex.Position);
+	std::vector<std::array<int, 3>> triangleVertices;
+	for(const Triangle& curTriangle : expectedMesh.GetTriangles())
+		triangleVertices.push_back(curTriangle.Vertices);
+
+	const Mesh mesh(positions, triangleVertices, true, 2);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	ASSERT_EQ(mesh.GetVertexCount(), expectedMesh.GetVertexCount());
+	ASSERT_EQ(mesh.GetTriangleCount(), expectedMesh.GetTriangleCount());
+	ASSERT_TRUE(mesh.HasNeighborEdgeSlots());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const Vertex& curVertex = mesh.GetVertexData(iVertex);
+		EXPECT_EQ(curVertex.Position, expectedMesh.GetVertexData(iVertex).Position);
+		EXPECT_EQ(curVertex.IncidentTriangleIdx, expectedMesh.GetVertexData(iVertex).IncidentTriangleIdx);
+	}
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Vertices, expectedMesh.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Neighbors, expectedMesh.GetTriangleData(iTriangle).Neighbors);
+	}
+
+	// Without connectivity.
+	const Mesh meshWithoutConnectivity(positions, triangleVertices, false);
+	EXPECT_FALSE(meshWithoutConnectivity.HasNeighborEdgeSlots());
+	EXPECT_EQ(meshWithoutConnectivity.GetVertexData(0).IncidentTriangleIdx, -1);
+	for(int curNeighborIdx : meshWithoutConnectivity.GetTriangleData(0).Neighbors)
+		EXPECT_EQ(curNeighborIdx, -1);
+}
+
+TEST(MeshTest, VectorConstructor_ShouldTakeVerticesAndTriangles)
+{
+	std::vector<Vertex> vertices = { { .Position = { 0., 0., 0. } },
+									 { .Position = { 1., 0., 0. } },
+									 { .Position = { 1., 1., 0. } },
+									 { .Position = { 0., 1., 0. } } };
+	std::vector<Triangle> triangles = { { .Vertices = { 0, 1, 2 } }, { .Vertices = { 0, 2, 3 } } };
+	const Vertex* vertexData = vertices.data();
+
+	const Mesh mesh(std::move(vertices), std::move(triangles));
+	EXPECT_EQ(&mesh.GetVertices()[0], vertexData);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_EQ(mesh.GetTriangleData(0).Neighbors[0], -1);
+	EXPECT_EQ(mesh.GetTriangleData(0).Neighbors[1], 1);
+
+	// The given connectivity is kept.
+	std::vector<Vertex> keptVertices(mesh.GetVertices().begin(), mesh.GetVertices().end());
+	std::vector<Triangle> trianglesWithNeighbors(mesh.GetTriangles().begin(), mesh.GetTriangles().end());
+	const Mesh keptMesh(std::move(keptVertices), std::move(trianglesWithNeighbors), false);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(keptMesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_FALSE(keptMesh.HasNeighborEdgeSlots());
+}
+
+TEST(MeshTest, MoveConstructor_ShouldTakeData)
+{
+	Mesh originalMesh = TestHelpers::CreateGridMesh(2, 2);
+	originalMesh.AddVertexAttribute<float>("Weight", 1.f);
+	const Vertex* vertexData = &std::as_const(originalMesh).GetVertices()[0];
+
+	Mesh movedMesh(std::move(originalMesh));
+	EXPECT_EQ(&std::as_const(movedMesh).GetVertices()[0], vertexData);
+	EXPECT_TRUE(movedMesh.HasVertexAttribute("Weight"));
+	EXPECT_TRUE(movedMesh.HasNeighborEdgeSlots());
+
+	Mesh assignedMesh;
+	assignedMesh = std::move(movedMesh);
+	EXPECT_EQ(&std::as_const(assignedMesh).GetVertices()[0], vertexData);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(assignedMesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshTest, Reserve_ShouldKeepAddedElements)
+{
+	Mesh mesh = TestHelpers::CreateValidMeshWithED();
+	mesh.Reserve(100, 200);
+	EXPECT_EQ(mesh.GetVertexCount(), 4);
+	EXPECT_EQ(mesh.GetTriangleCount(), 2);
+
+	// The extra data containers still grow with the triangles.
+	const TriangleIndex triangleIdx = mesh.AddTriangle({ .Vertices = { 1, 2, 3 } });
+	EXPECT_EQ(triangleIdx, 2);
+	mesh.GetTriangle(triangleIdx).GetOrCreateExtraData<TriangleNormalExtraData>();
+	EXPECT_NE(mesh.GetTriangle(triangleIdx).GetExtraData<TriangleNormalExtraData>(), nullptr);
+}
+
+TEST(MeshTest, CreateSnapshot_ShouldKeepVersionAndShareUntouchedArrays)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(3, 3);
+	mesh.ComputeTriangleNormals(true);
+	mesh.AddVertexAttribute<float>("Weight", 1.f);
+	const std::shared_ptr<const Mesh> snapshot = mesh.CreateSnapshot();
+	EXPECT_EQ(&snapshot->GetVertices()[0], &std::as_const(mesh).GetVertices()[0]);
+
+	// Moving a vertex copies the chunk of the vertex only.
+	const Vec3 position = mesh.GetVertexData(5).Position;
+	mesh.SetVertexPosition(5, { 7.f, 7.f, 7.f });
+	EXPECT_EQ(snapshot->GetVertexData(5).Position, position);
+	EXPECT_NE(&snapshot->GetVertices()[0], &std::as_const(mesh).GetVertices()[0]);
+	EXPECT_EQ(&snapshot->GetTriangles()[0], &mesh.GetTriangles()[0]);
+	EXPECT_TRUE(snapshot->GetDirtyVertices().empty());
+
+	// The dirty vertices are shared by the copies, and kept when a copy clears them.
+	Mesh clearedMesh(mesh);
+	EXPECT_EQ(clearedMesh.GetDirtyVertices().data(), mesh.GetDirtyVertices().data());
+	clearedMesh.ClearDirtyVertices();
+	EXPECT_TRUE(clearedMesh.GetDirtyVertices().empty());
+	EXPECT_EQ(mesh.GetDirtyVertices(), std::vector<VertexIndex>{ 5 });
+
+	// Extra data and attributes edited through the mesh are not seen by the snapshot.
+	mesh.UpdateDirtyNormals(true);
+	(*mesh.GetVertexAttribute<float>("Weight"))[5] = 2.f;
+	EXPECT_EQ((*snapshot->GetVertexAttribute<float>("Weight"))[5], 1.f);
+	const TriangleIndex triangleIdx = static_cast<TriangleIndex>(mesh.GetVertexData(5).IncidentTriangleIdx);
+	EXPECT_NE(mesh.GetTriangle(triangleIdx).GetExtraData<TriangleNormalExtraData>()->GetData(),
+			  Mesh(*snapshot).GetTriangle(triangleIdx).GetExtraData<TriangleNormalExtraData>()->GetData());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*snapshot), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshTest, CreateSnapshot_ShouldCopyTheEditedChunksOnly)
+{
+	// More vertices and triangles than a chunk holds.
+	Mesh mesh = TestHelpers::CreateGridMesh(70, 70);
+	const std::shared_ptr<const Mesh> snapshot = mesh.CreateSnapshot();
+	const Core::Container::ChunkedCowVector<Vertex>& vertices = std::as_const(mesh).GetVertices();
+	const Core::Container::ChunkedCowVector<Triangle>& triangles = mesh.GetTriangles();
+	ASSERT_EQ(vertices.GetChunkCount(), 2);
+	ASSERT_EQ(triangles.GetChunkCount(), 3);
+
+	// Moving a vertex of the second chunk copies this chunk only.
+	const VertexIndex vertexIdx = 4500;
+	const Vec3 position = snapshot->GetVertexData(vertexIdx).Position;
+	mesh.SetVertexPosition(vertexIdx, { 7.f, 7.f, 7.f });
+	EXPECT_TRUE(vertices.IsChunkShared(0));
+	EXPECT_FALSE(vertices.IsChunkShared(1));
+	EXPECT_EQ(&vertices[0], &snapshot->GetVertices()[0]);
+	EXPECT_EQ(snapshot->GetVertexData(vertexIdx).Position, position);
+	EXPECT_EQ(mesh.GetVertexData(vertexIdx).Position, Vec3(7.f, 7.f, 7.f));
+
+	// Editing a triangle of the last chunk copies this chunk only.
+	const TriangleIndex triangleIdx = 9000;
+	const std::array<int, 3> triangleVertices = snapshot->GetTriangleData(triangleIdx).Vertices;
+	Triangle flippedTriangle = mesh.GetTriangleData(triangleIdx);
+	std::swap(flippedTriangle.Vertices[1], flippedTriangle.Vertices[2]);
+	mesh.SetTriangleData(triangleIdx, flippedTriangle);
+	EXPECT_TRUE(triangles.IsChunkShared(0));
+	EXPECT_TRUE(triangles.IsChunkShared(1));
+	EXPECT_FALSE(triangles.IsChunkShared(2));
+	EXPECT_EQ(snapshot->GetTriangleData(triangleIdx).Vertices, triangleVertices);
+	EXPECT_EQ(mesh.GetTriangleData(triangleIdx).Vertices[1], triangleVertices[2]);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*snapshot), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshTest, GetVertices_ShouldWriteTheUnsharedChunksInPlace)
+{
+	constexpr size_t ChunkSize = Core::Container::ChunkedCowVector<Vertex>::ChunkSize;
+	Mesh mesh = TestHelpers::CreateGridMesh(70, 70);
+	const Core::Container::ChunkedCowVector<Vertex>& vertices = std::as_const(mesh).GetVertices();
+
+	// The vertices are split once a chunk is written while shared.
+	const std::shared_ptr<const Mesh> snapshot = mesh.CreateSnapshot();
+	mesh.SetVertexPosition(0, { 7.f, 7.f, 7.f });
+	ASSERT_FALSE(vertices.Read().IsContiguous());
+	EXPECT_TRUE(vertices.IsChunkShared(1));
+
+	// Adding vertices and writing them copies the shared chunk only.
+	const Vertex* firstChunkData = &vertices[0];
+	const size_t vertexCount = mesh.GetVertexCount();
+	for(int iVertex = 0; iVertex < 10; ++iVertex)
+	{
+		const VertexIndex vertexIdx = mesh.AddVertex({});
+		mesh.GetVertices()[vertexIdx].Position = { 0.f, 0.f, static_cast<float>(iVertex) };
+	}
+	EXPECT_EQ(&vertices[0], firstChunkData);
+	EXPECT_NE(&vertices[ChunkSize], &snapshot->GetVertices()[ChunkSize]);
+	EXPECT_EQ(snapshot->GetVertexCount(), vertexCount);
+
+	// Building the connectivity writes the vertices and the triangles in place once they are not shared.
+	const Vertex* secondChunkData = &vertices[ChunkSize];
+	const Triangle* triangleData = &mesh.EditTriangles()[0];
+	mesh.UpdateMeshConnectivity();
+	EXPECT_EQ(&vertices[0], firstChunkData);
+	EXPECT_EQ(&vertices[ChunkSize], secondChunkData);
+	EXPECT_EQ(&mesh.GetTriangles()[0], triangleData);
+	EXPECT_EQ(mesh.GetVertexData(static_cast<VertexIndex>(vertexCount + 9)).Position.z, 9.f);
+}
+
+TEST(MeshTest, DeleteVertexAndTriangle_ShouldMarkElements)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	EXPECT_FALSE(mesh.HasGarbage());
+	EXPECT_FALSE(mesh.IsVertexDeleted(4));
+
+	mesh.DeleteVertex(4);
+	mesh.DeleteVertex(4);
+	mesh.DeleteTriangle(1);
+	EXPECT_TRUE(mesh.HasGarbage());
+	EXPECT_TRUE(mesh.IsVertexDeleted(4));
+	EXPECT_FALSE(mesh.IsVertexDeleted(3));
+	EXPECT_TRUE(mesh.IsTriangleDeleted(1));
+	EXPECT_EQ(mesh.GetDeletedVertexCount(), 1);
+	EXPECT_EQ(mesh.GetDeletedTriangleCount(), 1);
+
+	// The deleted elements are kept until the garbage collection, added elements are not deleted.
+	EXPECT_EQ(mesh.GetVertexCount(), 9);
+	const VertexIndex vertexIdx = mesh.AddVertex({ .Position = { 5.f, 5.f, 5.f } });
+	EXPECT_FALSE(mesh.IsVertexDeleted(vertexIdx));
+
+	const Mesh copiedMesh = mesh;
+	EXPECT_TRUE(copiedMesh.IsVertexDeleted(4));
+	EXPECT_EQ(copiedMesh.GetDeletedTriangleCount(), 1);
+}
+
+TEST(MeshTest, GarbageCollect_ShouldCompactAndRemapMesh)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(4, 4);
+	mesh.ComputeTriangleNormals(true);
+	Data::Attribute::AttributeChannel<int>& vertexIds = mesh.AddVertexAttribute<int>("Id");
+	std::iota(vertexIds.GetValues().begin(), vertexIds.GetValues().end(), 0);
+	Data::Attribute::AttributeChannel<int>& triangleIds = mesh.AddTriangleAttribute<int>("Id");
+	std::iota(triangleIds.GetValues().begin(), triangleIds.GetValues().end(), 0);
+	mesh.SetVertexPosition(17, mesh.GetVertexData(17).Position);
+	mesh.SetVertexPosition(7, mesh.GetVertexData(7).Position);
+	mesh.BuildOneRingAdjacency();
+
+	// Remove an interior vertex, with its triangles, and the incident triangle of another vertex.
+	mesh.DeleteVertex(7);
+	mesh.DeleteTriangle(static_cast<TriangleIndex>(mesh.GetVertexData(17).IncidentTriangleIdx));
+	Mesh originalMesh = mesh;
+	const CompactionMaps maps = mesh.GarbageCollect(3);
+
+	EXPECT_FALSE(mesh.HasGarbage());
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	ASSERT_EQ(mesh.GetVertexCount(), originalMesh.GetVertexCount() - 1);
+	ASSERT_EQ(mesh.GetTriangleCount(), originalMesh.GetTriangleCount() - 7);
+	ASSERT_EQ(maps.VertexMap.size(), originalMesh.GetVertexCount());
+	ASSERT_EQ(maps.TriangleMap.size(), originalMesh.GetTriangleCount());
+	EXPECT_EQ(maps.VertexMap[7], -1);
+	EXPECT_EQ(maps.VertexMap[8], 7);
+
+	// Kept elements keep their order and data, the neighbors match the rebuilt connectivity.
+	for(VertexIndex iVertex = 0; iVertex < originalMesh.GetVertexCount(); ++iVertex)
+	{
+		if(maps.VertexMap[iVertex] == -1)
+			continue;
+		const VertexIndex newVertexIdx = static_cast<VertexIndex>(maps.VertexMap[iVertex]);
+		EXPECT_EQ(mesh.GetVertexData(newVertexIdx).Position, originalMesh.GetVertexData(iVertex).Position);
+		EXPECT_EQ((*mesh.GetVertexAttribute<int>("Id"))[newVertexIdx], static_cast<int>(iVertex));
+	}
+	Mesh rebuiltMesh = mesh;
+	rebuiltMesh.UpdateMeshConnectivity();
+	TriangleIndex expectedTriangleIdx = 0;
+	for(TriangleIndex iTriangle = 0; iTriangle < originalMesh.GetTriangleCount(); ++iTriangle)
+	{
+		if(maps.TriangleMap[iTriangle] == -1)
+			continue;
+		ASSERT_EQ(maps.TriangleMap[iTriangle], static_cast<int>(expectedTriangleIdx));
+		const Triangle& curTriangle = mesh.GetTriangleData(expectedTriangleIdx);
+		const Triangle& originalTriangle = originalMesh.GetTriangleData(iTriangle);
+		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			EXPECT_EQ(curTriangle.Vertices[iEdge], maps.VertexMap[originalTriangle.Vertices[iEdge]]);
+		EXPECT_EQ(curTriangle.Neighbors, rebuiltMesh.GetTriangleData(expectedTriangleIdx).Neighbors);
+		EXPECT_EQ(mesh.GetNeighborEdgeSlots()[expectedTriangleIdx].Packed,
+				  rebuiltMesh.GetNeighborEdgeSlots()[expectedTriangleIdx].Packed);
+		EXPECT_EQ((*mesh.GetTriangleAttribute<int>("Id"))[expectedTriangleIdx], static_cast<int>(iTriangle));
+		EXPECT_EQ(mesh.GetTriangle(expectedTriangleIdx).GetExtraData<TriangleNormalExtraData>()->GetData(),
+				  originalMesh.GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>()->GetData());
+		++expectedTriangleIdx;
+	}
+
+	// The dirty vertices of the removed vertex are dropped.
+	ASSERT_EQ(mesh.GetDirtyVertices().size(), 1);
+	EXPECT_EQ(mesh.GetDirtyVertices()[0], static_cast<VertexIndex>(maps.VertexMap[17]));
+}
+
+TEST(MeshTest, GarbageCollect_ShouldNotDependOnThreadCount)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(60, 60);
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); iVertex += 7)
+		mesh.DeleteVertex(iVertex);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); iTriangle += 5)
+		mesh.DeleteTriangle(iTriangle);
+
+	Mesh otherMesh = mesh;
+	const CompactionMaps maps = mesh.GarbageCollect(1);
+	const CompactionMaps otherMaps = otherMesh.GarbageCollect(4);
+	EXPECT_EQ(maps.VertexMap, otherMaps.VertexMap);
+	EXPECT_EQ(maps.TriangleMap, otherMaps.TriangleMap);
+	ASSERT_EQ(mesh.GetTriangleCount(), otherMesh.GetTriangleCount());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Vertices, otherMesh.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Neighbors, otherMesh.GetTriangleData(iTriangle).Neighbors);
+	}
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		EXPECT_EQ(mesh.GetVertexData(iVertex).IncidentTriangleIdx,
+				  otherMesh.GetVertexData(iVertex).IncidentTriangleIdx);
+	}
+
+	// Without garbage, the maps are the identity.
+	const CompactionMaps identityMaps = mesh.GarbageCollect();
+	EXPECT_EQ(identityMaps.VertexMap.size(), mesh.GetVertexCount());
+	for(size_t iVertex = 0; iVertex < identityMaps.VertexMap.size(); ++iVertex)
+		EXPECT_EQ(identityMaps.VertexMap[iVertex], static_cast<int>(iVertex));
+}
+
 TEST(MeshTest, AddVertexAndFace_ShouldReturnCorrectIndices)
 {
 	Mesh mesh;
@@ -86,13 +438,14 @@ TEST(MeshTest, GetVertexAndFaceData_ShouldReturnReferences)
 	EXPECT_EQ(mesh.GetVertexData(0).Position, (Vec3{ 2., 2., 2. }));
 
 	// Get triangle data
-	Triangle& faceData = mesh.GetTriangleData(0);
+	Triangle faceData = mesh.GetTriangleData(0);
 	EXPECT_EQ(faceData.Vertices[0], 0);
 	EXPECT_EQ(faceData.Vertices[1], 1);
 	EXPECT_EQ(faceData.Vertices[2], 2);
 
 	// Modify triangle data
 	faceData.Vertices[0] = 3;
+	mesh.SetTriangleData(0, faceData);
 	EXPECT_EQ(mesh.GetTriangleData(0).Vertices[0], 3);
 }
 
@@ -143,7 +496,9 @@ TEST(MeshTest, Clone_ShouldReturnDeepCopy)
 	originalMesh.GetVertexData(0).Position = { 2., 2., 2. };
 	EXPECT_NE(clonedMesh->GetVertexData(0).Position, originalMesh.GetVertexData(0).Position);
 
-	originalMesh.GetTriangleData(0).Vertices[0] = 3;
+	Triangle editedTriangle = originalMesh.GetTriangleData(0);
+	editedTriangle.Vertices[0] = 3;
+	originalMesh.SetTriangleData(0, editedTriangle);
 	EXPECT_NE(clonedMesh->GetTriangleData(0).Vertices[0], originalMesh.GetTriangleData(0).Vertices[0]);
 }
 
@@ -174,6 +529,137 @@ TEST(MeshTest, AddTriangle_ValidMeshWithED_ShouldAddExtraDataContainer)
 	EXPECT_EQ(mesh.GetTriangle(mesh.GetTriangleCount() - 1).GetExtraData<void>(), nullptr);
 }
 
+TEST(MeshTest, AddTriangle_ShouldReuseEdgeOfNeighbor)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(1, 1);
+	ASSERT_TRUE(mesh.HasEdges());
+	const uint32_t edgeCount = mesh.GetEdgeCount();
+	mesh.AddEdgeAttribute<float>("flag", 1.f);
+
+	// The new triangle shares the edge 1-3 of triangle 0 across its first edge.
+	ASSERT_EQ(mesh.GetTriangleData(0).Vertices, (std::array<int, 3>{ 0, 1, 3 }));
+	const int sharedEdgeIdx = mesh.GetTriangleEdges()[0][0];
+	const VertexIndex newVertexIdx = mesh.AddVertex({ .Position = { 2., 0.5, 0. } });
+	mesh.AddTriangle({ .Vertices = { static_cast<int>(newVertexIdx), 3, 1 }, .Neighbors = { 0, -1, -1 } });
+
+	ASSERT_TRUE(mesh.HasEdges());
+	EXPECT_EQ(mesh.GetEdgeCount(), edgeCount + 2);
+	const std::array<int, 3>& newTriangleEdges = mesh.GetTriangleEdges().back();
+	EXPECT_EQ(newTriangleEdges[0], sharedEdgeIdx);
+	EXPECT_EQ(newTriangleEdges[1], static_cast<int>(edgeCount));
+	EXPECT_EQ(newTriangleEdges[2], static_cast<int>(edgeCount + 1));
+	const Edge& newEdge = mesh.GetEdges()[edgeCount];
+	EXPECT_EQ(newEdge.TriangleIdx, static_cast<int>(mesh.GetTriangleCount() - 1));
+	EXPECT_EQ(newEdge.EdgeIdx, 1);
+
+	// The edge attributes follow the table.
+	const AttributeChannel<float>* flags = mesh.GetEdgeAttribute<float>("flag");
+	ASSERT_NE(flags, nullptr);
+	EXPECT_EQ(flags->GetSize(), edgeCount + 2);
+	EXPECT_EQ((*flags)[edgeCount + 1], 1.f);
+}
+
+TEST(MeshTest, AddTriangle_ShouldNotBuildEdgesOfFreshMesh)
+{
+	Mesh mesh;
+	EXPECT_FALSE(mesh.HasEdges());
+	mesh.AddVertex({ .Position = { 0., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 1., 0. } });
+	mesh.AddVertex({ .Position = { 0., 1., 0. } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 0, 2, 3 } });
+	EXPECT_FALSE(mesh.HasEdges());
+	EXPECT_EQ(mesh.GetEdgeCount(), 0u);
+
+	// The two triangles share the edge 0-2.
+	mesh.UpdateMeshConnectivity();
+	ASSERT_TRUE(mesh.HasEdges());
+	EXPECT_EQ(mesh.GetEdgeCount(), 5u);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshTest, SetTriangleData_ShouldDropEdges)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	ASSERT_TRUE(mesh.HasEdges());
+	mesh.AddEdgeAttribute<float>("flag", 1.f);
+	const Mesh copiedMesh = mesh;
+
+	// Flipping a triangle changes its edges, the stale edge table is dropped.
+	Triangle flippedTriangle = mesh.GetTriangleData(0);
+	std::swap(flippedTriangle.Vertices[1], flippedTriangle.Vertices[2]);
+	mesh.SetTriangleData(0, flippedTriangle);
+	EXPECT_FALSE(mesh.HasEdges());
+	EXPECT_EQ(mesh.GetEdgeCount(), 0u);
+	EXPECT_TRUE(mesh.GetEdges().empty());
+	EXPECT_TRUE(mesh.GetTriangleEdges().empty());
+	ASSERT_TRUE(mesh.HasEdgeAttribute("flag"));
+	EXPECT_EQ(mesh.GetEdgeAttribute<float>("flag")->GetSize(), 0u);
+	EXPECT_TRUE(copiedMesh.HasEdges());
+	EXPECT_EQ(copiedMesh.GetEdgeAttribute<float>("flag")->GetSize(), copiedMesh.GetEdgeCount());
+
+	// Editing all the triangles drops it too, until the connectivity is rebuilt.
+	Mesh editedMesh = copiedMesh;
+	editedMesh.EditTriangles();
+	EXPECT_FALSE(editedMesh.HasEdges());
+	editedMesh.UpdateMeshConnectivity();
+	ASSERT_TRUE(editedMesh.HasEdges());
+	EXPECT_EQ(editedMesh.GetEdgeCount(), copiedMesh.GetEdgeCount());
+	EXPECT_EQ(editedMesh.GetEdgeAttribute<float>("flag")->GetSize(), editedMesh.GetEdgeCount());
+}
+
+TEST(MeshTest, EdgeAttribute_ShouldFollowEdgeTable)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(6, 5);
+	ASSERT_TRUE(mesh.HasEdges());
+
+	// Store the squared length of each edge, to check it is still attached to the same edge.
+	auto GetSquaredLength = [](const Mesh& curMesh, const Edge& curEdge)
+	{
+		const Vec3 vector = curMesh.GetVertexData(curEdge.Vertices[1]).Position -
+							curMesh.GetVertexData(curEdge.Vertices[0]).Position;
+		return glm::dot(vector, vector);
+	};
+	auto ExpectLengths = [&GetSquaredLength](const Mesh& curMesh)
+	{
+		ASSERT_TRUE(curMesh.HasEdges());
+		const AttributeChannel<float>* lengths = curMesh.GetEdgeAttribute<float>("length");
+		ASSERT_NE(lengths, nullptr);
+		ASSERT_EQ(lengths->GetSize(), curMesh.GetEdgeCount());
+		for(uint32_t iEdge = 0; iEdge < curMesh.GetEdgeCount(); ++iEdge)
+			EXPECT_EQ((*lengths)[iEdge], GetSquaredLength(curMesh, curMesh.GetEdges()[iEdge]));
+	};
+	AttributeChannel<float>& lengths = mesh.AddEdgeAttribute<float>("length");
+	for(uint32_t iEdge = 0; iEdge < mesh.GetEdgeCount(); ++iEdge)
+		lengths[iEdge] = GetSquaredLength(mesh, mesh.GetEdges()[iEdge]);
+	EXPECT_TRUE(mesh.HasEdgeAttribute("length"));
+
+	// Removing triangles drops their edges which are not used by a remaining triangle.
+	mesh.DeleteVertex(21);
+	mesh.DeleteTriangle(0);
+	mesh.DeleteTriangle(mesh.GetTriangleCount() - 1);
+	const uint32_t edgeCount = mesh.GetEdgeCount();
+	const CompactionMaps maps = mesh.GarbageCollect();
+	EXPECT_EQ(maps.EdgeMap.size(), edgeCount);
+	EXPECT_LT(mesh.GetEdgeCount(), edgeCount);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	ExpectLengths(mesh);
+
+	// Rebuilding the connectivity renumbers the edges, and keeps their values.
+	mesh.UpdateMeshConnectivity();
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	ExpectLengths(mesh);
+
+	MeshReordering::Reorder(mesh, ReorderingMethod::BreadthFirst);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	ExpectLengths(mesh);
+
+	mesh.RemoveEdgeAttribute("length");
+	EXPECT_FALSE(mesh.HasEdgeAttribute("length"));
+	EXPECT_EQ(mesh.GetEdgeAttributes().GetCount(), 0);
+}
+
 TEST(MeshTest, ComputeTriangleNormals_ShouldComputeEachTriangleNormal)
 {
 	std::unique_ptr<Mesh> mesh = MeshLoader::LoadOFF("TestFiles/Off/cube.off");
@@ -256,6 +742,95 @@ TEST(MeshTest, ComputeSmoothVertexNormals_ShouldComputeEachSmoothVertexNormal)
 	}
 }
 
+TEST(MeshTest, ComputeSmoothVertexNormals_ShouldUseStoredTriangleNormals)
+{
+	// The stored normals of the flat grid (e.g. loaded from a file) are tilted toward +X.
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	mesh.AddTrianglesExtraDataContainer();
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		mesh.GetTriangle(iTriangle).GetOrCreateExtraData<TriangleNormalExtraData>().SetData({ 2.f, 0.f, 2.f });
+
+	const Vec3 tiltedNormal = glm::normalize(Vec3(1.f, 0.f, 1.f));
+	mesh.ComputeSmoothVertexNormals(true);
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const Vec3& curNormal = mesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData();
+		EXPECT_TRUE(EqualNear(curNormal, tiltedNormal, 1e-6f));
+	}
+
+	// Without a stored normal on every triangle, the normals of the positions are used.
+	mesh.GetTriangle(0).EraseExtraData<TriangleNormalExtraData>();
+	mesh.ComputeSmoothVertexNormals(true);
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		EXPECT_EQ(mesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData(), Vec3(0.f, 0.f, 1.f));
+}
+
+TEST(MeshTest, UpdateDirtyNormals_ShouldMatchFullRecomputation)
+{
+	Mesh mesh = TestHelpers::CreateIcosphereMesh(3);
+	mesh.ComputeTriangleNormals(true);
+	mesh.ComputeSmoothVertexNormals(true);
+
+	// Move a few vertices, marking them through each entry point (twice for the last one).
+	mesh.SetVertexPosition(0, mesh.GetVertexData(0).Position * 1.5f);
+	mesh.GetVertex(42).SetPosition(mesh.GetVertexData(42).Position * 0.5f);
+	mesh.GetVertex(100).GetPosition() += Vec3(0.1f, 0.2f, 0.3f);
+	mesh.MarkVertexDirty(100);
+	mesh.MarkVertexDirty(100);
+	EXPECT_EQ(mesh.GetDirtyVertices(), (std::vector<VertexIndex>{ 0, 42, 100 }));
+
+	Mesh expectedMesh(mesh);
+	expectedMesh.ComputeTriangleNormals(true);
+	expectedMesh.ComputeSmoothVertexNormals(true);
+
+	mesh.UpdateDirtyNormals(true);
+	EXPECT_TRUE(mesh.GetDirtyVertices().empty());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(mesh.GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>()->GetData(),
+				  expectedMesh.GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>()->GetData());
+	}
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		EXPECT_EQ(mesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData(),
+				  expectedMesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData());
+	}
+
+	// Vertices can be marked again once updated.
+	mesh.MarkVertexDirty(42);
+	EXPECT_EQ(mesh.GetDirtyVertices(), (std::vector<VertexIndex>{ 42 }));
+	mesh.ClearDirtyVertices();
+	EXPECT_TRUE(mesh.GetDirtyVertices().empty());
+}
+
+TEST(MeshTest, UpdateDirtyNormals_BowtieVertex_ShouldMatchFullRecomputation)
+{
+	// Two triangles sharing the vertex 0 only, one in the XY plane and one in the XZ plane.
+	Mesh mesh;
+	mesh.AddVertex({ .Position = { 0.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 1.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 0.f, 1.f, 0.f } });
+	mesh.AddVertex({ .Position = { -1.f, 0.f, 0.f } });
+	mesh.AddVertex({ .Position = { 0.f, 0.f, -1.f } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 0, 3, 4 } });
+	mesh.UpdateMeshConnectivity();
+	mesh.ComputeTriangleNormals(true);
+	mesh.ComputeSmoothVertexNormals(true);
+
+	mesh.SetVertexPosition(1, { 1.f, 0.f, 0.5f });
+	Mesh expectedMesh(mesh);
+	expectedMesh.ComputeTriangleNormals(true);
+	expectedMesh.ComputeSmoothVertexNormals(true);
+
+	mesh.UpdateDirtyNormals(true);
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		EXPECT_EQ(mesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData(),
+				  expectedMesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData());
+	}
+}
+
 TEST(MeshTest, UpdateVerticesBoudaryStatus_ShouldUpdateEachVertexBoundaryStatus)
 {
 	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
@@ -272,3 +847,18 @@ TEST(MeshTest, UpdateVerticesBoudaryStatus_ShouldUpdateEachVertexBoundaryStatus)
 	EXPECT_TRUE(mesh.GetVertex(7).GetExtraData<IsBoundaryVertexExtraData>()->IsBoundary());
 	EXPECT_TRUE(mesh.GetVertex(8).GetExtraData<IsBoundaryVertexExtraData>()->IsBoundary());
 }
+
+TEST(MeshTest, CreateIcosphereMesh_ShouldBeClosedUnitSphere)
+{
+	Mesh mesh = TestHelpers::CreateIcosphereMesh(2);
+	EXPECT_EQ(mesh.GetVertexCount(), 162);
+	EXPECT_EQ(mesh.GetTriangleCount(), 320);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	mesh.UpdateVerticesBoundaryStatus();
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		EXPECT_NEAR(glm::length(mesh.GetVertexData(iVertex).Position), 1.f, 1.e-5f);
+		EXPECT_FALSE(mesh.GetVertex(iVertex).GetExtraData<IsBoundaryVertexExtraData>()->IsBoundary());
+	}
+}
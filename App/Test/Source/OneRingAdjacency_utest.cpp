@@ -0,0 +1,105 @@
+#include "Application/OneRingAdjacency.h"
+
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Check that the adjacency matches the circulators of the mesh.
+void ExpectSameAsCirculators(const Mesh& mesh, const OneRingAdjacency& adjacency)
+{
+	ASSERT_EQ(adjacency.GetVertexCount(), mesh.GetVertexCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		std::vector<VertexIndex> expectedVertices;
+		for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+			expectedVertices.push_back(curVertexIdx);
+		std::vector<TriangleIndex> expectedTriangles;
+		for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertex(iVertex))
+			expectedTriangles.push_back(curTriangleIdx);
+
+		EXPECT_TRUE(std::ranges::equal(adjacency.GetVerticesAroundVertex(iVertex), expectedVertices));
+		EXPECT_TRUE(std::ranges::equal(adjacency.GetTrianglesAroundVertex(iVertex), expectedTriangles));
+	}
+}
+} // namespace
+
+TEST(OneRingAdjacencyTest, Build_ShouldMatchCirculators)
+{
+	const Mesh gridMesh = TestHelpers::CreateGridMesh(3, 2);
+	const OneRingAdjacency gridAdjacency = OneRingAdjacency::Build(gridMesh);
+	ExpectSameAsCirculators(gridMesh, gridAdjacency);
+
+	// Interior vertex 4 of the grid has 6 neighbors, corner vertex 0 has 2 triangles.
+	EXPECT_EQ(gridAdjacency.GetVerticesAroundVertex(4).size(), 6);
+	EXPECT_EQ(gridAdjacency.GetTrianglesAroundVertex(0).size(), 2);
+	EXPECT_EQ(gridAdjacency.GetTriangleOffsets().back(), 3 * gridMesh.GetTriangleCount());
+
+	// Several threads on a closed mesh.
+	const Mesh sphereMesh = TestHelpers::CreateIcosphereMesh(4);
+	const OneRingAdjacency sphereAdjacency = OneRingAdjacency::Build(sphereMesh, 4);
+	ExpectSameAsCirculators(sphereMesh, sphereAdjacency);
+	EXPECT_EQ(sphereAdjacency.GetVertices().size(), 3 * sphereMesh.GetTriangleCount());
+}
+
+TEST(OneRingAdjacencyTest, Build_IsolatedVertex_ShouldHaveEmptyOneRing)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(1, 1);
+	const VertexIndex isolatedVertexIdx = mesh.AddVertex({ .Position = { 5.f, 5.f, 5.f } });
+
+	const OneRingAdjacency adjacency = OneRingAdjacency::Build(mesh);
+	EXPECT_TRUE(adjacency.GetVerticesAroundVertex(isolatedVertexIdx).empty());
+	EXPECT_TRUE(adjacency.GetTrianglesAroundVertex(isolatedVertexIdx).empty());
+	EXPECT_EQ(adjacency.GetVertexOffsets().size(), mesh.GetVertexCount() + 1);
+}
+
+TEST(OneRingAdjacencyTest, MeshCache_ShouldBeDroppedOnTopologyEdits)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+
+	const OneRingAdjacency& adjacency = mesh.BuildOneRingAdjacency();
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), &adjacency);
+	EXPECT_EQ(&mesh.BuildOneRingAdjacency(), &adjacency);
+
+	// Copies share the cache, moving a vertex keeps it.
+	Mesh copy(mesh);
+	EXPECT_EQ(copy.GetOneRingAdjacency(), &adjacency);
+	mesh.SetVertexPosition(0, Vec3(-1.f, -1.f, 0.f));
+	EXPECT_NE(mesh.GetOneRingAdjacency(), nullptr);
+
+	mesh.AddVertex({ .Position = { 5.f, 5.f, 5.f } });
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+	EXPECT_EQ(copy.GetOneRingAdjacency(), &adjacency);
+
+	mesh.BuildOneRingAdjacency();
+	mesh.AddTriangle({ .Vertices = { 2, 9, 5 } });
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+
+	mesh.BuildOneRingAdjacency();
+	mesh.UpdateMeshConnectivity();
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+	ExpectSameAsCirculators(mesh, mesh.BuildOneRingAdjacency());
+
+	// Reading the triangles keeps the cache, editing them drops it.
+	mesh.BuildOneRingAdjacency();
+	mesh.GetTriangleData(0);
+	mesh.GetTriangles();
+	mesh.GetTriangle(0).GetTriangle();
+	EXPECT_NE(mesh.GetOneRingAdjacency(), nullptr);
+	mesh.SetTriangleData(0, mesh.GetTriangleData(0));
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+	mesh.BuildOneRingAdjacency();
+	mesh.GetTriangle(0).SetTriangle(mesh.GetTriangleData(0));
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+	mesh.BuildOneRingAdjacency();
+	mesh.EditTriangles();
+	EXPECT_EQ(mesh.GetOneRingAdjacency(), nullptr);
+}
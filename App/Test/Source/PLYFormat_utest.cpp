@@ -0,0 +1,201 @@
+#include "Application/PLYFormat.h"
+
+#include "Application/ExtraDataType.h"
+#include "Application/MeshExporter.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshLoader.h"
+#include "Application/PrimitiveProxy.h"
+#include "Application/TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::Primitive;
+using namespace Data::ExtraData;
+using namespace Core::BaseType;
+
+namespace
+{
+/// @brief Create a grid mesh with smooth normals, colors and qualities on every vertex.
+Mesh CreateGridMeshWithAttributes()
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(3, 2);
+	mesh.AddVerticesExtraDataContainer();
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const VertexProxy curVertex = mesh.GetVertex(iVertex);
+		const float ratio = static_cast<float>(iVertex) / static_cast<float>(mesh.GetVertexCount());
+		curVertex.GetOrCreateExtraData<SmoothVertexNormalExtraData>().SetData({ 0.f, ratio, 1.f });
+		// Colors are multiples of 1/255 to be stored exactly on 8 bits.
+		curVertex.GetOrCreateExtraData<VertexColorExtraData>().SetData(
+			{ static_cast<float>(iVertex) / 255.f, 1.f, 0.f, 128.f / 255.f });
+		curVertex.GetOrCreateExtraData<VertexQualityExtraData>().SetData(ratio * 10.f);
+	}
+	return mesh;
+}
+} // namespace
+
+TEST(PLYFormatTest, ParseHeader_ShouldDescribeElements)
+{
+	constexpr std::string_view data = "ply\n"
+									  "format binary_big_endian 1.0\n"
+									  "comment made by hand\n"
+									  "element vertex 8\n"
+									  "property float x\n"
+									  "property float32 y\n"
+									  "property double z\n"
+									  "property uchar red\n"
+									  "element face 6\n"
+									  "property list uint8 int32 vertex_indices\n"
+									  "end_header\n";
+
+	PLYFormat::Header header;
+	ASSERT_TRUE(PLYFormat::ParseHeader(data, header));
+	EXPECT_EQ(header.Format, PLYFormat::Encoding::BinaryBigEndian);
+	EXPECT_EQ(header.DataOffset, data.size());
+	ASSERT_EQ(header.Elements.size(), 2);
+
+	const PLYFormat::Element& vertexElement = header.Elements[header.FindElement("vertex")];
+	EXPECT_EQ(vertexElement.Count, 8);
+	EXPECT_EQ(vertexElement.GetFixedStride(), 4 + 4 + 8 + 1);
+	EXPECT_EQ(vertexElement.GetPropertyOffset(vertexElement.FindProperty("red")), 16);
+	EXPECT_EQ(vertexElement.FindProperty("nx"), -1);
+
+	const PLYFormat::Element& faceElement = header.Elements[header.FindElement("face")];
+	EXPECT_EQ(faceElement.GetFixedStride(), 0);
+	ASSERT_EQ(faceElement.Properties.size(), 1);
+	EXPECT_TRUE(faceElement.Properties[0].IsList);
+	EXPECT_EQ(faceElement.Properties[0].CountType, PLYFormat::ScalarType::UInt8);
+	EXPECT_EQ(faceElement.Properties[0].Type, PLYFormat::ScalarType::Int32);
+
+	// Missing end_header, unknown encoding and unknown type.
+	EXPECT_FALSE(PLYFormat::ParseHeader("ply\nformat ascii 1.0\nelement vertex 1\n", header));
+	EXPECT_FALSE(PLYFormat::ParseHeader("ply\nformat binary 1.0\nend_header\n", header));
+	EXPECT_FALSE(
+		PLYFormat::ParseHeader("ply\nformat ascii 1.0\nelement vertex 1\nproperty half x\nend_header\n", header));
+}
+
+TEST(PLYFormatTest, ExportPLY_LoadPLY_ShouldRoundTripAttributes)
+{
+	Mesh mesh = CreateGridMeshWithAttributes();
+
+	for(PLYFormat::Encoding curEncoding : { PLYFormat::Encoding::Ascii,
+											PLYFormat::Encoding::BinaryLittleEndian,
+											PLYFormat::Encoding::BinaryBigEndian })
+	{
+		const std::filesystem::path filepath = std::filesystem::relative("TestFiles/gridMeshWithAttributes.ply");
+		MeshExporter::ExportPLY(mesh, filepath, curEncoding);
+
+		LoadStatistics statistics;
+		std::unique_ptr<Mesh> loadedMesh = MeshLoader::LoadPLY(filepath, &statistics);
+		ASSERT_NE(loadedMesh, nullptr);
+		EXPECT_EQ(MeshIntegrity::CheckIntegrity(*loadedMesh), MeshIntegrity::ExitCode::MeshOK);
+		EXPECT_EQ(statistics.ByteCount, std::filesystem::file_size(filepath));
+
+		ASSERT_EQ(loadedMesh->GetVertexCount(), mesh.GetVertexCount());
+		ASSERT_EQ(loadedMesh->GetTriangleCount(), mesh.GetTriangleCount());
+		for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		{
+			EXPECT_EQ(loadedMesh->GetTriangleData(iTriangle).Vertices, mesh.GetTriangleData(iTriangle).Vertices);
+			EXPECT_EQ(loadedMesh->GetTriangleData(iTriangle).Neighbors, mesh.GetTriangleData(iTriangle).Neighbors);
+		}
+
+		ASSERT_TRUE(loadedMesh->HasVerticesExtraDataContainer());
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			const VertexProxy expectedVertex = mesh.GetVertex(iVertex);
+			const VertexProxy loadedVertex = loadedMesh->GetVertex(iVertex);
+			EXPECT_EQ(loadedMesh->GetVertexData(iVertex).Position, mesh.GetVertexData(iVertex).Position);
+
+			const auto* normal = loadedVertex.GetExtraData<SmoothVertexNormalExtraData>();
+			const auto* color = loadedVertex.GetExtraData<VertexColorExtraData>();
+			const auto* quality = loadedVertex.GetExtraData<VertexQualityExtraData>();
+			ASSERT_NE(normal, nullptr);
+			ASSERT_NE(color, nullptr);
+			ASSERT_NE(quality, nullptr);
+
+			const Vec3& expectedNormal = expectedVertex.GetExtraData<SmoothVertexNormalExtraData>()->GetData();
+			const Vec4& expectedColor = expectedVertex.GetExtraData<VertexColorExtraData>()->GetData();
+			// The floats are read back exactly, in ASCII too.
+			EXPECT_EQ(normal->GetData(), expectedNormal);
+			for(int iChannel = 0; iChannel < 4; ++iChannel)
+				EXPECT_NEAR(color->GetData()[iChannel], expectedColor[iChannel], 1.e-6f);
+			EXPECT_EQ(quality->GetData(), expectedVertex.GetExtraData<VertexQualityExtraData>()->GetData());
+		}
+	}
+}
+
+TEST(PLYFormatTest, LoadPLY_AsciiPolygons_ShouldTriangulateAndSkipOtherElements)
+{
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/quad.ply");
+	{
+		std::ofstream file(filepath, std::ios::trunc);
+		file << "ply\n"
+				"format ascii 1.0\n"
+				"comment unit square\n"
+				"element vertex 4\n"
+				"property double x\n"
+				"property double y\n"
+				"property double z\n"
+				"property float confidence\n"
+				"element face 1\n"
+				"property list uchar uint vertex_index\n"
+				"property uchar flags\n"
+				"element edge 1\n"
+				"property int vertex1\n"
+				"property int vertex2\n"
+				"end_header\n"
+				"0 0 0 0.5\n"
+				"1 0 0 0.5\n"
+				"1 1 0 0.5\n"
+				"0 1 0 1\n"
+				"4 0 1 2 3 7\n"
+				"0 2\n";
+	}
+
+	std::unique_ptr<Mesh> mesh = MeshLoader::LoadPLY(filepath);
+	ASSERT_NE(mesh, nullptr);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	ASSERT_EQ(mesh->GetVertexCount(), 4);
+	ASSERT_EQ(mesh->GetTriangleCount(), 2);
+	EXPECT_EQ(mesh->GetTriangleData(0).Vertices, (std::array<int, 3>{ 0, 1, 2 }));
+	EXPECT_EQ(mesh->GetTriangleData(1).Vertices, (std::array<int, 3>{ 0, 2, 3 }));
+
+	// The confidence is read as quality, no other attribute is set.
+	const VertexProxy lastVertex = mesh->GetVertex(3);
+	ASSERT_NE(lastVertex.GetExtraData<VertexQualityExtraData>(), nullptr);
+	EXPECT_FLOAT_EQ(lastVertex.GetExtraData<VertexQualityExtraData>()->GetData(), 1.f);
+	EXPECT_EQ(lastVertex.GetExtraData<VertexColorExtraData>(), nullptr);
+	EXPECT_EQ(lastVertex.GetExtraData<SmoothVertexNormalExtraData>(), nullptr);
+}
+
+TEST(PLYFormatTest, LoadPLY_InvalidFile_ShouldReturnNullptr)
+{
+	// Missing file.
+	EXPECT_EQ(MeshLoader::LoadPLY(std::filesystem::relative("TestFiles/missing.ply")), nullptr);
+
+	// Not a PLY file.
+	EXPECT_EQ(MeshLoader::LoadPLY(std::filesystem::relative("TestFiles/Off/cube.off")), nullptr);
+
+	// Truncated file.
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	const std::filesystem::path filepath = std::filesystem::relative("TestFiles/truncated.ply");
+	MeshExporter::ExportPLY(mesh, filepath);
+	std::filesystem::resize_file(filepath, std::filesystem::file_size(filepath) - 1);
+	EXPECT_EQ(MeshLoader::LoadPLY(filepath), nullptr);
+
+	// Vertex count too large for the file, in ASCII and binary.
+	for(const char* curFormat : { "ascii", "binary_little_endian" })
+	{
+		const std::filesystem::path hugeFilepath = std::filesystem::relative("TestFiles/hugeCount.ply");
+		std::ofstream file(hugeFilepath, std::ios::binary | std::ios::trunc);
+		file << "ply\nformat " << curFormat << " 1.0\nelement vertex 2000000000\n";
+		file << "property float x\nproperty float y\nproperty float z\nend_header\n0 0 0\n";
+		file.close();
+		EXPECT_EQ(MeshLoader::LoadPLY(hugeFilepath), nullptr);
+	}
+}
@@ -42,8 +42,9 @@ TEST(PrimitiveProxyTest, FaceProxy_ValidFace_ShouldBeValid)
 	EXPECT_EQ(faceProxy.GetNeighbor(1), 1);
 	EXPECT_EQ(faceProxy.GetNeighbors(), (std::array<int, 3>{ -1, 1, -1 }));
 
-	Triangle& triangle = faceProxy.GetTriangle();
+	Triangle triangle = faceProxy.GetTriangle();
 	triangle.Vertices[0] = 3;
+	faceProxy.SetTriangle(triangle);
 	EXPECT_EQ(faceProxy.GetVertex(0), 3);
 }
 
@@ -59,3 +59,34 @@ TEST(PrimitiveTest, GetVertexLocalIndex_InvalidVertex_ShouldReturnMinusOne)
 		EXPECT_EQ(GetVertexLocalIndex(triangle, 6), -1);
 	}
 }
+
+TEST(PrimitiveTest, NeighborEdgeSlots_ShouldPackEachEdge)
+{
+	NeighborEdgeSlots slots;
+	for(Core::BaseType::EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+		EXPECT_EQ(slots.Get(iEdge), NeighborEdgeSlots::NoEdge);
+
+	slots.Set(0, 2);
+	slots.Set(1, 0);
+	slots.Set(2, 1);
+	EXPECT_EQ(slots.Get(0), 2);
+	EXPECT_EQ(slots.Get(1), 0);
+	EXPECT_EQ(slots.Get(2), 1);
+
+	slots.Set(1, NeighborEdgeSlots::NoEdge);
+	EXPECT_EQ(slots.Get(0), 2);
+	EXPECT_EQ(slots.Get(1), NeighborEdgeSlots::NoEdge);
+	EXPECT_EQ(slots.Get(2), 1);
+}
+
+TEST(PrimitiveTest, GetVertexLocalIndexInNeighbor_ShouldMatchVertexSearch)
+{
+	// The edge 1-2 is the edge 0 of the triangle and the edge 2 of its neighbor.
+	Triangle triangle{ .Vertices = { 0, 1, 2 } };
+	Triangle neighbor{ .Vertices = { 2, 1, 3 } };
+
+	EXPECT_EQ(GetVertexLocalIndexInNeighbor(0, 2, 1), GetVertexLocalIndex(neighbor, 1));
+	EXPECT_EQ(GetVertexLocalIndexInNeighbor(0, 2, 2), GetVertexLocalIndex(neighbor, 2));
+	EXPECT_EQ(GetEdgeIndex(triangle, 1, 2), 0);
+	EXPECT_EQ(GetEdgeIndex(neighbor, 1, 2), 2);
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Core/Hash.h"
+
 #include <glm/glm.hpp>
 
 #define GLM_ENABLE_EXPERIMENTAL
@@ -33,9 +35,7 @@ struct hash<Core::BaseType::Vec2>
 {
 	size_t operator()(const Core::BaseType::Vec2& elt) const
 	{
-		auto h1 = std::hash<Core::BaseType::VertexIndex>{}(elt.x);
-		auto h2 = std::hash<Core::BaseType::VertexIndex>{}(elt.y);
-		return h1 ^ h2;
+		return Core::Hash::HashVector(elt);
 	}
 };
 
@@ -45,10 +45,7 @@ struct hash<Core::BaseType::Vec3>
 {
 	size_t operator()(const Core::BaseType::Vec3& elt) const
 	{
-		auto h1 = std::hash<Core::BaseType::VertexIndex>{}(elt.x);
-		auto h2 = std::hash<Core::BaseType::VertexIndex>{}(elt.y);
-		auto h3 = std::hash<Core::BaseType::VertexIndex>{}(elt.z);
-		return h1 ^ h2 ^ h3;
+		return Core::Hash::HashVector(elt);
 	}
 };
 } // namespace std
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Core::Container
+{
+/// @brief Dynamic array of bits, packed in 64-bit words.
+/// @note The bits past the size in the last word are kept to zero, so words can be scanned without masking.
+class BitArray
+{
+public:
+	/// @brief Type of the words storing the bits.
+	using WordType = uint64_t;
+	/// @brief Number of bits in a word.
+	static constexpr size_t WordBitCount = 64;
+
+public:
+	/// @brief Default ctor.
+	BitArray() = default;
+
+	/// @brief Construct an array of the given size, with every bit to zero.
+	explicit BitArray(size_t size)
+		: m_Words(GetWordCount(size), 0)
+		, m_Size(size)
+	{}
+
+	/// @brief Get the number of bits.
+	size_t GetSize() const { return m_Size; }
+
+	/// @brief Resize the array, new bits being set to zero.
+	void Resize(size_t size)
+	{
+		m_Words.resize(GetWordCount(size), 0);
+		m_Size = size;
+		ClearTrailingBits();
+	}
+
+	/// @brief Get the bit at the given index.
+	bool Get(size_t index) const
+	{
+		assert(index < m_Size && "Index out of bound");
+		return (m_Words[index / WordBitCount] >> (index % WordBitCount)) & 1;
+	}
+
+	/// @brief Set the bit at the given index to one.
+	void Set(size_t index)
+	{
+		assert(index < m_Size && "Index out of bound");
+		m_Words[index / WordBitCount] |= GetMask(index);
+	}
+
+	/// @brief Set the bit at the given index to one, other threads setting bits of the same word concurrently.
+	void SetAtomic(size_t index)
+	{
+		assert(index < m_Size && "Index out of bound");
+		std::atomic_ref<WordType>(m_Words[index / WordBitCount]).fetch_or(GetMask(index), std::memory_order_relaxed);
+	}
+
+	/// @brief Set the bit at the given index to zero.
+	void Reset(size_t index)
+	{
+		assert(index < m_Size && "Index out of bound");
+		m_Words[index / WordBitCount] &= ~GetMask(index);
+	}
+
+	/// @brief Set every bit to the given value.
+	void Fill(bool value)
+	{
+		std::ranges::fill(m_Words, value ? ~WordType(0) : WordType(0));
+		ClearTrailingBits();
+	}
+
+	/// @brief Get the number of bits set to one.
+	size_t Count() const
+	{
+		size_t count = 0;
+		for(WordType curWord : m_Words)
+			count += static_cast<size_t>(std::popcount(curWord));
+		return count;
+	}
+
+	/// @brief Get the index of the first bit set to one from the given index, or the size if there is none.
+	size_t FindNext(size_t index) const
+	{
+		if(index >= m_Size)
+			return m_Size;
+
+		size_t wordIdx = index / WordBitCount;
+		WordType curWord = m_Words[wordIdx] & (~WordType(0) << (index % WordBitCount));
+		while(curWord == 0)
+		{
+			if(++wordIdx == m_Words.size())
+				return m_Size;
+			curWord = m_Words[wordIdx];
+		}
+		return wordIdx * WordBitCount + static_cast<size_t>(std::countr_zero(curWord));
+	}
+
+	/// @brief Get the words storing the bits, bit i being bit (i % 64) of word (i / 64).
+	/// @note Threads can write different words concurrently, the bits past the size must be left to zero.
+	std::span<WordType> GetWords() { return m_Words; }
+	/// @brief Get the words storing the bits (const version).
+	std::span<const WordType> GetWords() const { return m_Words; }
+
+	/// @brief Get the number of words needed to store the given number of bits.
+	static size_t GetWordCount(size_t size) { return (size + WordBitCount - 1) / WordBitCount; }
+
+private:
+	/// @brief Get the mask of a bit in its word.
+	static WordType GetMask(size_t index) { return WordType(1) << (index % WordBitCount); }
+
+	/// @brief Set the bits past the size in the last word to zero.
+	void ClearTrailingBits()
+	{
+		if(m_Size % WordBitCount != 0)
+			m_Words.back() &= (WordType(1) << (m_Size % WordBitCount)) - 1;
+	}
+
+private:
+	/// @brief Words storing the bits.
+	std::vector<WordType> m_Words{};
+	/// @brief Number of bits.
+	size_t m_Size{ 0 };
+};
+} // namespace Core::Container
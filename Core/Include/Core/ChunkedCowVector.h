@@ -0,0 +1,611 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Core::Container
+{
+template<typename T>
+class ChunkedCowVector;
+
+/// @brief View over values stored contiguously, or in the fixed-size chunks of a ChunkedCowVector.
+/// @note Like std::span, it does not own the values and is cheap to copy. Contiguous values are accessed directly,
+/// the other ones through the table of the chunks.
+template<typename T>
+class ChunkedSpan
+{
+public:
+	/// @brief Number of values of each chunk, the last one may have less.
+	static constexpr size_t ChunkSize = 4096;
+
+	/// @brief Random access iterator over the values.
+	class Iterator
+	{
+	public:
+		using iterator_concept = std::random_access_iterator_tag;
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = std::remove_cv_t<T>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+
+	public:
+		/// @brief Default ctor.
+		Iterator() = default;
+
+		/// @brief Construct an iterator on the value at the given index of the contiguous values or of the chunks.
+		Iterator(T* data, T* const* chunks, size_t index)
+			: m_Data(data)
+			, m_Chunks(chunks)
+			, m_Index(index)
+		{}
+
+		reference operator*() const
+		{
+			return m_Data != nullptr ? m_Data[m_Index] : m_Chunks[m_Index / ChunkSize][m_Index % ChunkSize];
+		}
+		pointer operator->() const { return &**this; }
+		reference operator[](difference_type offset) const { return *(*this + offset); }
+
+		Iterator& operator++()
+		{
+			++m_Index;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			Iterator previous = *this;
+			++m_Index;
+			return previous;
+		}
+		Iterator& operator--()
+		{
+			--m_Index;
+			return *this;
+		}
+		Iterator operator--(int)
+		{
+			Iterator previous = *this;
+			--m_Index;
+			return previous;
+		}
+		Iterator& operator+=(difference_type offset)
+		{
+			m_Index += offset;
+			return *this;
+		}
+		Iterator& operator-=(difference_type offset)
+		{
+			m_Index -= offset;
+			return *this;
+		}
+
+		friend Iterator operator+(Iterator iterator, difference_type offset) { return iterator += offset; }
+		friend Iterator operator+(difference_type offset, Iterator iterator) { return iterator += offset; }
+		friend Iterator operator-(Iterator iterator, difference_type offset) { return iterator -= offset; }
+		friend difference_type operator-(const Iterator& first, const Iterator& second)
+		{
+			return static_cast<difference_type>(first.m_Index - second.m_Index);
+		}
+		friend bool operator==(const Iterator& first, const Iterator& second)
+		{
+			return first.m_Index == second.m_Index;
+		}
+		friend std::strong_ordering operator<=>(const Iterator& first, const Iterator& second)
+		{
+			return first.m_Index <=> second.m_Index;
+		}
+
+	private:
+		/// @brief Contiguous values, or nullptr if they are in chunks.
+		T* m_Data{ nullptr };
+		/// @brief First value of each chunk, if the values are not contiguous.
+		T* const* m_Chunks{ nullptr };
+		/// @brief Index of the value in the contiguous values or in the chunks.
+		size_t m_Index{ 0 };
+	};
+
+public:
+	/// @brief Default ctor, for an empty view.
+	ChunkedSpan() = default;
+
+	/// @brief Construct a view over contiguous values (vector, array or span).
+	template<std::ranges::contiguous_range Range>
+		requires std::ranges::sized_range<Range>
+				 && std::is_convertible_v<std::remove_reference_t<std::ranges::range_reference_t<Range>> (*)[], T (*)[]>
+				 && (std::is_const_v<T> || std::ranges::borrowed_range<Range>)
+	ChunkedSpan(Range&& values)
+		: m_Data(std::ranges::data(values))
+		, m_Size(std::ranges::size(values))
+	{}
+
+	/// @brief Construct a view over constant values from a view over the same values.
+	template<typename U>
+		requires std::is_same_v<const U, T> && (!std::is_same_v<U, T>)
+	ChunkedSpan(const ChunkedSpan<U>& other)
+		: m_Data(other.m_Data)
+		, m_Chunks(other.m_Chunks)
+		, m_Offset(other.m_Offset)
+		, m_Size(other.m_Size)
+	{}
+
+	/// @brief Get the number of values.
+	size_t size() const { return m_Size; }
+	/// @brief Check if there is no value.
+	bool empty() const { return m_Size == 0; }
+	/// @brief Check if the values are contiguous.
+	bool IsContiguous() const { return m_Chunks == nullptr; }
+
+	/// @brief Get the value at the given index.
+	T& operator[](size_t index) const
+	{
+		assert(index < m_Size && "Index out of bound");
+		if(m_Data != nullptr)
+			return m_Data[index];
+
+		const size_t chunkedIdx = m_Offset + index;
+		return m_Chunks[chunkedIdx / ChunkSize][chunkedIdx % ChunkSize];
+	}
+
+	/// @brief Get the contiguous values starting at the given index, up to the end of its chunk.
+	std::span<T> GetContiguousValues(size_t index) const
+	{
+		assert(index < m_Size && "Index out of bound");
+		if(m_Data != nullptr)
+			return { m_Data + index, m_Size - index };
+
+		const size_t chunkedIdx = m_Offset + index;
+		const size_t valueCount = std::min(ChunkSize - chunkedIdx % ChunkSize, m_Size - index);
+		return { m_Chunks[chunkedIdx / ChunkSize] + chunkedIdx % ChunkSize, valueCount };
+	}
+
+	/// @brief Get the view over the given number of values, starting at the given index.
+	ChunkedSpan subspan(size_t offset, size_t count) const
+	{
+		assert(offset + count <= m_Size && "Index out of bound");
+		ChunkedSpan view = *this;
+		if(m_Data != nullptr)
+			view.m_Data += offset;
+		else
+			view.m_Offset += offset;
+		view.m_Size = count;
+		return view;
+	}
+
+	/// @brief Get the first value.
+	Iterator begin() const { return Iterator(m_Data, m_Chunks, m_Offset); }
+	/// @brief Get past the last value.
+	Iterator end() const { return Iterator(m_Data, m_Chunks, m_Offset + m_Size); }
+
+private:
+	template<typename U>
+	friend class ChunkedSpan;
+	friend class ChunkedCowVector<std::remove_const_t<T>>;
+
+	/// @brief Construct a view over the values of the given chunks, all of them full except the last one.
+	ChunkedSpan(T* const* chunks, size_t size)
+		: m_Chunks(chunks)
+		, m_Size(size)
+	{}
+
+private:
+	/// @brief Contiguous values, or nullptr if they are in chunks.
+	T* m_Data{ nullptr };
+	/// @brief First value of each chunk, if the values are not contiguous.
+	T* const* m_Chunks{ nullptr };
+	/// @brief Index in the chunks of the first value of the view.
+	size_t m_Offset{ 0 };
+	/// @brief Number of values.
+	size_t m_Size{ 0 };
+};
+
+/// @brief Vector split into fixed-size chunks, which are shared with its copies until one of them is modified
+/// (copy-on-write per chunk).
+/// @note Copies share every chunk. Write(index) copies the chunk of the value first if it is shared, so editing a few
+/// values of a copy duplicates their chunks only. The values of a vector given as a whole are not copied: its chunks
+/// point into it, and the values are contiguous until a chunk is copied. emplace_back adds the values to this storage
+/// while the vector owns it, so they stay contiguous. A reference or a view obtained through Write must not be used
+/// after the vector is copied or resized.
+template<typename T>
+class ChunkedCowVector
+{
+public:
+	/// @brief Number of values of each chunk, the last one may have less.
+	static constexpr size_t ChunkSize = ChunkedSpan<T>::ChunkSize;
+
+public:
+	/// @brief Default ctor.
+	ChunkedCowVector() = default;
+
+	/// @brief Construct a vector taking the ownership of the given values, without copying them.
+	explicit ChunkedCowVector(std::vector<T>&& values) { Assign(std::make_shared<std::vector<T>>(std::move(values))); }
+
+	/// @brief Copy ctor, sharing every chunk.
+	ChunkedCowVector(const ChunkedCowVector& other) = default;
+	/// @brief Move ctor, leaving the other vector empty.
+	ChunkedCowVector(ChunkedCowVector&& other) noexcept
+		: m_Chunks(std::move(other.m_Chunks))
+		, m_ChunkData(std::move(other.m_ChunkData))
+		, m_Size(std::exchange(other.m_Size, 0))
+		, m_IsContiguous(std::exchange(other.m_IsContiguous, true))
+	{}
+
+	/// @brief Copy assignment, sharing every chunk.
+	ChunkedCowVector& operator=(const ChunkedCowVector& other) = default;
+	/// @brief Move assignment, leaving the other vector empty.
+	ChunkedCowVector& operator=(ChunkedCowVector&& other) noexcept
+	{
+		m_Chunks = std::move(other.m_Chunks);
+		m_ChunkData = std::move(other.m_ChunkData);
+		m_Size = std::exchange(other.m_Size, 0);
+		m_IsContiguous = std::exchange(other.m_IsContiguous, true);
+		other.m_Chunks.clear();
+		other.m_ChunkData.clear();
+		return *this;
+	}
+
+	/// @brief Get a view over the values, without copying them.
+	ChunkedSpan<const T> Read() const
+	{
+		if(m_IsContiguous)
+			return { std::span<const T>(m_Chunks.empty() ? nullptr : m_ChunkData[0], m_Size) };
+		return { m_ChunkData.data(), m_Size };
+	}
+
+	/// @brief Implicit conversion to a view over the values, for read-only use.
+	operator ChunkedSpan<const T>() const { return Read(); }
+
+	/// @brief Get a view to modify the values, copying first the chunks shared with another vector.
+	/// @note The chunks are not merged, the view is contiguous only if the values are. Unlike ChunkedWriteSpan, the
+	/// view can be written from several threads.
+	ChunkedSpan<T> Write()
+	{
+		for(size_t iChunk = 0; iChunk < m_Chunks.size(); ++iChunk)
+			WriteChunk(iChunk);
+		if(m_IsContiguous)
+			return { std::span<T>(m_Chunks.empty() ? nullptr : m_ChunkData[0], m_Size) };
+		return { m_ChunkData.data(), m_Size };
+	}
+
+	/// @brief Get the value at the given index to modify it, copying its chunk first if it is shared.
+	T& Write(size_t index)
+	{
+		assert(index < m_Size && "Index out of bound");
+		return WriteChunk(index / ChunkSize)[index % ChunkSize];
+	}
+
+	/// @brief Move the values out of the vector, which is left empty.
+	/// @note The values are copied only if they are shared with another vector or not contiguous.
+	std::vector<T> Extract()
+	{
+		std::vector<T> values;
+		// The storage can be taken if only the chunks of this vector point into it.
+		if(m_IsContiguous && !m_Chunks.empty() && !IsShared()
+		   && m_Chunks[0]->Storage.use_count() == static_cast<long>(m_Chunks.size())
+		   && m_Chunks[0]->Storage->size() == m_Size)
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+			values = std::move(*m_Chunks[0]->Storage);
+		}
+		else
+			values.assign(begin(), end());
+		*this = {};
+		return values;
+	}
+
+	/// @brief Add a value constructed from the given arguments at the end of the vector.
+	/// @return Reference to the added value.
+	template<typename... Args>
+	T& emplace_back(Args&&... args)
+	{
+		if(CanGrowStorage())
+		{
+			// The value is added to the storage of the chunks, which stay contiguous.
+			std::atomic_thread_fence(std::memory_order_acquire);
+			std::vector<T>& storage = *m_Chunks.front()->Storage;
+			const T* previousData = storage.data();
+			T& addedValue = storage.emplace_back(std::forward<Args>(args)...);
+			if(m_Size % ChunkSize == 0)
+			{
+				m_Chunks.push_back(std::make_shared<Chunk>(Chunk{ .Storage = m_Chunks.front()->Storage }));
+				m_ChunkData.push_back(nullptr);
+			}
+			PointChunksIntoStorage(storage.data() != previousData ? 0 : m_Chunks.size() - 1);
+			++m_Size;
+			return addedValue;
+		}
+
+		if(m_Size % ChunkSize == 0)
+		{
+			// Start a new chunk.
+			auto storage = std::make_shared<std::vector<T>>();
+			m_Chunks.push_back(std::make_shared<Chunk>(Chunk{ .Storage = storage, .Data = nullptr }));
+			m_ChunkData.push_back(nullptr);
+			m_IsContiguous = m_Chunks.size() == 1;
+		}
+		else if(!IsOwnedChunk(m_Chunks.back()))
+			CopyChunk(m_Chunks.size() - 1);
+		else
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+		// The chunk owns its storage, which may be reallocated.
+		Chunk& lastChunk = *m_Chunks.back();
+		assert(lastChunk.Storage->size() == m_Size % ChunkSize && "The storage must hold the last chunk only");
+		T& addedValue = lastChunk.Storage->emplace_back(std::forward<Args>(args)...);
+		lastChunk.Data = lastChunk.Storage->data();
+		m_ChunkData.back() = lastChunk.Data;
+		++m_Size;
+		return addedValue;
+	}
+
+	/// @brief Reserve the table of the chunks for the given number of values, and their storage if the vector owns it.
+	void reserve(size_t size)
+	{
+		m_Chunks.reserve(GetChunkCount(size));
+		m_ChunkData.reserve(GetChunkCount(size));
+		if(size > m_Size && CanGrowStorage() && !IsShared())
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+			m_Chunks.front()->Storage->reserve(size);
+			PointChunksIntoStorage(0);
+		}
+	}
+
+	/// @brief Check if any chunk is shared with another vector.
+	bool IsShared() const
+	{
+		for(const std::shared_ptr<Chunk>& curChunk : m_Chunks)
+		{
+			if(curChunk.use_count() > 1)
+				return true;
+		}
+		return false;
+	}
+
+	/// @brief Check if the chunk at the given index is shared with another vector.
+	bool IsChunkShared(size_t chunkIdx) const
+	{
+		assert(chunkIdx < m_Chunks.size() && "Index out of bound");
+		return m_Chunks[chunkIdx].use_count() > 1;
+	}
+
+	/// @brief Get the number of chunks.
+	size_t GetChunkCount() const { return m_Chunks.size(); }
+
+	/// @brief Get the number of values.
+	size_t size() const { return m_Size; }
+	/// @brief Check if there is no value.
+	bool empty() const { return m_Size == 0; }
+	/// @brief Get the value at the given index.
+	const T& operator[](size_t index) const
+	{
+		assert(index < m_Size && "Index out of bound");
+		return m_ChunkData[index / ChunkSize][index % ChunkSize];
+	}
+	/// @brief Get the first value.
+	auto begin() const { return Read().begin(); }
+	/// @brief Get past the last value.
+	auto end() const { return Read().end(); }
+
+private:
+	/// @brief Chunk of values, in its own storage or in the storage of a vector given as a whole.
+	struct Chunk
+	{
+		/// @brief Storage of the values, shared by the chunks of a vector given as a whole.
+		std::shared_ptr<std::vector<T>> Storage{};
+		/// @brief First value of the chunk in the storage.
+		T* Data{ nullptr };
+	};
+
+	/// @brief Get the number of chunks needed for the given number of values.
+	static size_t GetChunkCount(size_t size) { return (size + ChunkSize - 1) / ChunkSize; }
+
+	/// @brief Check if the chunk is not shared, and is the only one pointing to its storage, from its start.
+	static bool IsOwnedChunk(const std::shared_ptr<Chunk>& chunk)
+	{
+		return chunk.use_count() == 1 && chunk->Storage.use_count() == 1 && chunk->Data == chunk->Storage->data();
+	}
+
+	/// @brief Check if a value can be added to the storage of the chunks, keeping the values contiguous.
+	/// @note The storage must hold the values of this vector only. If it may be reallocated, none of its chunks must be
+	/// shared with another vector either.
+	bool CanGrowStorage() const
+	{
+		if(!m_IsContiguous || m_Chunks.empty() || m_Chunks.back().use_count() != 1)
+			return false;
+
+		const std::vector<T>& storage = *m_Chunks.front()->Storage;
+		if(m_Chunks.front()->Storage.use_count() != static_cast<long>(m_Chunks.size()) || storage.size() != m_Size
+		   || storage.data() != m_ChunkData.front())
+			return false;
+		return storage.size() < storage.capacity() || !IsShared();
+	}
+
+	/// @brief Point the chunks from the given index into the storage of the first one, after it grew.
+	void PointChunksIntoStorage(size_t firstChunkIdx)
+	{
+		T* storageData = m_Chunks.front()->Storage->data();
+		for(size_t iChunk = firstChunkIdx; iChunk < m_Chunks.size(); ++iChunk)
+		{
+			m_ChunkData[iChunk] = storageData + iChunk * ChunkSize;
+			m_Chunks[iChunk]->Data = m_ChunkData[iChunk];
+		}
+	}
+
+	/// @brief Replace the values by the given ones, the chunks pointing into their storage.
+	void Assign(const std::shared_ptr<std::vector<T>>& storage)
+	{
+		m_Size = storage->size();
+		const size_t chunkCount = GetChunkCount(m_Size);
+		m_Chunks.resize(chunkCount);
+		m_ChunkData.resize(chunkCount);
+		for(size_t iChunk = 0; iChunk < chunkCount; ++iChunk)
+		{
+			m_ChunkData[iChunk] = storage->data() + iChunk * ChunkSize;
+			m_Chunks[iChunk] = std::make_shared<Chunk>(Chunk{ .Storage = storage, .Data = m_ChunkData[iChunk] });
+		}
+		m_IsContiguous = true;
+	}
+
+	/// @brief Copy the values of the chunk at the given index into its own storage.
+	void CopyChunk(size_t chunkIdx)
+	{
+		const T* chunkData = m_ChunkData[chunkIdx];
+		const size_t valueCount = std::min(ChunkSize, m_Size - chunkIdx * ChunkSize);
+		auto storage = std::make_shared<std::vector<T>>(chunkData, chunkData + valueCount);
+		m_Chunks[chunkIdx] = std::make_shared<Chunk>(Chunk{ .Storage = storage, .Data = storage->data() });
+		m_ChunkData[chunkIdx] = storage->data();
+		m_IsContiguous = m_Chunks.size() == 1;
+	}
+
+	/// @brief Get the values of the chunk at the given index to modify them, copying them first if they are shared.
+	T* WriteChunk(size_t chunkIdx)
+	{
+		if(m_Chunks[chunkIdx].use_count() != 1)
+			CopyChunk(chunkIdx);
+		else
+		{
+			// The last reads of the copies released on other threads happen before the writes.
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+		return m_ChunkData[chunkIdx];
+	}
+
+private:
+	/// @brief Chunks of values, shared by the copies until one of them is modified.
+	std::vector<std::shared_ptr<Chunk>> m_Chunks{};
+	/// @brief First value of each chunk, for the views.
+	std::vector<T*> m_ChunkData{};
+	/// @brief Number of values.
+	size_t m_Size{ 0 };
+	/// @brief Whether the chunks follow each other in a single storage.
+	bool m_IsContiguous{ true };
+};
+
+/// @brief View to modify the values of a ChunkedCowVector, copying the chunk of a value on its first write if it is
+/// shared.
+/// @note Each access goes through ChunkedCowVector::Write(index), so writing a few values of a copy duplicates their
+/// chunks only. A shared chunk must not be written from several threads at once, ChunkedCowVector::Write gives a view
+/// for parallel writes.
+template<typename T>
+class ChunkedWriteSpan
+{
+public:
+	/// @brief Random access iterator over the values, writing each value through the vector.
+	class Iterator
+	{
+	public:
+		using iterator_concept = std::random_access_iterator_tag;
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+
+	public:
+		/// @brief Default ctor.
+		Iterator() = default;
+
+		/// @brief Construct an iterator on the value at the given index of the vector.
+		Iterator(ChunkedCowVector<T>* values, size_t index)
+			: m_Values(values)
+			, m_Index(index)
+		{}
+
+		reference operator*() const { return m_Values->Write(m_Index); }
+		pointer operator->() const { return &**this; }
+		reference operator[](difference_type offset) const { return *(*this + offset); }
+
+		Iterator& operator++()
+		{
+			++m_Index;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			Iterator previous = *this;
+			++m_Index;
+			return previous;
+		}
+		Iterator& operator--()
+		{
+			--m_Index;
+			return *this;
+		}
+		Iterator operator--(int)
+		{
+			Iterator previous = *this;
+			--m_Index;
+			return previous;
+		}
+		Iterator& operator+=(difference_type offset)
+		{
+			m_Index += offset;
+			return *this;
+		}
+		Iterator& operator-=(difference_type offset)
+		{
+			m_Index -= offset;
+			return *this;
+		}
+
+		friend Iterator operator+(Iterator iterator, difference_type offset) { return iterator += offset; }
+		friend Iterator operator+(difference_type offset, Iterator iterator) { return iterator += offset; }
+		friend Iterator operator-(Iterator iterator, difference_type offset) { return iterator -= offset; }
+		friend difference_type operator-(const Iterator& first, const Iterator& second)
+		{
+			return static_cast<difference_type>(first.m_Index - second.m_Index);
+		}
+		friend bool operator==(const Iterator& first, const Iterator& second)
+		{
+			return first.m_Index == second.m_Index;
+		}
+		friend std::strong_ordering operator<=>(const Iterator& first, const Iterator& second)
+		{
+			return first.m_Index <=> second.m_Index;
+		}
+
+	private:
+		/// @brief Vector of the values.
+		ChunkedCowVector<T>* m_Values{ nullptr };
+		/// @brief Index of the value in the vector.
+		size_t m_Index{ 0 };
+	};
+
+public:
+	/// @brief Construct a view over the values of the given vector.
+	explicit ChunkedWriteSpan(ChunkedCowVector<T>& values)
+		: m_Values(&values)
+	{}
+
+	/// @brief Implicit conversion to a view over the values, for read-only use without copying any chunk.
+	operator ChunkedSpan<const T>() const { return m_Values->Read(); }
+
+	/// @brief Get the number of values.
+	size_t size() const { return m_Values->size(); }
+	/// @brief Check if there is no value.
+	bool empty() const { return m_Values->empty(); }
+
+	/// @brief Get the value at the given index to modify it, copying its chunk first if it is shared.
+	T& operator[](size_t index) const { return m_Values->Write(index); }
+
+	/// @brief Get the first value.
+	Iterator begin() const { return Iterator(m_Values, 0); }
+	/// @brief Get past the last value.
+	Iterator end() const { return Iterator(m_Values, m_Values->size()); }
+
+private:
+	/// @brief Vector of the values.
+	ChunkedCowVector<T>* m_Values{ nullptr };
+};
+} // namespace Core::Container
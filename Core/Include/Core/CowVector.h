@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Core::Container
+{
+/// @brief Vector sharing its values with its copies until one of them is modified (copy-on-write).
+/// @note Copies are O(1). The const accessors never copy the values, Write copies them first if they are shared, so a
+/// copy is never modified through another one and can be read by other threads while the original is edited. A
+/// reference obtained through Write must not be used after the vector is copied.
+template<typename T>
+class CowVector
+{
+public:
+	/// @brief Default ctor.
+	CowVector() = default;
+
+	/// @brief Construct a vector taking the ownership of the given values.
+	explicit CowVector(std::vector<T>&& values)
+		: m_Values(std::make_shared<std::vector<T>>(std::move(values)))
+	{}
+
+	/// @brief Get the values, without copying them.
+	const std::vector<T>& Read() const { return m_Values ? *m_Values : GetEmptyValues(); }
+
+	/// @brief Get the values to modify them, copying them first if they are shared with another vector.
+	std::vector<T>& Write()
+	{
+		if(!m_Values)
+			m_Values = std::make_shared<std::vector<T>>();
+		else if(m_Values.use_count() != 1)
+			m_Values = std::make_shared<std::vector<T>>(*m_Values);
+		else
+		{
+			// The last reads of the copies released on other threads happen before the writes.
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+		return *m_Values;
+	}
+
+	/// @brief Check if the values are shared with another vector.
+	bool IsShared() const { return m_Values && m_Values.use_count() > 1; }
+
+	/// @brief Implicit conversion to the values, for read-only use.
+	operator const std::vector<T>&() const { return Read(); }
+
+	/// @brief Get the number of values.
+	size_t size() const { return Read().size(); }
+	/// @brief Check if there is no value.
+	bool empty() const { return Read().empty(); }
+	/// @brief Get the value at the given index.
+	const T& operator[](size_t index) const
+	{
+		assert(index < size() && "Index out of bound");
+		return (*m_Values)[index];
+	}
+	/// @brief Get the first value.
+	auto begin() const { return Read().begin(); }
+	/// @brief Get past the last value.
+	auto end() const { return Read().end(); }
+	/// @brief Get a pointer to the values.
+	const T* data() const { return Read().data(); }
+
+private:
+	/// @brief Get the values of the vectors without allocated values.
+	static const std::vector<T>& GetEmptyValues()
+	{
+		static const std::vector<T> emptyValues;
+		return emptyValues;
+	}
+
+private:
+	/// @brief Values, shared by the copies until one of them is modified.
+	std::shared_ptr<std::vector<T>> m_Values{};
+};
+} // namespace Core::Container
@@ -0,0 +1,292 @@
+#pragma once
+
+#include "Core/Hash.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Core::Container
+{
+/// @brief Open addressing hash table, storing its keys and values in flat arrays (base of FlatHashMap and
+/// FlatHashSet).
+/// @note Each slot has a control byte, zero when the slot is empty and holding 7 bits of the hash of its key
+/// otherwise, so that probing mostly reads the control bytes. Collisions are resolved by linear probing and erasing
+/// shifts the following keys back, so there is no tombstone. The hash of the keys is mixed again (see
+/// Core::Hash::Mix), identity hashes of integers being fine. Keys and values must be default constructible: the
+/// empty slots hold default ones. The iteration order only depends on the inserted keys and their order.
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+class FlatHashTable
+{
+public:
+	/// @brief Get the number of keys.
+	size_t GetSize() const { return m_Size; }
+
+	/// @brief Check if there is no key.
+	bool IsEmpty() const { return m_Size == 0; }
+
+	/// @brief Get the number of slots.
+	size_t GetCapacity() const { return m_Controls.size(); }
+
+	/// @brief Allocate the slots needed to store the given number of keys without rehashing.
+	void Reserve(size_t count)
+	{
+		const size_t capacity = std::bit_ceil(std::max(MinCapacity, count + count / (MaxLoadDenominator - 1) + 1));
+		if(capacity > GetCapacity())
+			Rehash(capacity);
+	}
+
+	/// @brief Remove every key, keeping the slots.
+	void Clear()
+	{
+		std::ranges::fill(m_Controls, EmptyControl);
+		std::ranges::fill(m_Keys, Key{});
+		if constexpr(HasValues)
+			std::ranges::fill(m_Values, Value{});
+		m_Size = 0;
+	}
+
+	/// @brief Check if the table contains the given key.
+	bool Contains(const Key& key) const { return FindSlot(key) != NoSlot; }
+
+	/// @brief Remove a key (and its value).
+	/// @return True if the key was in the table.
+	bool Erase(const Key& key)
+	{
+		size_t holeSlot = FindSlot(key);
+		if(holeSlot == NoSlot)
+			return false;
+
+		// Move back the following keys of the probe sequence which may be stored in the hole.
+		const size_t mask = GetCapacity() - 1;
+		for(size_t iSlot = (holeSlot + 1) & mask; m_Controls[iSlot] != EmptyControl; iSlot = (iSlot + 1) & mask)
+		{
+			const size_t homeSlot = GetHash(m_Keys[iSlot]) & mask;
+			if(((iSlot - homeSlot) & mask) < ((iSlot - holeSlot) & mask))
+				continue;
+			MoveSlot(iSlot, holeSlot);
+			holeSlot = iSlot;
+		}
+
+		m_Controls[holeSlot] = EmptyControl;
+		m_Keys[holeSlot] = Key{};
+		if constexpr(HasValues)
+			m_Values[holeSlot] = Value{};
+		--m_Size;
+		return true;
+	}
+
+protected:
+	/// @brief Check if the table stores values (void for a set).
+	static constexpr bool HasValues = !std::is_void_v<Value>;
+	/// @brief Index returned when a key is not found.
+	static constexpr size_t NoSlot = ~size_t(0);
+
+	/// @brief Get the slot of a key.
+	/// @return The slot of the key, or NoSlot if it is not in the table.
+	size_t FindSlot(const Key& key) const
+	{
+		if(m_Size == 0)
+			return NoSlot;
+
+		const uint64_t hash = GetHash(key);
+		const uint8_t control = GetControl(hash);
+		const size_t mask = GetCapacity() - 1;
+		for(size_t iSlot = hash & mask;; iSlot = (iSlot + 1) & mask)
+		{
+			if(m_Controls[iSlot] == EmptyControl)
+				return NoSlot;
+			if(m_Controls[iSlot] == control && KeyEqual{}(m_Keys[iSlot], key))
+				return iSlot;
+		}
+	}
+
+	/// @brief Get the slot of a key, inserting it (with a default value) if it is not in the table.
+	/// @return The slot of the key and true if it has been inserted.
+	std::pair<size_t, bool> FindOrInsertSlot(const Key& key)
+	{
+		if((m_Size + 1) * MaxLoadDenominator > GetCapacity() * (MaxLoadDenominator - 1))
+			Rehash(std::max(MinCapacity, 2 * GetCapacity()));
+
+		const uint64_t hash = GetHash(key);
+		const uint8_t control = GetControl(hash);
+		const size_t mask = GetCapacity() - 1;
+		size_t iSlot = hash & mask;
+		for(; m_Controls[iSlot] != EmptyControl; iSlot = (iSlot + 1) & mask)
+		{
+			if(m_Controls[iSlot] == control && KeyEqual{}(m_Keys[iSlot], key))
+				return { iSlot, false };
+		}
+
+		m_Controls[iSlot] = control;
+		m_Keys[iSlot] = key;
+		++m_Size;
+		return { iSlot, true };
+	}
+
+	/// @brief Call a function on the slot of each key, in slot order.
+	template<typename Func>
+	void ForEachSlot(Func&& func) const
+	{
+		for(size_t iSlot = 0; iSlot < m_Controls.size(); ++iSlot)
+		{
+			if(m_Controls[iSlot] != EmptyControl)
+				func(iSlot);
+		}
+	}
+
+private:
+	/// @brief Control byte of the empty slots.
+	static constexpr uint8_t EmptyControl = 0;
+	/// @brief Minimal number of slots once the table is allocated.
+	static constexpr size_t MinCapacity = 8;
+	/// @brief The table grows when more than (MaxLoadDenominator - 1) / MaxLoadDenominator of its slots are full.
+	static constexpr size_t MaxLoadDenominator = 8;
+
+	/// @brief Get the mixed hash of a key.
+	static uint64_t GetHash(const Key& key) { return Core::Hash::Mix(static_cast<uint64_t>(Hash{}(key))); }
+
+	/// @brief Get the control byte of a full slot from the hash of its key (its high bits, the low ones giving the
+	/// slot).
+	static uint8_t GetControl(uint64_t hash) { return static_cast<uint8_t>(0x80 | (hash >> 57)); }
+
+	/// @brief Move the key (and value) of a full slot to an empty one.
+	void MoveSlot(size_t fromSlot, size_t toSlot)
+	{
+		m_Controls[toSlot] = std::exchange(m_Controls[fromSlot], EmptyControl);
+		m_Keys[toSlot] = std::move(m_Keys[fromSlot]);
+		if constexpr(HasValues)
+			m_Values[toSlot] = std::move(m_Values[fromSlot]);
+	}
+
+	/// @brief Reallocate the slots and insert the keys again.
+	/// @param capacity New number of slots, a power of two.
+	void Rehash(size_t capacity)
+	{
+		assert(std::has_single_bit(capacity) && capacity > m_Size);
+
+		std::vector<uint8_t> oldControls = std::exchange(m_Controls, std::vector<uint8_t>(capacity, EmptyControl));
+		std::vector<Key> oldKeys = std::exchange(m_Keys, std::vector<Key>(capacity));
+		[[maybe_unused]] ValueStorage oldValues{};
+		if constexpr(HasValues)
+			oldValues = std::exchange(m_Values, std::vector<Value>(capacity));
+
+		const size_t mask = capacity - 1;
+		for(size_t iOldSlot = 0; iOldSlot < oldControls.size(); ++iOldSlot)
+		{
+			if(oldControls[iOldSlot] == EmptyControl)
+				continue;
+
+			size_t iSlot = GetHash(oldKeys[iOldSlot]) & mask;
+			while(m_Controls[iSlot] != EmptyControl)
+				iSlot = (iSlot + 1) & mask;
+			m_Controls[iSlot] = oldControls[iOldSlot];
+			m_Keys[iSlot] = std::move(oldKeys[iOldSlot]);
+			if constexpr(HasValues)
+				m_Values[iSlot] = std::move(oldValues[iOldSlot]);
+		}
+	}
+
+protected:
+	/// @brief Type storing the values (nothing for a set).
+	using ValueStorage = std::conditional_t<HasValues, std::vector<Value>, std::monostate>;
+
+	/// @brief Control byte of each slot.
+	std::vector<uint8_t> m_Controls{};
+	/// @brief Key of each slot.
+	std::vector<Key> m_Keys{};
+	/// @brief Value of each slot.
+	[[no_unique_address]] ValueStorage m_Values{};
+	/// @brief Number of keys.
+	size_t m_Size{ 0 };
+};
+
+/// @brief Hash map storing its keys and values in flat arrays, without allocation per key (see FlatHashTable).
+/// @note References to the values are invalidated by the insertions and erasures.
+template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap : public FlatHashTable<Key, Value, Hash, KeyEqual>
+{
+	using Base = FlatHashTable<Key, Value, Hash, KeyEqual>;
+
+public:
+	/// @brief Default ctor.
+	FlatHashMap() = default;
+
+	/// @brief Construct a map with the slots needed to store the given number of keys.
+	explicit FlatHashMap(size_t count) { this->Reserve(count); }
+
+	/// @brief Insert a key with a value constructed from the given arguments, if the key is not in the map.
+	/// @return The value of the key and true if it has been inserted.
+	template<typename... Args>
+	std::pair<Value&, bool> TryEmplace(const Key& key, Args&&... args)
+	{
+		const auto [slot, isInserted] = this->FindOrInsertSlot(key);
+		if(isInserted)
+			this->m_Values[slot] = Value(std::forward<Args>(args)...);
+		return { this->m_Values[slot], isInserted };
+	}
+
+	/// @brief Get the value of a key, inserting a default value if the key is not in the map.
+	Value& operator[](const Key& key) { return this->m_Values[this->FindOrInsertSlot(key).first]; }
+
+	/// @brief Get the value of a key.
+	/// @return The value, or nullptr if the key is not in the map.
+	Value* Find(const Key& key)
+	{
+		const size_t slot = this->FindSlot(key);
+		return slot == Base::NoSlot ? nullptr : &this->m_Values[slot];
+	}
+
+	/// @brief Get the value of a key (const version).
+	const Value* Find(const Key& key) const
+	{
+		const size_t slot = this->FindSlot(key);
+		return slot == Base::NoSlot ? nullptr : &this->m_Values[slot];
+	}
+
+	/// @brief Call a function on each key and its value.
+	template<typename Func>
+	void ForEach(Func&& func) const
+	{
+		this->ForEachSlot(
+			[&](size_t iSlot)
+			{
+				func(this->m_Keys[iSlot], this->m_Values[iSlot]);
+			});
+	}
+};
+
+/// @brief Hash set storing its keys in a flat array, without allocation per key (see FlatHashTable).
+template<typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashSet : public FlatHashTable<Key, void, Hash, KeyEqual>
+{
+public:
+	/// @brief Default ctor.
+	FlatHashSet() = default;
+
+	/// @brief Construct a set with the slots needed to store the given number of keys.
+	explicit FlatHashSet(size_t count) { this->Reserve(count); }
+
+	/// @brief Insert a key.
+	/// @return True if the key was not in the set.
+	bool Insert(const Key& key) { return this->FindOrInsertSlot(key).second; }
+
+	/// @brief Call a function on each key.
+	template<typename Func>
+	void ForEach(Func&& func) const
+	{
+		this->ForEachSlot(
+			[&](size_t iSlot)
+			{
+				func(this->m_Keys[iSlot]);
+			});
+	}
+};
+} // namespace Core::Container
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cassert>
+#include <charconv>
+#include <string>
+#include <system_error>
+
+/// @brief Helpers to format text into buffers, without locale nor allocation per value.
+/// @note Each function appends to a buffer, whose capacity is kept when it is cleared to format the next text.
+namespace Core::Format
+{
+/// @brief Append a number (integer or floating point) to the buffer.
+/// @note Floating point numbers are written in the shortest form reading back to the same value (with
+/// std::from_chars or Core::Parse::ParseNumber), independently of the locale.
+template<typename T>
+void AppendNumber(std::string& buffer, T value)
+{
+	// Large enough for any integer and for the shortest round trip form of any float or double.
+	char digits[32];
+	const auto [ptr, errorCode] = std::to_chars(digits, digits + sizeof(digits), value);
+	assert(errorCode == std::errc() && "The number does not fit in the digits");
+	buffer.append(digits, ptr);
+}
+
+/// @brief Append numbers separated by spaces to the buffer.
+template<typename T, typename... Ts>
+void AppendNumbers(std::string& buffer, T value, Ts... values)
+{
+	AppendNumber(buffer, value);
+	((buffer += ' ', AppendNumber(buffer, values)), ...);
+}
+} // namespace Core::Format
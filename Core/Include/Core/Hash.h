@@ -0,0 +1,53 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace Core::Hash
+{
+/// @brief Mix the bits of a value, each input bit affecting every output bit (finalizer of MurmurHash3).
+/// @note Identity hashes (e.g. std::hash of integers) or packed indices differing only in their high bits are spread
+/// over the low bits used to index a hash table.
+constexpr uint64_t Mix(uint64_t value)
+{
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDull;
+	value ^= value >> 33;
+	value *= 0xC4CEB9FE1A85EC53ull;
+	value ^= value >> 33;
+	return value;
+}
+
+/// @brief Combine a hash with another value, the order of the combined values mattering.
+constexpr uint64_t Combine(uint64_t hash, uint64_t value)
+{
+	return Mix(hash + 0x9E3779B97F4A7C15ull + value);
+}
+
+/// @brief Hash an undirected edge, given by its two vertex indices in any order.
+constexpr uint64_t HashEdge(uint32_t firstIndex, uint32_t secondIndex)
+{
+	const auto [minIndex, maxIndex] = std::minmax(firstIndex, secondIndex);
+	return Mix((static_cast<uint64_t>(minIndex) << 32) | maxIndex);
+}
+
+/// @brief Get the bits of a float, -0 and +0 having the same bits as they compare equal.
+inline uint32_t GetFloatBits(float value)
+{
+	return std::bit_cast<uint32_t>(value + 0.f);
+}
+
+/// @brief Hash the exact bits of the coordinates of a vector.
+/// @note Unlike a truncation to integers, close or symmetric coordinates get unrelated hashes.
+/// @tparam VectorT Float vector type of glm.
+template<typename VectorT>
+uint64_t HashVector(const VectorT& vector)
+{
+	constexpr int CoordCount = static_cast<int>(sizeof(VectorT) / sizeof(float));
+	uint64_t hash = 0;
+	for(int iCoord = 0; iCoord < CoordCount; ++iCoord)
+		hash = Combine(hash, GetFloatBits(vector[iCoord]));
+	return hash;
+}
+} // namespace Core::Hash
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace Core::IO
+{
+/// @brief Read-only memory mapping of a whole file.
+/// @note The mapping is released when the object is destroyed.
+class MappedFile
+{
+public:
+	/// @brief Default ctor (no file mapped).
+	MappedFile() = default;
+	/// @brief Map the file at the given path in memory.
+	/// @param filepath Path to the file to map.
+	/// @note Use IsOpen() to check if the mapping succeeded.
+	explicit MappedFile(const std::filesystem::path& filepath);
+	~MappedFile();
+
+	/// @brief Disable copy semantics.
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/// @brief Enable move semantics.
+	MappedFile(MappedFile&& other) noexcept;
+	/// @brief Enable move semantics.
+	MappedFile& operator=(MappedFile&& other) noexcept;
+
+	/// @brief Check if the file has been successfully mapped.
+	bool IsOpen() const;
+
+	/// @brief Get a pointer to the first byte of the file.
+	/// @note Returns nullptr for an empty file.
+	const char* GetData() const;
+
+	/// @brief Get the size of the file (in bytes).
+	size_t GetSize() const;
+
+	/// @brief Get a view on the whole content of the file.
+	std::string_view GetView() const;
+
+private:
+	/// @brief Release the mapping.
+	void Close();
+
+private:
+	/// @brief Pointer to the mapped memory.
+	const char* m_Data{ nullptr };
+	/// @brief Size of the mapped memory (in bytes).
+	size_t m_Size{ 0 };
+	/// @brief Whether the file has been successfully opened.
+	bool m_IsOpen{ false };
+};
+} // namespace Core::IO
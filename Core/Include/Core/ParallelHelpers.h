@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/// @brief Helpers to split work between several threads.
+namespace Core::Parallel
+{
+/// @brief Get the number of threads used by default by the parallel helpers.
+inline uint32_t GetDefaultThreadCount()
+{
+	const uint32_t hardwareThreadCount = std::thread::hardware_concurrency();
+	return std::max(hardwareThreadCount, 1u);
+}
+
+/// @brief Get the number of ranges to use to process count elements with at least grainSize elements per range.
+/// @param count Number of elements to process.
+/// @param grainSize Minimal number of elements processed by a range.
+/// @param threadCount Maximal number of ranges (0 to use the default thread count).
+inline uint32_t GetRangeCount(size_t count, size_t grainSize, uint32_t threadCount = 0)
+{
+	if(threadCount == 0)
+		threadCount = GetDefaultThreadCount();
+
+	const size_t maxRangeCount = (count + std::max<size_t>(grainSize, 1) - 1) / std::max<size_t>(grainSize, 1);
+	return static_cast<uint32_t>(std::clamp<size_t>(maxRangeCount, 1, threadCount));
+}
+
+/// @brief Get the first element of a range when [0, count) is split in rangeCount contiguous ranges.
+inline size_t GetRangeBegin(size_t count, uint32_t rangeCount, uint32_t rangeIdx)
+{
+	return count * rangeIdx / rangeCount;
+}
+
+/// @brief Call func(taskIdx) for each task of [0, taskCount), each task running on its own thread.
+/// @note The last task is run on the calling thread.
+template<typename Func>
+void ForEachTask(uint32_t taskCount, Func&& func)
+{
+	if(taskCount == 0)
+		return;
+
+	std::vector<std::jthread> threads;
+	threads.reserve(taskCount - 1);
+	for(uint32_t iTask = 0; iTask + 1 < taskCount; ++iTask)
+		threads.emplace_back([&func, iTask]() { func(iTask); });
+
+	func(taskCount - 1);
+	// Threads are joined when leaving the scope.
+}
+
+/// @brief Split [0, count) in rangeCount contiguous ranges and call func(rangeIdx, begin, end) on each of them in
+/// parallel.
+template<typename Func>
+void ForEachRange(size_t count, uint32_t rangeCount, Func&& func)
+{
+	ForEachTask(
+		rangeCount,
+		[&](uint32_t iRange)
+		{
+			func(iRange, GetRangeBegin(count, rangeCount, iRange), GetRangeBegin(count, rangeCount, iRange + 1));
+		});
+}
+
+/// @brief Call func(index) for each index of [0, count) in parallel.
+/// @param count Number of elements to process.
+/// @param func Function called on each element index.
+/// @param grainSize Minimal number of elements processed by a thread.
+/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+template<typename Func>
+void For(size_t count, Func&& func, size_t grainSize = 4096, uint32_t threadCount = 0)
+{
+	ForEachRange(
+		count,
+		GetRangeCount(count, grainSize, threadCount),
+		[&](uint32_t, size_t begin, size_t end)
+		{
+			for(size_t index = begin; index < end; ++index)
+				func(index);
+		});
+}
+} // namespace Core::Parallel
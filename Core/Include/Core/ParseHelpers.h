@@ -0,0 +1,94 @@
+#pragma once
+
+#include <charconv>
+#include <string_view>
+#include <system_error>
+
+/// @brief Helpers to parse text buffers in place, without any allocation.
+/// @note Each function takes a cursor on the current character and the end of the buffer, and moves the cursor
+/// forward past what has been consumed.
+namespace Core::Parse
+{
+/// @brief Check if the character is a blank character (whitespace that does not end the line).
+constexpr bool IsBlank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/// @brief Check if the character is a whitespace character.
+constexpr bool IsWhitespace(char c)
+{
+	return IsBlank(c) || c == '\n';
+}
+
+/// @brief Skip blank characters, without leaving the current line.
+inline void SkipBlanks(const char*& cur, const char* end)
+{
+	while(cur != end && IsBlank(*cur))
+		++cur;
+}
+
+/// @brief Skip whitespace characters, including line breaks.
+inline void SkipWhitespace(const char*& cur, const char* end)
+{
+	while(cur != end && IsWhitespace(*cur))
+		++cur;
+}
+
+/// @brief Skip the rest of the current line, including the line break.
+inline void SkipLine(const char*& cur, const char* end)
+{
+	while(cur != end && *cur != '\n')
+		++cur;
+	if(cur != end)
+		++cur;
+}
+
+/// @brief Skip whitespace characters and comment lines (starting with '#').
+inline void SkipWhitespaceAndComments(const char*& cur, const char* end)
+{
+	while(cur != end)
+	{
+		if(*cur == '#')
+			SkipLine(cur, end);
+		else if(IsWhitespace(*cur))
+			++cur;
+		else
+			break;
+	}
+}
+
+/// @brief Read the next token of the current line (a sequence of non whitespace characters).
+/// @return The token, or an empty view if the end of the line has been reached.
+inline std::string_view ParseToken(const char*& cur, const char* end)
+{
+	SkipBlanks(cur, end);
+	const char* begin = cur;
+	while(cur != end && !IsWhitespace(*cur))
+		++cur;
+	return { begin, static_cast<size_t>(cur - begin) };
+}
+
+/// @brief Read the next number (integer or floating point) after the leading whitespace.
+/// @param cur Cursor on the buffer, moved past the number on success.
+/// @param end End of the buffer.
+/// @param value Parsed value.
+/// @return True if a number has been parsed, false otherwise (the cursor is then left on the unexpected character).
+template<typename T>
+bool ParseNumber(const char*& cur, const char* end, T& value)
+{
+	SkipWhitespace(cur, end);
+
+	// std::from_chars does not accept an explicit positive sign.
+	const char* first = cur;
+	if(first != end && *first == '+')
+		++first;
+
+	auto [ptr, errorCode] = std::from_chars(first, end, value);
+	if(errorCode != std::errc())
+		return false;
+
+	cur = ptr;
+	return true;
+}
+} // namespace Core::Parse
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Core/ParallelHelpers.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Core::Parallel
+{
+/// @brief Stable LSD radix sort of values by an unsigned integer key, using several threads.
+/// @param values Values to sort.
+/// @param getKey Function returning the key (up to 64 bits) of a value.
+/// @param keyBitCount Number of significant bits of the keys, higher bits are ignored.
+/// @param threadCount Maximal number of threads to use (0 to use the default thread count).
+/// @note Keys are sorted 8 bits at a time. Each thread builds the histogram of its own range, then scatters it to
+/// the offsets given by a prefix sum over (digit, range), which keeps the sort stable. A pass is skipped when all
+/// the keys share the same digit.
+template<typename T, typename KeyFunc>
+void RadixSort(std::vector<T>& values, KeyFunc&& getKey, uint32_t keyBitCount = 64, uint32_t threadCount = 0)
+{
+	constexpr uint32_t DigitBitCount = 8;
+	constexpr size_t DigitCount = size_t(1) << DigitBitCount;
+
+	const size_t count = values.size();
+	if(count < 2)
+		return;
+
+	const uint32_t rangeCount = GetRangeCount(count, 1 << 14, threadCount);
+	std::vector<std::array<size_t, DigitCount>> histograms(rangeCount);
+	std::vector<T> buffer(count);
+
+	for(uint32_t shift = 0; shift < keyBitCount; shift += DigitBitCount)
+	{
+		auto GetDigit = [&getKey, shift](const T& value)
+		{
+			return static_cast<size_t>((static_cast<uint64_t>(getKey(value)) >> shift) & (DigitCount - 1));
+		};
+
+		// Count the digits of each range.
+		ForEachRange(
+			count,
+			rangeCount,
+			[&](uint32_t iRange, size_t begin, size_t end)
+			{
+				std::array<size_t, DigitCount>& curHistogram = histograms[iRange];
+				curHistogram.fill(0);
+				for(size_t index = begin; index < end; ++index)
+					++curHistogram[GetDigit(values[index])];
+			});
+
+		// Skip the pass if all the keys have the same digit.
+		const size_t firstDigit = GetDigit(values.front());
+		size_t firstDigitCount = 0;
+		for(const auto& curHistogram : histograms)
+			firstDigitCount += curHistogram[firstDigit];
+		if(firstDigitCount == count)
+			continue;
+
+		// Turn the histograms into scatter offsets.
+		size_t offset = 0;
+		for(size_t iDigit = 0; iDigit < DigitCount; ++iDigit)
+		{
+			for(auto& curHistogram : histograms)
+			{
+				const size_t digitCount = curHistogram[iDigit];
+				curHistogram[iDigit] = offset;
+				offset += digitCount;
+			}
+		}
+
+		// Scatter each range to its offsets.
+		ForEachRange(
+			count,
+			rangeCount,
+			[&](uint32_t iRange, size_t begin, size_t end)
+			{
+				std::array<size_t, DigitCount>& curOffsets = histograms[iRange];
+				for(size_t index = begin; index < end; ++index)
+					buffer[curOffsets[GetDigit(values[index])]++] = values[index];
+			});
+
+		values.swap(buffer);
+	}
+}
+} // namespace Core::Parallel
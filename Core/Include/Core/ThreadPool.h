@@ -0,0 +1,69 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Core::Parallel
+{
+/// @brief Fixed set of worker threads running submitted tasks in submission order.
+/// @note Pending tasks are still run when the pool is destroyed.
+class ThreadPool
+{
+public:
+	/// @brief Start the worker threads.
+	/// @param threadCount Number of worker threads (0 to use the default thread count).
+	explicit ThreadPool(uint32_t threadCount = 0);
+	/// @brief Run the pending tasks and join the worker threads.
+	~ThreadPool();
+
+	/// @brief Disable copy semantics.
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// @brief Get the number of worker threads.
+	uint32_t GetThreadCount() const;
+
+	/// @brief Run func() on a worker thread.
+	/// @return Future holding the value returned by func (or the exception it has thrown).
+	template<typename Func>
+	std::future<std::invoke_result_t<Func>> Submit(Func&& func)
+	{
+		// std::function requires a copyable callable, so the task is shared.
+		auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Func>()>>(std::forward<Func>(func));
+		std::future<std::invoke_result_t<Func>> future = task->get_future();
+		Push(
+			[task]()
+			{
+				(*task)();
+			});
+		return future;
+	}
+
+	/// @brief Get the pool shared by the whole application, created on first use.
+	static ThreadPool& GetDefault();
+
+private:
+	/// @brief Add a task to the queue and wake up a worker thread.
+	void Push(std::function<void()> task);
+	/// @brief Worker thread loop.
+	void Run(std::stop_token stopToken);
+
+private:
+	/// @brief Mutex protecting the task queue.
+	std::mutex m_Mutex;
+	/// @brief Condition notified when a task is pushed or the pool is stopped.
+	std::condition_variable_any m_Condition;
+	/// @brief Pending tasks.
+	std::deque<std::function<void()>> m_Tasks;
+	/// @brief Worker threads.
+	std::vector<std::jthread> m_Threads;
+};
+} // namespace Core::Parallel
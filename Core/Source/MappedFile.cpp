@@ -0,0 +1,98 @@
+#include "Core/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utility>
+
+namespace Core::IO
+{
+MappedFile::MappedFile(const std::filesystem::path& filepath)
+{
+	int fileDescriptor = ::open(filepath.c_str(), O_RDONLY);
+	if(fileDescriptor == -1)
+		return;
+
+	struct stat fileStatus;
+	if(::fstat(fileDescriptor, &fileStatus) == -1 || !S_ISREG(fileStatus.st_mode))
+	{
+		::close(fileDescriptor);
+		return;
+	}
+
+	m_Size = static_cast<size_t>(fileStatus.st_size);
+	if(m_Size > 0)
+	{
+		void* data = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		if(data == MAP_FAILED)
+		{
+			::close(fileDescriptor);
+			m_Size = 0;
+			return;
+		}
+
+		// Files are mostly parsed from the beginning to the end.
+		::madvise(data, m_Size, MADV_SEQUENTIAL);
+		m_Data = static_cast<const char*>(data);
+	}
+
+	// The mapping stays valid once the file descriptor is closed.
+	::close(fileDescriptor);
+	m_IsOpen = true;
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+	: m_Data(std::exchange(other.m_Data, nullptr))
+	, m_Size(std::exchange(other.m_Size, 0))
+	, m_IsOpen(std::exchange(other.m_IsOpen, false))
+{}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if(this != &other)
+	{
+		Close();
+		m_Data = std::exchange(other.m_Data, nullptr);
+		m_Size = std::exchange(other.m_Size, 0);
+		m_IsOpen = std::exchange(other.m_IsOpen, false);
+	}
+	return *this;
+}
+
+bool MappedFile::IsOpen() const
+{
+	return m_IsOpen;
+}
+
+const char* MappedFile::GetData() const
+{
+	return m_Data;
+}
+
+size_t MappedFile::GetSize() const
+{
+	return m_Size;
+}
+
+std::string_view MappedFile::GetView() const
+{
+	return { m_Data, m_Size };
+}
+
+void MappedFile::Close()
+{
+	if(m_Data != nullptr)
+		::munmap(const_cast<char*>(m_Data), m_Size);
+
+	m_Data = nullptr;
+	m_Size = 0;
+	m_IsOpen = false;
+}
+} // namespace Core::IO
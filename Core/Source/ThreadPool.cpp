@@ -0,0 +1,78 @@
+#include "Core/ThreadPool.h"
+
+#include "Core/ParallelHelpers.h"
+
+namespace Core::Parallel
+{
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+	if(threadCount == 0)
+		threadCount = GetDefaultThreadCount();
+
+	m_Threads.reserve(threadCount);
+	for(uint32_t iThread = 0; iThread < threadCount; ++iThread)
+	{
+		m_Threads.emplace_back(
+			[this](std::stop_token stopToken)
+			{
+				Run(stopToken);
+			});
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	for(std::jthread& curThread : m_Threads)
+		curThread.request_stop();
+	m_Condition.notify_all();
+	// Threads are joined when m_Threads is destroyed, once the queue is empty.
+	m_Threads.clear();
+}
+
+uint32_t ThreadPool::GetThreadCount() const
+{
+	return static_cast<uint32_t>(m_Threads.size());
+}
+
+ThreadPool& ThreadPool::GetDefault()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+void ThreadPool::Push(std::function<void()> task)
+{
+	{
+		std::scoped_lock lock(m_Mutex);
+		m_Tasks.emplace_back(std::move(task));
+	}
+	m_Condition.notify_one();
+}
+
+void ThreadPool::Run(std::stop_token stopToken)
+{
+	while(true)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock lock(m_Mutex);
+			m_Condition.wait(
+				lock,
+				stopToken,
+				[this]()
+				{
+					return !m_Tasks.empty();
+				});
+
+			// Stop requested and no task left.
+			if(m_Tasks.empty())
+				return;
+
+			task = std::move(m_Tasks.front());
+			m_Tasks.pop_front();
+		}
+
+		task();
+	}
+}
+} // namespace Core::Parallel
@@ -0,0 +1,32 @@
+include(FetchContent)
+
+find_package(benchmark 1.8 QUIET)
+if (NOT benchmark_FOUND)
+    FetchContent_Declare(
+        googlebenchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG v1.8.3
+    )
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    FetchContent_MakeAvailable(googlebenchmark)
+endif()
+
+# Link the benchmark library and add a target running the benchmarks with a JSON report, to be compared with
+# App/Benchmark/Scripts/compare_benchmarks.py.
+macro(AddBenchmarks target)
+    message("Adding benchmarks to ${target}")
+    target_link_libraries(${target} PRIVATE benchmark::benchmark_main)
+
+    set(BENCHMARK_REPORT_PATH "${CMAKE_BINARY_DIR}/benchmark-${target}")
+    add_custom_target(benchmark-${target}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${BENCHMARK_REPORT_PATH}
+        COMMAND $<TARGET_FILE:${target}>
+            --benchmark_out=${BENCHMARK_REPORT_PATH}/results.json
+            --benchmark_out_format=json
+        WORKING_DIRECTORY $<TARGET_FILE_DIR:${target}>
+        DEPENDS ${target}
+        USES_TERMINAL
+    )
+endmacro()
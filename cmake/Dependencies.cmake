@@ -22,6 +22,9 @@ endif()
 # OpenGL
 find_package(OpenGL REQUIRED)
 
+# Threads
+find_package(Threads REQUIRED)
+
 # GLAD
 FetchContent_Declare(
     glad